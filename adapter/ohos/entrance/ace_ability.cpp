@@ -38,6 +38,7 @@
 #include "adapter/ohos/entrance/utils.h"
 #include "base/geometry/rect.h"
 #include "base/log/log.h"
+#include "base/network/download_manager.h"
 #include "base/subwindow/subwindow_manager.h"
 #include "base/utils/system_properties.h"
 #include "core/common/container_scope.h"
@@ -181,6 +182,7 @@ void AceAbility::OnStart(const Want& want)
         AceApplicationInfo::GetInstance().SetPackageName(abilityContext->GetBundleName());
         AceApplicationInfo::GetInstance().SetDataFileDirPath(abilityContext->GetFilesDir());
         ImageCache::SetImageCacheFilePath(abilityContext->GetCacheDir());
+        DownloadManager::GetInstance().SetCacheDir(abilityContext->GetCacheDir() + "/.http");
         ImageCache::SetCacheFileInfo();
     });
     OHOS::sptr<OHOS::Rosen::Window> window = Ability::GetWindow();
@@ -23,6 +23,7 @@
 
 #include "base/log/ace_trace.h"
 #include "base/log/log.h"
+#include "base/resource/mapped_file.h"
 
 namespace OHOS::Ace {
 
@@ -44,25 +45,25 @@ bool FileAssetProvider::IsValid() const
     return true;
 }
 
+// Exposes the content of a mapped file to the asset manager, the file is released with the mapping.
 class FileAssetMapping : public fml::Mapping {
 public:
-    FileAssetMapping(std::unique_ptr<uint8_t[]> data, size_t size) : data_(std::move(data)), size_(size) {}
+    explicit FileAssetMapping(const RefPtr<MappedFile>& file) : file_(file) {}
 
     ~FileAssetMapping() override = default;
 
     size_t GetSize() const override
     {
-        return size_;
+        return file_->GetSize();
     }
 
     const uint8_t* GetMapping() const override
     {
-        return data_.get();
+        return file_->GetData();
     }
 
 private:
-    std::unique_ptr<uint8_t[]> data_ = nullptr;
-    size_t size_ = 0;
+    RefPtr<MappedFile> file_;
 };
 
 std::unique_ptr<fml::Mapping> FileAssetProvider::GetAsMapping(const std::string& assetName) const
@@ -73,36 +74,11 @@ std::unique_ptr<fml::Mapping> FileAssetProvider::GetAsMapping(const std::string&
 
     for (const auto& basePath : assetBasePaths_) {
         std::string fileName = packagePath_ + basePath + assetName;
-        std::FILE* fp = std::fopen(fileName.c_str(), "r");
-        if (fp == nullptr) {
-            continue;
-        }
-
-        if (std::fseek(fp, 0, SEEK_END) != 0) {
-            LOGE("seek file tail error");
-            std::fclose(fp);
-            continue;
-        }
-
-        int64_t size = std::ftell(fp);
-        uint8_t* dataArray = new (std::nothrow) uint8_t[size];
-        if (dataArray == nullptr) {
-            LOGE("new uint8_t array failed");
-            std::fclose(fp);
-            continue;
-        }
-
-        rewind(fp);
-        std::unique_ptr<uint8_t[]> data(dataArray);
-        size_t result = std::fread(data.get(), 1, size, fp);
-        if (result != (size_t)size) {
-            LOGE("read file failed");
-            std::fclose(fp);
+        auto file = MappedFile::Open(fileName);
+        if (!file) {
             continue;
         }
-
-        fclose(fp);
-        return std::make_unique<FileAssetMapping>(std::move(data), size);
+        return std::make_unique<FileAssetMapping>(file);
     }
     return nullptr;
 }
@@ -40,6 +40,7 @@
 #include "base/geometry/rect.h"
 #include "base/log/log.h"
 #include "base/log/ace_trace.h"
+#include "base/network/download_manager.h"
 #include "base/subwindow/subwindow_manager.h"
 #include "base/utils/system_properties.h"
 #include "core/common/ace_engine.h"
@@ -266,6 +267,7 @@ void UIContentImpl::CommonInitialize(OHOS::Rosen::Window* window, const std::str
         AceApplicationInfo::GetInstance().SetDataFileDirPath(context->GetFilesDir());
         CapabilityRegistry::Register();
         ImageCache::SetImageCacheFilePath(context->GetCacheDir());
+        DownloadManager::GetInstance().SetCacheDir(context->GetCacheDir() + "/.http");
         ImageCache::SetCacheFileInfo();
     });
 
@@ -539,14 +539,15 @@ void AceContainer::CallCurlFunction(const RequestData requestData, const int32_t
     }
 
     ContainerScope scope(instanceId_);
-    taskExecutor_->PostTask(
-        [container, requestData, callbackId]() mutable {
-            ResponseData responseData;
-            if (FetchManager::GetInstance().Fetch(requestData, callbackId, responseData)) {
-                container->FetchResponse(responseData, callbackId);
-            }
-        },
-        TaskExecutor::TaskType::BACKGROUND);
+    // The response is handed to the frontend off the network thread, which must not block.
+    FetchManager::GetInstance().Fetch(requestData,
+        [container, callbackId, taskExecutor = taskExecutor_](ResponseData&& responseData) {
+            taskExecutor->PostTask(
+                [container, callbackId, responseData = std::move(responseData)]() {
+                    container->FetchResponse(responseData, callbackId);
+                },
+                TaskExecutor::TaskType::BACKGROUND);
+        });
 }
 
 void AceContainer::DispatchPluginError(int32_t callbackId, int32_t errorCode, std::string&& errorMessage) const
@@ -15,24 +15,13 @@
 
 #include "adapter/preview/osal/fetch_manager.h"
 
-#include <memory>
-#include <mutex>
-
 #include "curl/curl.h"
 
 #include "adapter/preview/osal/http_constant.h"
 #include "base/log/log.h"
+#include "base/network/http_transfer_engine.h"
 #include "base/utils/singleton.h"
 
-#define ACE_CURL_EASY_SET_OPTION(handle, opt, data)                                                 \
-    do {                                                                                            \
-        CURLcode result = curl_easy_setopt(handle, opt, data);                                      \
-        if (result != CURLE_OK) {                                                                   \
-            LOGE("Failed to set option: %{public}s, %{public}s", #opt, curl_easy_strerror(result)); \
-            return false;                                                                           \
-        }                                                                                           \
-    } while (0)
-
 namespace OHOS::Ace {
 namespace {
 
@@ -41,88 +30,58 @@ class FetchManagerImpl final : public FetchManager, public Singleton<FetchManage
     ACE_DISALLOW_MOVE(FetchManagerImpl);
 
 public:
-    bool Fetch(const RequestData requestData, const int32_t callbackId, ResponseData& responseData) override
+    void Fetch(const RequestData& requestData, FetchCallback&& callback) override
     {
-        if (!Initialize()) {
-            return false;
-        }
-
-        std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> handle(curl_easy_init(), &curl_easy_cleanup);
-        if (!handle) {
-            LOGE("Failed to create fetch task");
-            return false;
-        }
-
-        struct curl_slist* header = nullptr;
-        if (!requestData.GetHeader().empty()) {
-            for (auto&& [key, value] : requestData.GetHeader()) {
-                header = curl_slist_append(header, (key + ":" + value).c_str());
-            }
-            ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_HTTPHEADER, header);
-        }
-
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_TIMEOUT_MS, HttpConstant::TIME_OUT);
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_CONNECTTIMEOUT_MS, HttpConstant::TIME_OUT);
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_BUFFERSIZE, HttpConstant::BUFFER_SIZE);
-
-        std::string responseBody;
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_WRITEFUNCTION, OnWritingMemoryBody);
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_WRITEDATA, &responseBody);
-
-        std::string responseHeader;
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_HEADERFUNCTION, OnWritingMemoryHeader);
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_HEADERDATA, &responseHeader);
-
-        // Some servers don't like requests that are made without a user-agent field, so we provide one
-        ACE_CURL_EASY_SET_OPTION(handle.get(), CURLOPT_USERAGENT, "libcurl-agent/1.0");
-
-        std::string method = requestData.GetMethod();
-        if (method.empty()) {
-            method = "GET";
+        HttpRequest request;
+        request.method = requestData.GetMethod();
+        if (request.method.empty()) {
+            request.method = HttpConstant::HTTP_METHOD_GET;
         }
+        const auto& method = request.method;
         if (method == HttpConstant::HTTP_METHOD_HEAD || method == HttpConstant::HTTP_METHOD_OPTIONS ||
             method == HttpConstant::HTTP_METHOD_DELETE || method == HttpConstant::HTTP_METHOD_TRACE ||
             method == HttpConstant::HTTP_METHOD_GET) {
-            SetOptionForGet(requestData, handle.get());
+            request.url = GetUrlForGet(requestData);
         } else if (method == HttpConstant::HTTP_METHOD_POST || method == HttpConstant::HTTP_METHOD_PUT) {
-            SetOptionForPost(requestData, handle.get());
+            request.url = requestData.GetUrl();
+            request.body = requestData.GetData();
         } else {
             LOGE("no method match!");
+            ResponseData responseData;
             responseData.SetCode(HttpConstant::ERROR);
-            responseData.SetData(responseBody);
-            return true;
-        }
-
-        CURLcode result = curl_easy_perform(handle.get());
-        if (result != CURLE_OK) {
-            LOGE("Failed to fetch, url: %{private}s, %{public}s", requestData.GetUrl().c_str(),
-                curl_easy_strerror(result));
-            responseData.SetCode(HttpConstant::ERROR);
-            responseData.SetData(responseBody);
-            return true;
+            responseData.SetData("");
+            callback(std::move(responseData));
+            return;
         }
-
-        char* ct = nullptr;
-        CURLcode res = curl_easy_getinfo(handle.get(), CURLINFO_CONTENT_TYPE, &ct);
-        if ((CURLE_OK == res) && ct) {
-            LOGD("fetch-preview content_type: %{public}s", ct);
+        for (auto&& [key, value] : requestData.GetHeader()) {
+            request.headers.emplace_back(key, value);
         }
-
-        int32_t responseCode = HttpConstant::ERROR;
-        curl_easy_getinfo(handle.get(), CURLINFO_RESPONSE_CODE, &responseCode);
-        responseData.SetCode(responseCode);
-        responseData.SetData(responseBody);
-        responseData.SetHeaders(responseHeader);
-
-        curl_slist_free_all(header);
-
-        return true;
+        request.timeoutMs = HttpConstant::TIME_OUT;
+        request.connectTimeoutMs = HttpConstant::TIME_OUT;
+
+        // The response is passed on from the network thread, nothing waits for the transfer.
+        HttpTransferEngine::GetInstance().Submit(std::move(request),
+            [url = requestData.GetUrl(), callback = std::move(callback)](HttpResponse&& response) {
+                ResponseData responseData;
+                std::string responseBody(response.body.begin(), response.body.end());
+                if (response.status != TransferStatus::SUCCESS) {
+                    LOGE("Failed to fetch, url: %{private}s, %{public}s", url.c_str(), response.error.c_str());
+                    responseData.SetCode(HttpConstant::ERROR);
+                    responseData.SetData(responseBody);
+                    callback(std::move(responseData));
+                    return;
+                }
+                responseData.SetCode(response.code);
+                responseData.SetData(responseBody);
+                responseData.SetHeaders(response.headers);
+                callback(std::move(responseData));
+            });
     }
 
-    bool SetOptionForGet(const RequestData requestData, CURL* curl) const
+    std::string GetUrlForGet(const RequestData& requestData) const
     {
         // refer to function buildConnectionWithParam() in HttpFetchImpl.java
-        LOGD("begin to set option for get and encode final url");
+        LOGD("begin to encode final url for get");
         std::string url = requestData.GetUrl();
         if (requestData.GetData() != "") {
             std::size_t index = url.find(HttpConstant::URL_PARAM_SEPARATOR);
@@ -130,13 +89,13 @@ public:
                 std::string param = url.substr(index + 1);
 
                 std::string encodeIn = param + HttpConstant::URL_PARAM_DELIMITER + requestData.GetData();
-                char* encodeOut = curl_easy_escape(curl, encodeIn.c_str(), 0);
+                char* encodeOut = curl_easy_escape(nullptr, encodeIn.c_str(), 0);
                 if (encodeOut != nullptr) {
                     url = url.substr(0, index + 1) + encodeOut;
                     curl_free(encodeOut);
                 }
             } else {
-                char* encodeOut = curl_easy_escape(curl, requestData.GetData().c_str(), 0);
+                char* encodeOut = curl_easy_escape(nullptr, requestData.GetData().c_str(), 0);
                 if (encodeOut != nullptr) {
                     url = url + HttpConstant::URL_PARAM_SEPARATOR + encodeOut;
                     curl_free(encodeOut);
@@ -144,61 +103,13 @@ public:
             }
         }
         LOGD("final url : %{public}s", url.c_str());
-        ACE_CURL_EASY_SET_OPTION(curl, CURLOPT_URL, url.c_str());
-        return true;
+        return url;
     }
-
-    bool SetOptionForPost(const RequestData requestData, CURL* curl) const
-    {
-        // refer to function buildConnectionWithStream() in HttpFetchImpl.java
-        LOGD("begin to set option for post");
-        std::string url = requestData.GetUrl();
-        LOGD("final url : %{public}s", url.c_str());
-        ACE_CURL_EASY_SET_OPTION(curl, CURLOPT_URL, url.c_str());
-        ACE_CURL_EASY_SET_OPTION(curl, CURLOPT_POSTFIELDS, requestData.GetData().c_str());
-        return true;
-    }
-
-private:
-    static size_t OnWritingMemoryBody(const void* data, size_t size, size_t memBytes, void* userData)
-    {
-        ((std::string*)userData)->append((char*)data, 0, size * memBytes);
-        return size * memBytes;
-    }
-    static size_t OnWritingMemoryHeader(const void* data, size_t size, size_t memBytes, void* userData)
-    {
-        ((std::string*)userData)->append((char*)data, 0, size * memBytes);
-        return size * memBytes;
-    }
-
-    bool Initialize()
-    {
-        if (initialized_) {
-            return true;
-        }
-
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (initialized_) {
-            return true;
-        }
-        if (curl_global_init(CURL_GLOBAL_ALL) != CURLE_OK) {
-            LOGE("Failed to initialize 'curl'");
-            return false;
-        }
-        initialized_ = true;
-        return true;
-    }
-
-    std::mutex mutex_;
-    bool initialized_ = false;
 };
 
 FetchManagerImpl::FetchManagerImpl() = default;
 
-FetchManagerImpl::~FetchManagerImpl()
-{
-    curl_global_cleanup();
-}
+FetchManagerImpl::~FetchManagerImpl() = default;
 
 } // namespace
 
@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_ADAPTER_PREVIEW_FETCH_MANAGER_H
 
 #include <cstdint>
+#include <functional>
 #include <string>
 
 #include "adapter/preview/osal/request_data.h"
@@ -28,8 +29,12 @@ class FetchManager {
 public:
     static FetchManager& GetInstance();
 
+    // Called with the response once the fetch completes, on a network thread or on the thread calling Fetch.
+    using FetchCallback = std::function<void(ResponseData&& responseData)>;
+
     virtual ~FetchManager() = default;
-    virtual bool Fetch(const RequestData requestData, const int32_t callbackId, ResponseData& responseData) = 0;
+    // Starts the fetch without waiting for its response.
+    virtual void Fetch(const RequestData& requestData, FetchCallback&& callback) = 0;
 };
 
 } // namespace OHOS::Ace
@@ -33,6 +33,7 @@
 #include "unicode/uclean.h"
 #include "unicode/udata.h"
 
+#include "base/json/json_document.h"
 #include "base/json/json_util.h"
 #include "base/log/log.h"
 #include "base/resource/internal_resource.h"
@@ -152,37 +153,124 @@ MeasureUnit* GetMeasureUnit(TimeUnitStyle timeUnitStyle, UErrorCode& status)
     }
 }
 
-void GetLocalJsonObject(InternalResource::ResourceId id, std::string language, std::unique_ptr<JsonValue>& indexJson,
-    std::unique_ptr<JsonValue>& json)
+JsonNode GetLocalJsonObject(
+    InternalResource::ResourceId id, const std::string& language, std::unique_ptr<JsonDocument>& indexJson)
 {
     if (indexJson == nullptr) {
         size_t size = 0;
         const uint8_t* buf = InternalResource::GetInstance().GetResource(id, size);
         if (buf == nullptr) {
-            return;
+            return JsonNode();
         }
 
-        std::string jsonStr(reinterpret_cast<const char*>(buf), size);
-        const char* endMsg = nullptr;
-        indexJson = JsonUtil::ParseJsonString(jsonStr, &endMsg);
-        if (indexJson == nullptr) {
-            LOGE("read indexletter json failed. reason: %{private}s.", endMsg);
-            return;
+        indexJson = JsonUtil::ParseJsonDocument(std::string(reinterpret_cast<const char*>(buf), size));
+        if (!indexJson->IsValid()) {
+            LOGE("read indexletter json failed at %{public}zu.", indexJson->GetErrorOffset());
+            return JsonNode();
         }
     }
 
-    if (indexJson->Contains(language) && indexJson->GetValue(language)->IsObject()) {
-        json = indexJson->GetValue(language);
-    } else if (indexJson->Contains(DEFAULT_LANGUAGE) && indexJson->GetValue(DEFAULT_LANGUAGE)->IsObject()) {
-        json = indexJson->GetValue(DEFAULT_LANGUAGE);
+    auto root = indexJson->GetRoot();
+    if (root.GetValue(language).IsObject()) {
+        return root.GetValue(language);
     }
+    if (root.GetValue(DEFAULT_LANGUAGE).IsObject()) {
+        return root.GetValue(DEFAULT_LANGUAGE);
+    }
+    return JsonNode();
 }
 
+// Picks the letters of one language, and of the default language in case it is missing, from indexletter_bar.json
+// in one pass, eg: { "default": { "alphabet": [ "A", ... ], "index": [ ... ] }, "ko": { ... } }.
+class IndexLetterHandler final : public JsonHandler {
+public:
+    IndexLetterHandler(const std::string& language, const std::string& letterType)
+        : language_(language), letterType_(letterType)
+    {}
+    ~IndexLetterHandler() override = default;
+
+    bool OnKey(std::string_view key) override
+    {
+        if (depth_ == LANGUAGE_DEPTH) {
+            letterSet_ = (key == language_) ? LANGUAGE_SET : ((key == DEFAULT_LETTER_SET) ? DEFAULT_SET : NO_SET);
+        } else if (depth_ == LETTER_TYPE_DEPTH) {
+            isLetterType_ = (key == letterType_);
+        }
+        return true;
+    }
+
+    bool OnStartObject() override
+    {
+        if (depth_ == LANGUAGE_DEPTH && letterSet_ == LANGUAGE_SET) {
+            hasLanguage_ = true;
+        }
+        ++depth_;
+        return true;
+    }
+
+    bool OnEndObject() override
+    {
+        --depth_;
+        return true;
+    }
+
+    bool OnStartArray() override
+    {
+        if (depth_ == LETTER_TYPE_DEPTH && isLetterType_ && letterSet_ != NO_SET) {
+            hasLetters_[letterSet_] = true;
+            collecting_ = &letters_[letterSet_];
+        }
+        ++depth_;
+        return true;
+    }
+
+    bool OnEndArray() override
+    {
+        --depth_;
+        collecting_ = nullptr;
+        return true;
+    }
+
+    bool OnString(std::string_view value) override
+    {
+        if (collecting_ != nullptr && depth_ == LETTER_TYPE_DEPTH + 1) {
+            collecting_->emplace_back(StringUtils::Str8ToStr16(std::string(value)));
+        }
+        return true;
+    }
+
+    bool GetLetters(std::vector<std::u16string>& letters)
+    {
+        auto letterSet = hasLanguage_ ? LANGUAGE_SET : DEFAULT_SET;
+        if (!hasLetters_[letterSet]) {
+            return false;
+        }
+        letters = std::move(letters_[letterSet]);
+        return true;
+    }
+
+private:
+    static constexpr int32_t LANGUAGE_DEPTH = 1;
+    static constexpr int32_t LETTER_TYPE_DEPTH = 2;
+    static constexpr const char* DEFAULT_LETTER_SET = "default";
+    enum LetterSet { LANGUAGE_SET = 0, DEFAULT_SET, NO_SET };
+
+    const std::string& language_;
+    const std::string& letterType_;
+    int32_t depth_ = 0;
+    LetterSet letterSet_ = NO_SET;
+    bool isLetterType_ = false;
+    bool hasLanguage_ = false;
+    bool hasLetters_[NO_SET] = { false, false };
+    std::vector<std::u16string> letters_[NO_SET];
+    std::vector<std::u16string>* collecting_ = nullptr;
+};
+
 } // namespace
 
 // for entry.json
-static std::unique_ptr<JsonValue> g_indexJsonEntry = nullptr;
-static std::unique_ptr<JsonValue> g_indexJsonError = nullptr;
+static std::unique_ptr<JsonDocument> g_indexJsonEntry = nullptr;
+static std::unique_ptr<JsonDocument> g_indexJsonError = nullptr;
 
 Localization::~Localization() = default;
 
@@ -686,14 +774,6 @@ std::vector<std::u16string> Localization::GetLetters(bool alphabet)
         return letters;
     }
 
-    std::string jsonStr(reinterpret_cast<const char*>(buf), size);
-    const char* endMsg = nullptr;
-    auto indexLetterJson = JsonUtil::ParseJsonString(jsonStr, &endMsg);
-    if (indexLetterJson == nullptr) {
-        LOGE("read indexletter json failed. reason: %{private}s.", endMsg);
-        return letters;
-    }
-
     std::string language = locale_->instance.getLanguage();
     if (language == "zh") {
         language = language + "-" + std::string(locale_->instance.getCountry());
@@ -703,25 +783,14 @@ std::vector<std::u16string> Localization::GetLetters(bool alphabet)
         language = iter->second;
     }
     LOGI("[alphabet] Localization::GetLetters. language: %{private}s", language.c_str());
-    std::unique_ptr<JsonValue> lettersSet;
-    if (!indexLetterJson->Contains(language) || !indexLetterJson->GetValue(language)->IsObject()) {
-        lettersSet = indexLetterJson->GetValue("default");
-    } else {
-        lettersSet = indexLetterJson->GetValue(language);
-    }
-
     std::string letterType = alphabet ? "alphabet" : "index";
-    std::unique_ptr<JsonValue> lettersArray;
-    if (!lettersSet->Contains(letterType) || !lettersSet->GetValue(letterType)->IsArray()) {
-        LOGE("read letter array failed. Invalid type. %s", letterType.c_str());
+    IndexLetterHandler handler(language, letterType);
+    if (!JsonUtil::ParseJsonStream(std::string_view(reinterpret_cast<const char*>(buf), size), handler)) {
+        LOGE("read indexletter json failed.");
         return letters;
-    } else {
-        lettersArray = lettersSet->GetValue(letterType)->GetChild();
     }
-
-    while (lettersArray->IsValid()) {
-        letters.push_back(StringUtils::Str8ToStr16(lettersArray->GetString()));
-        lettersArray = lettersArray->GetNext();
+    if (!handler.GetLetters(letters)) {
+        LOGE("read letter array failed. Invalid type. %s", letterType.c_str());
     }
     return letters;
 }
@@ -743,14 +812,13 @@ std::string Localization::GetEntryLetters(const std::string& lettersIndex)
         return "";
     }
 
-    std::unique_ptr<JsonValue> localJsonEntry;
     auto language = selectLanguage_;
     auto iter = LANGUAGE_CODE_MAP.find(language);
     if (iter != LANGUAGE_CODE_MAP.end()) {
         language = iter->second;
     }
-    GetLocalJsonObject(InternalResource::ResourceId::ENTRY_JSON, language, g_indexJsonEntry, localJsonEntry);
-    if (localJsonEntry == nullptr) {
+    auto localJsonEntry = GetLocalJsonObject(InternalResource::ResourceId::ENTRY_JSON, language, g_indexJsonEntry);
+    if (!localJsonEntry.IsValid()) {
         LOGE("read JsonObject fail. language: %{public}s.", selectLanguage_.c_str());
         return "";
     }
@@ -759,19 +827,14 @@ std::string Localization::GetEntryLetters(const std::string& lettersIndex)
     StringUtils::StringSpliter(lettersIndex, JSON_PATH_CARVE, jsonLetterIndex);
 
     for (const auto& letter : jsonLetterIndex) {
-        if (localJsonEntry && localJsonEntry->Contains(letter)) {
-            localJsonEntry = localJsonEntry->GetValue(letter);
-        } else {
+        localJsonEntry = localJsonEntry.GetValue(letter);
+        if (!localJsonEntry.IsValid()) {
             LOGE("read entry json failed.");
             return "";
         }
     }
 
-    if (localJsonEntry->IsString()) {
-        return localJsonEntry->GetString();
-    }
-
-    return "";
+    return localJsonEntry.GetString();
 }
 
 std::string Localization::GetErrorDescription(const std::string& errorIndex)
@@ -781,30 +844,24 @@ std::string Localization::GetErrorDescription(const std::string& errorIndex)
         return "";
     }
 
-    std::unique_ptr<JsonValue> localJsonError;
     auto language = selectLanguage_;
     auto iter = LANGUAGE_CODE_MAP.find(language);
     if (iter != LANGUAGE_CODE_MAP.end()) {
         language = iter->second;
     }
-    GetLocalJsonObject(InternalResource::ResourceId::ERRORINFO_JSON, language, g_indexJsonError, localJsonError);
-    if (localJsonError == nullptr) {
+    auto localJsonError = GetLocalJsonObject(InternalResource::ResourceId::ERRORINFO_JSON, language, g_indexJsonError);
+    if (!localJsonError.IsValid()) {
         LOGE("read JsonObject fail. language: %{public}s.", selectLanguage_.c_str());
         return "";
     }
 
-    if (localJsonError->Contains(errorIndex)) {
-        localJsonError = localJsonError->GetValue(errorIndex);
-    } else {
+    auto errorJson = localJsonError.GetValue(errorIndex);
+    if (!errorJson.IsValid()) {
         LOGE("read error json failed. error path: %{private}s.", errorIndex.c_str());
         return "";
     }
 
-    if (localJsonError->IsString()) {
-        return localJsonError->GetString();
-    }
-
-    return "";
+    return errorJson.GetString();
 }
 
 const std::vector<std::string>& Localization::GetLanguageList(const std::string& language)
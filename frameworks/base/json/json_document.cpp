@@ -0,0 +1,717 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/json/json_document.h"
+
+#include <cstdlib>
+#include <limits>
+
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// Same as the nesting limit of cJSON.
+constexpr int32_t MAX_DEPTH = 1000;
+// Objects with fewer members are scanned, comparing key ids is cheaper than hashing.
+constexpr uint32_t HASHED_MEMBER_COUNT = 8;
+constexpr size_t MAX_NUMBER_LENGTH = 64;
+constexpr uint32_t UNICODE_HEX_LENGTH = 4;
+constexpr uint32_t HIGH_SURROGATE_BEGIN = 0xD800;
+constexpr uint32_t LOW_SURROGATE_BEGIN = 0xDC00;
+constexpr uint32_t LOW_SURROGATE_END = 0xDFFF;
+constexpr uint32_t SURROGATE_BASE = 0x10000;
+constexpr uint32_t SURROGATE_SHIFT = 10;
+// Roughly one node for every few characters of usual json, to avoid growing the node array many times.
+constexpr size_t CHARACTERS_PER_NODE = 16;
+
+bool IsWhiteSpace(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+int32_t HexValue(char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+void AppendUtf8(uint32_t codePoint, std::string& result)
+{
+    if (codePoint < 0x80) {
+        result.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        result.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        result.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        result.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        result.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+// Recursive descent parser calling a JsonHandler, shared by streaming parsing and JsonDocument.
+class JsonParser final {
+public:
+    JsonParser(std::string_view content, JsonHandler& handler) : content_(content), handler_(handler) {}
+    ~JsonParser() = default;
+
+    bool Parse()
+    {
+        SkipWhiteSpaces();
+        if (!ParseValue(0)) {
+            return false;
+        }
+        SkipWhiteSpaces();
+        return pos_ == content_.size();
+    }
+
+    size_t GetPosition() const
+    {
+        return pos_;
+    }
+
+private:
+    void SkipWhiteSpaces()
+    {
+        while (pos_ < content_.size() && IsWhiteSpace(content_[pos_])) {
+            ++pos_;
+        }
+    }
+
+    bool Consume(char ch)
+    {
+        if (pos_ < content_.size() && content_[pos_] == ch) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeLiteral(std::string_view literal)
+    {
+        if (content_.compare(pos_, literal.size(), literal) != 0) {
+            return false;
+        }
+        pos_ += literal.size();
+        return true;
+    }
+
+    bool ParseValue(int32_t depth)
+    {
+        if (pos_ >= content_.size()) {
+            return false;
+        }
+        switch (content_[pos_]) {
+            case '{':
+                return ParseObject(depth + 1);
+            case '[':
+                return ParseArray(depth + 1);
+            case '"': {
+                std::string_view value;
+                return ParseString(value) && handler_.OnString(value);
+            }
+            case 't':
+                return ConsumeLiteral("true") && handler_.OnBool(true);
+            case 'f':
+                return ConsumeLiteral("false") && handler_.OnBool(false);
+            case 'n':
+                return ConsumeLiteral("null") && handler_.OnNull();
+            default:
+                return ParseNumber();
+        }
+    }
+
+    bool ParseObject(int32_t depth)
+    {
+        if (depth > MAX_DEPTH) {
+            LOGE("json is nested too deep");
+            return false;
+        }
+        ++pos_;
+        if (!handler_.OnStartObject()) {
+            return false;
+        }
+        SkipWhiteSpaces();
+        if (Consume('}')) {
+            return handler_.OnEndObject();
+        }
+        while (true) {
+            SkipWhiteSpaces();
+            std::string_view key;
+            if (pos_ >= content_.size() || content_[pos_] != '"' || !ParseString(key) || !handler_.OnKey(key)) {
+                return false;
+            }
+            SkipWhiteSpaces();
+            if (!Consume(':')) {
+                return false;
+            }
+            SkipWhiteSpaces();
+            if (!ParseValue(depth)) {
+                return false;
+            }
+            SkipWhiteSpaces();
+            if (Consume('}')) {
+                return handler_.OnEndObject();
+            }
+            if (!Consume(',')) {
+                return false;
+            }
+        }
+    }
+
+    bool ParseArray(int32_t depth)
+    {
+        if (depth > MAX_DEPTH) {
+            LOGE("json is nested too deep");
+            return false;
+        }
+        ++pos_;
+        if (!handler_.OnStartArray()) {
+            return false;
+        }
+        SkipWhiteSpaces();
+        if (Consume(']')) {
+            return handler_.OnEndArray();
+        }
+        while (true) {
+            SkipWhiteSpaces();
+            if (!ParseValue(depth)) {
+                return false;
+            }
+            SkipWhiteSpaces();
+            if (Consume(']')) {
+                return handler_.OnEndArray();
+            }
+            if (!Consume(',')) {
+                return false;
+            }
+        }
+    }
+
+    // The value points into the content unless the string has escapes.
+    bool ParseString(std::string_view& value)
+    {
+        ++pos_;
+        auto begin = pos_;
+        while (pos_ < content_.size() && content_[pos_] != '"' && content_[pos_] != '\\') {
+            ++pos_;
+        }
+        if (pos_ >= content_.size()) {
+            return false;
+        }
+        if (content_[pos_] == '"') {
+            value = content_.substr(begin, pos_ - begin);
+            ++pos_;
+            return true;
+        }
+        decoded_.assign(content_.data() + begin, pos_ - begin);
+        while (pos_ < content_.size() && content_[pos_] != '"') {
+            if (content_[pos_] != '\\') {
+                decoded_.push_back(content_[pos_++]);
+                continue;
+            }
+            if (!ParseEscape()) {
+                return false;
+            }
+        }
+        if (pos_ >= content_.size()) {
+            return false;
+        }
+        ++pos_;
+        value = decoded_;
+        return true;
+    }
+
+    bool ParseEscape()
+    {
+        ++pos_;
+        if (pos_ >= content_.size()) {
+            return false;
+        }
+        char ch = content_[pos_++];
+        switch (ch) {
+            case '"':
+            case '\\':
+            case '/':
+                decoded_.push_back(ch);
+                return true;
+            case 'b':
+                decoded_.push_back('\b');
+                return true;
+            case 'f':
+                decoded_.push_back('\f');
+                return true;
+            case 'n':
+                decoded_.push_back('\n');
+                return true;
+            case 'r':
+                decoded_.push_back('\r');
+                return true;
+            case 't':
+                decoded_.push_back('\t');
+                return true;
+            case 'u':
+                return ParseUnicode();
+            default:
+                return false;
+        }
+    }
+
+    bool ParseHex(uint32_t& value)
+    {
+        if (pos_ + UNICODE_HEX_LENGTH > content_.size()) {
+            return false;
+        }
+        value = 0;
+        for (uint32_t i = 0; i < UNICODE_HEX_LENGTH; ++i) {
+            auto digit = HexValue(content_[pos_++]);
+            if (digit < 0) {
+                return false;
+            }
+            value = (value << 4) | static_cast<uint32_t>(digit);
+        }
+        return true;
+    }
+
+    bool ParseUnicode()
+    {
+        uint32_t codePoint = 0;
+        if (!ParseHex(codePoint)) {
+            return false;
+        }
+        if (codePoint >= LOW_SURROGATE_BEGIN && codePoint <= LOW_SURROGATE_END) {
+            return false;
+        }
+        if (codePoint >= HIGH_SURROGATE_BEGIN && codePoint < LOW_SURROGATE_BEGIN) {
+            // a high surrogate must be followed by a low one.
+            uint32_t lowSurrogate = 0;
+            if (!ConsumeLiteral("\\u") || !ParseHex(lowSurrogate) || lowSurrogate < LOW_SURROGATE_BEGIN ||
+                lowSurrogate > LOW_SURROGATE_END) {
+                return false;
+            }
+            codePoint = SURROGATE_BASE + ((codePoint - HIGH_SURROGATE_BEGIN) << SURROGATE_SHIFT) +
+                        (lowSurrogate - LOW_SURROGATE_BEGIN);
+        }
+        AppendUtf8(codePoint, decoded_);
+        return true;
+    }
+
+    bool ConsumeDigits()
+    {
+        auto begin = pos_;
+        while (pos_ < content_.size() && content_[pos_] >= '0' && content_[pos_] <= '9') {
+            ++pos_;
+        }
+        return pos_ > begin;
+    }
+
+    // Checks the json grammar before strtod, which also takes forms like "+1", ".5", "1." or "0x1".
+    bool ParseNumber()
+    {
+        auto begin = pos_;
+        Consume('-');
+        if (!Consume('0') && !ConsumeDigits()) {
+            return false;
+        }
+        if (Consume('.') && !ConsumeDigits()) {
+            return false;
+        }
+        if (Consume('e') || Consume('E')) {
+            if (!Consume('-')) {
+                Consume('+');
+            }
+            if (!ConsumeDigits()) {
+                return false;
+            }
+        }
+        auto length = pos_ - begin;
+        if (length >= MAX_NUMBER_LENGTH) {
+            return false;
+        }
+        // the content may not end with '\0', strtod needs a terminated copy.
+        char number[MAX_NUMBER_LENGTH] = { 0 };
+        content_.copy(number, length, begin);
+        char* end = nullptr;
+        double value = std::strtod(number, &end);
+        if (end != number + length) {
+            return false;
+        }
+        return handler_.OnNumber(value);
+    }
+
+    std::string_view content_;
+    JsonHandler& handler_;
+    size_t pos_ = 0;
+    std::string decoded_;
+};
+
+} // namespace
+
+// Appends the nodes of a parsed text to a JsonDocument.
+class JsonDocumentBuilder final : public JsonHandler {
+public:
+    explicit JsonDocumentBuilder(JsonDocument& document) : document_(document) {}
+    ~JsonDocumentBuilder() override = default;
+
+    bool OnNull() override
+    {
+        AddNode(JsonType::NULL_VALUE);
+        return true;
+    }
+
+    bool OnBool(bool value) override
+    {
+        document_.nodes_[AddNode(JsonType::BOOL)].boolValue = value;
+        return true;
+    }
+
+    bool OnNumber(double value) override
+    {
+        document_.nodes_[AddNode(JsonType::NUMBER)].number = value;
+        return true;
+    }
+
+    bool OnString(std::string_view value) override
+    {
+        auto string = document_.KeepString(value);
+        document_.nodes_[AddNode(JsonType::STRING)].string = string;
+        return true;
+    }
+
+    bool OnKey(std::string_view key) override
+    {
+        key_ = document_.InternKey(key);
+        return true;
+    }
+
+    bool OnStartObject() override
+    {
+        OpenContainer(JsonType::OBJECT);
+        return true;
+    }
+
+    bool OnEndObject() override
+    {
+        CloseContainer();
+        return true;
+    }
+
+    bool OnStartArray() override
+    {
+        OpenContainer(JsonType::ARRAY);
+        return true;
+    }
+
+    bool OnEndArray() override
+    {
+        CloseContainer();
+        return true;
+    }
+
+private:
+    uint32_t AddNode(JsonType type)
+    {
+        auto index = static_cast<uint32_t>(document_.nodes_.size());
+        auto& node = document_.nodes_.emplace_back();
+        node.type = type;
+        node.key = key_;
+        key_ = JsonDocument::INVALID_INDEX;
+        if (!containers_.empty()) {
+            pendingChildren_.emplace_back(index);
+        }
+        return index;
+    }
+
+    void OpenContainer(JsonType type)
+    {
+        auto index = AddNode(type);
+        containers_.emplace_back(index, pendingChildren_.size());
+    }
+
+    // Children of a container are only known once it is closed, they are moved to one range of children_ then.
+    void CloseContainer()
+    {
+        auto [index, pendingBegin] = containers_.back();
+        containers_.pop_back();
+        auto& children = document_.children_;
+        auto childBegin = static_cast<uint32_t>(children.size());
+        children.insert(children.end(), pendingChildren_.begin() + pendingBegin, pendingChildren_.end());
+        pendingChildren_.resize(pendingBegin);
+
+        auto& container = document_.nodes_[index];
+        container.childBegin = childBegin;
+        container.childCount = static_cast<uint32_t>(children.size()) - childBegin;
+        for (uint32_t i = childBegin; i + 1 < children.size(); ++i) {
+            document_.nodes_[children[i]].next = children[i + 1];
+        }
+        if (container.type != JsonType::OBJECT || container.childCount < HASHED_MEMBER_COUNT) {
+            return;
+        }
+        for (uint32_t i = childBegin; i < children.size(); ++i) {
+            auto child = children[i];
+            auto memberKey = (static_cast<uint64_t>(index) << 32) | document_.nodes_[child].key;
+            document_.members_.emplace(memberKey, child);
+        }
+    }
+
+    JsonDocument& document_;
+    uint32_t key_ = JsonDocument::INVALID_INDEX;
+    // (container index, begin of its children in pendingChildren_) of open containers.
+    std::vector<std::pair<uint32_t, size_t>> containers_;
+    std::vector<uint32_t> pendingChildren_;
+};
+
+bool JsonDocument::Parse(std::string_view content, JsonHandler& handler, size_t* errorOffset)
+{
+    JsonParser parser(content, handler);
+    if (parser.Parse()) {
+        return true;
+    }
+    if (errorOffset != nullptr) {
+        *errorOffset = parser.GetPosition();
+    }
+    return false;
+}
+
+bool JsonDocument::Parse(std::string&& content)
+{
+    Clear();
+    content_ = std::move(content);
+    nodes_.reserve(content_.size() / CHARACTERS_PER_NODE + 1);
+    JsonDocumentBuilder builder(*this);
+    size_t errorOffset = 0;
+    if (!Parse(content_, builder, &errorOffset)) {
+        LOGE("parse json failed at %{public}zu", errorOffset);
+        Clear();
+        errorOffset_ = errorOffset;
+        return false;
+    }
+    return true;
+}
+
+void JsonDocument::Clear()
+{
+    content_.clear();
+    nodes_.clear();
+    children_.clear();
+    decodedStrings_.clear();
+    keys_.clear();
+    keyIds_.clear();
+    members_.clear();
+    errorOffset_ = 0;
+}
+
+std::string_view JsonDocument::KeepString(std::string_view value)
+{
+    // strings without escapes are already in the content.
+    if (value.data() >= content_.data() && value.data() + value.size() <= content_.data() + content_.size()) {
+        return value;
+    }
+    return decodedStrings_.emplace_back(value);
+}
+
+uint32_t JsonDocument::InternKey(std::string_view key)
+{
+    auto iter = keyIds_.find(key);
+    if (iter != keyIds_.end()) {
+        return iter->second;
+    }
+    auto id = static_cast<uint32_t>(keys_.size());
+    auto keptKey = KeepString(key);
+    keys_.emplace_back(keptKey);
+    keyIds_.emplace(keptKey, id);
+    return id;
+}
+
+uint32_t JsonDocument::FindMember(uint32_t object, std::string_view key) const
+{
+    const auto* node = GetNode(object);
+    if (node == nullptr || node->type != JsonType::OBJECT) {
+        return INVALID_INDEX;
+    }
+    auto keyIter = keyIds_.find(key);
+    if (keyIter == keyIds_.end()) {
+        return INVALID_INDEX;
+    }
+    auto keyId = keyIter->second;
+    if (node->childCount >= HASHED_MEMBER_COUNT) {
+        auto iter = members_.find((static_cast<uint64_t>(object) << 32) | keyId);
+        return iter == members_.end() ? INVALID_INDEX : iter->second;
+    }
+    for (uint32_t i = node->childBegin; i < node->childBegin + node->childCount; ++i) {
+        if (nodes_[children_[i]].key == keyId) {
+            return children_[i];
+        }
+    }
+    return INVALID_INDEX;
+}
+
+JsonType JsonNode::GetType() const
+{
+    const auto* node = document_ ? document_->GetNode(index_) : nullptr;
+    return node ? node->type : JsonType::INVALID;
+}
+
+bool JsonNode::GetBool(bool defaultValue) const
+{
+    return IsBool() ? document_->nodes_[index_].boolValue : defaultValue;
+}
+
+int32_t JsonNode::GetInt(int32_t defaultValue) const
+{
+    if (!IsNumber()) {
+        return defaultValue;
+    }
+    auto value = document_->nodes_[index_].number;
+    // saturates like cJSON.
+    if (value >= std::numeric_limits<int32_t>::max()) {
+        return std::numeric_limits<int32_t>::max();
+    }
+    if (value <= std::numeric_limits<int32_t>::min()) {
+        return std::numeric_limits<int32_t>::min();
+    }
+    return static_cast<int32_t>(value);
+}
+
+uint32_t JsonNode::GetUInt(uint32_t defaultValue) const
+{
+    if (!IsNumber()) {
+        return defaultValue;
+    }
+    auto value = document_->nodes_[index_].number;
+    if (value >= std::numeric_limits<uint32_t>::max()) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return value <= 0.0 ? 0 : static_cast<uint32_t>(value);
+}
+
+int64_t JsonNode::GetInt64(int64_t defaultValue) const
+{
+    if (!IsNumber()) {
+        return defaultValue;
+    }
+    auto value = document_->nodes_[index_].number;
+    // 2^63 is exactly representable, compare with it instead of INT64_MAX which is not.
+    if (value >= static_cast<double>(std::numeric_limits<int64_t>::max())) {
+        return std::numeric_limits<int64_t>::max();
+    }
+    if (value <= static_cast<double>(std::numeric_limits<int64_t>::min())) {
+        return std::numeric_limits<int64_t>::min();
+    }
+    return static_cast<int64_t>(value);
+}
+
+double JsonNode::GetDouble(double defaultValue) const
+{
+    return IsNumber() ? document_->nodes_[index_].number : defaultValue;
+}
+
+std::string_view JsonNode::GetStringView() const
+{
+    return IsString() ? document_->nodes_[index_].string : std::string_view();
+}
+
+std::string JsonNode::GetString(const std::string& defaultValue) const
+{
+    return IsString() ? std::string(document_->nodes_[index_].string) : defaultValue;
+}
+
+std::string_view JsonNode::GetKey() const
+{
+    if (!IsValid()) {
+        return std::string_view();
+    }
+    auto key = document_->nodes_[index_].key;
+    return key < document_->keys_.size() ? document_->keys_[key] : std::string_view();
+}
+
+bool JsonNode::Contains(std::string_view key) const
+{
+    return document_ && document_->FindMember(index_, key) != JsonDocument::INVALID_INDEX;
+}
+
+JsonNode JsonNode::GetValue(std::string_view key) const
+{
+    if (!document_) {
+        return JsonNode();
+    }
+    return JsonNode(document_, document_->FindMember(index_, key));
+}
+
+bool JsonNode::GetBool(std::string_view key, bool defaultValue) const
+{
+    return GetValue(key).GetBool(defaultValue);
+}
+
+int32_t JsonNode::GetInt(std::string_view key, int32_t defaultValue) const
+{
+    return GetValue(key).GetInt(defaultValue);
+}
+
+double JsonNode::GetDouble(std::string_view key, double defaultValue) const
+{
+    return GetValue(key).GetDouble(defaultValue);
+}
+
+std::string JsonNode::GetString(std::string_view key, const std::string& defaultValue) const
+{
+    return GetValue(key).GetString(defaultValue);
+}
+
+int32_t JsonNode::GetArraySize() const
+{
+    if (!IsArray() && !IsObject()) {
+        return 0;
+    }
+    return static_cast<int32_t>(document_->nodes_[index_].childCount);
+}
+
+JsonNode JsonNode::GetArrayItem(int32_t index) const
+{
+    if (index < 0 || index >= GetArraySize()) {
+        return JsonNode();
+    }
+    const auto& node = document_->nodes_[index_];
+    return JsonNode(document_, document_->children_[node.childBegin + static_cast<uint32_t>(index)]);
+}
+
+JsonNode JsonNode::GetChild() const
+{
+    return GetArrayItem(0);
+}
+
+JsonNode JsonNode::GetNext() const
+{
+    if (!IsValid()) {
+        return JsonNode();
+    }
+    return JsonNode(document_, document_->nodes_[index_].next);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_DOCUMENT_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_DOCUMENT_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+enum class JsonType : uint8_t {
+    INVALID = 0,
+    NULL_VALUE,
+    BOOL,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT,
+};
+
+// Receives the values of a json text in order while it is parsed, without building any tree.
+// Strings and keys are only valid during the call. Returning false stops parsing, which then fails.
+class ACE_EXPORT JsonHandler {
+public:
+    virtual ~JsonHandler() = default;
+
+    virtual bool OnNull()
+    {
+        return true;
+    }
+    virtual bool OnBool(bool value)
+    {
+        return true;
+    }
+    virtual bool OnNumber(double value)
+    {
+        return true;
+    }
+    virtual bool OnString(std::string_view value)
+    {
+        return true;
+    }
+    // Called before the value of every member of an object.
+    virtual bool OnKey(std::string_view key)
+    {
+        return true;
+    }
+    virtual bool OnStartObject()
+    {
+        return true;
+    }
+    virtual bool OnEndObject()
+    {
+        return true;
+    }
+    virtual bool OnStartArray()
+    {
+        return true;
+    }
+    virtual bool OnEndArray()
+    {
+        return true;
+    }
+};
+
+class JsonDocument;
+
+// A value in a JsonDocument. It is a plain handle, cheap to copy and valid as long as the document is alive.
+// Getters of an invalid node or of a node of another type return the default value.
+class ACE_EXPORT JsonNode final {
+public:
+    JsonNode() = default;
+    ~JsonNode() = default;
+
+    JsonType GetType() const;
+    bool IsValid() const
+    {
+        return GetType() != JsonType::INVALID;
+    }
+    bool IsNull() const
+    {
+        return GetType() == JsonType::NULL_VALUE;
+    }
+    bool IsBool() const
+    {
+        return GetType() == JsonType::BOOL;
+    }
+    bool IsNumber() const
+    {
+        return GetType() == JsonType::NUMBER;
+    }
+    bool IsString() const
+    {
+        return GetType() == JsonType::STRING;
+    }
+    bool IsArray() const
+    {
+        return GetType() == JsonType::ARRAY;
+    }
+    bool IsObject() const
+    {
+        return GetType() == JsonType::OBJECT;
+    }
+
+    bool GetBool(bool defaultValue = false) const;
+    int32_t GetInt(int32_t defaultValue = 0) const;
+    uint32_t GetUInt(uint32_t defaultValue = 0) const;
+    int64_t GetInt64(int64_t defaultValue = 0) const;
+    double GetDouble(double defaultValue = 0.0) const;
+    // The view points into the document.
+    std::string_view GetStringView() const;
+    std::string GetString(const std::string& defaultValue = "") const;
+
+    // Key of a member of an object, empty for other nodes.
+    std::string_view GetKey() const;
+    // Keys are case sensitive, the first member is found if a key is repeated.
+    bool Contains(std::string_view key) const;
+    JsonNode GetValue(std::string_view key) const;
+    bool GetBool(std::string_view key, bool defaultValue) const;
+    int32_t GetInt(std::string_view key, int32_t defaultValue) const;
+    double GetDouble(std::string_view key, double defaultValue) const;
+    std::string GetString(std::string_view key, const std::string& defaultValue) const;
+
+    // Number of items of an array or members of an object.
+    int32_t GetArraySize() const;
+    JsonNode GetArrayItem(int32_t index) const;
+    // First item or member, then walk with GetNext.
+    JsonNode GetChild() const;
+    JsonNode GetNext() const;
+
+private:
+    friend class JsonDocument;
+    JsonNode(const JsonDocument* document, uint32_t index) : document_(document), index_(index) {}
+
+    const JsonDocument* document_ = nullptr;
+    uint32_t index_ = 0;
+};
+
+// Read only json tree parsed from one buffer. All nodes are kept in one array and address each other by index,
+// strings and keys without escapes point into the buffer, and keys are interned so members are compared by id.
+// Large objects are looked up by hash. Use it instead of JsonValue for json which is only read.
+class ACE_EXPORT JsonDocument final {
+public:
+    JsonDocument() = default;
+    ~JsonDocument() = default;
+
+    // Parses the whole content, trailing characters other than white spaces fail the parsing.
+    bool Parse(std::string&& content);
+    bool IsValid() const
+    {
+        return !nodes_.empty();
+    }
+    // Offset where the parsing stopped if it failed.
+    size_t GetErrorOffset() const
+    {
+        return errorOffset_;
+    }
+    JsonNode GetRoot() const
+    {
+        return JsonNode(this, 0);
+    }
+
+    // Parses content and calls the handler for every value.
+    static bool Parse(std::string_view content, JsonHandler& handler, size_t* errorOffset = nullptr);
+
+private:
+    friend class JsonNode;
+    friend class JsonDocumentBuilder;
+
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    struct Node {
+        JsonType type = JsonType::INVALID;
+        bool boolValue = false;
+        uint32_t key = INVALID_INDEX;
+        uint32_t next = INVALID_INDEX;
+        // children of arrays and objects, in children_.
+        uint32_t childBegin = 0;
+        uint32_t childCount = 0;
+        double number = 0.0;
+        std::string_view string;
+    };
+
+    const Node* GetNode(uint32_t index) const
+    {
+        return index < nodes_.size() ? &nodes_[index] : nullptr;
+    }
+    uint32_t FindMember(uint32_t object, std::string_view key) const;
+    std::string_view KeepString(std::string_view value);
+    uint32_t InternKey(std::string_view key);
+    void Clear();
+
+    std::string content_;
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> children_;
+    // Strings with escapes, they do not appear in the content as they are.
+    std::deque<std::string> decodedStrings_;
+    std::vector<std::string_view> keys_;
+    std::unordered_map<std::string_view, uint32_t> keyIds_;
+    // (object index, key id) to member index, for large objects only.
+    std::unordered_map<uint64_t, uint32_t> members_;
+    size_t errorOffset_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(JsonDocument);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_DOCUMENT_H
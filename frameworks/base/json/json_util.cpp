@@ -17,6 +17,8 @@
 
 #include "cJSON.h"
 
+#include "base/json/json_document.h"
+
 namespace OHOS::Ace {
 
 JsonValue::JsonValue(JsonObject* object) : object_(object) {}
@@ -422,4 +424,16 @@ std::unique_ptr<JsonValue> JsonUtil::CreateArray(bool isRoot)
     return std::make_unique<JsonValue>(cJSON_CreateArray(), isRoot);
 }
 
+std::unique_ptr<JsonDocument> JsonUtil::ParseJsonDocument(std::string&& content)
+{
+    auto document = std::make_unique<JsonDocument>();
+    document->Parse(std::move(content));
+    return document;
+}
+
+bool JsonUtil::ParseJsonStream(std::string_view content, JsonHandler& handler)
+{
+    return JsonDocument::Parse(content, handler);
+}
+
 } // namespace OHOS::Ace
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "base/utils/macros.h"
 
@@ -26,6 +27,8 @@ struct cJSON;
 namespace OHOS::Ace {
 
 using JsonObject = cJSON;
+class JsonDocument;
+class JsonHandler;
 
 class ACE_FORCE_EXPORT_WITH_PREVIEW JsonValue final {
 public:
@@ -101,6 +104,10 @@ public:
     static std::unique_ptr<JsonValue> ParseJsonString(const std::string& content, const char** parseEnd = nullptr);
     static std::unique_ptr<JsonValue> Create(bool isRoot);
     static std::unique_ptr<JsonValue> CreateArray(bool isRoot);
+    // For json which is only read, parsed without a JsonValue for every access. Check IsValid of the result.
+    static std::unique_ptr<JsonDocument> ParseJsonDocument(std::string&& content);
+    // Calls the handler for every value of content without building a tree.
+    static bool ParseJsonStream(std::string_view content, JsonHandler& handler);
 };
 
 } // namespace OHOS::Ace
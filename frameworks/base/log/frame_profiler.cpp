@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/frame_profiler.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int64_t NANOS_PER_MICRO = 1000;
+constexpr double PERCENT = 100.0;
+constexpr double PERCENTILES[] = { 50.0, 90.0, 99.0 };
+
+uint32_t ToMicros(int64_t nanos)
+{
+    if (nanos <= 0) {
+        return 0;
+    }
+    auto micros = static_cast<uint64_t>(nanos / NANOS_PER_MICRO);
+    return static_cast<uint32_t>(std::min<uint64_t>(micros, std::numeric_limits<uint32_t>::max()));
+}
+
+std::string FormatHistogram(const std::string& name, const LatencyHistogram& histogram)
+{
+    std::string line = name;
+    line.append(": count=").append(std::to_string(histogram.GetCount()));
+    line.append(" mean=").append(std::to_string(histogram.GetMean())).append("us");
+    for (auto percentile : PERCENTILES) {
+        line.append(" p").append(std::to_string(static_cast<int32_t>(percentile))).append("=");
+        line.append(std::to_string(histogram.GetPercentile(percentile))).append("us");
+    }
+    line.append(" max=").append(std::to_string(histogram.GetMax())).append("us");
+    return line;
+}
+
+} // namespace
+
+uint32_t LatencyHistogram::BucketIndex(uint64_t micros)
+{
+    if (micros < LINEAR_BUCKETS) {
+        return static_cast<uint32_t>(micros);
+    }
+    uint32_t exponent = 0;
+    for (auto value = micros; value > 1; value >>= 1) {
+        ++exponent;
+    }
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    auto subBucket = static_cast<uint32_t>((micros >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return LINEAR_BUCKETS + (exponent - LINEAR_BITS) * SUB_BUCKETS + subBucket;
+}
+
+uint64_t LatencyHistogram::BucketLowerBound(uint32_t index)
+{
+    if (index < LINEAR_BUCKETS) {
+        return index;
+    }
+    uint32_t exponent = (index - LINEAR_BUCKETS) / SUB_BUCKETS + LINEAR_BITS;
+    uint64_t subBucket = (index - LINEAR_BUCKETS) % SUB_BUCKETS;
+    return (SUB_BUCKETS + subBucket) << (exponent - SUB_BUCKET_BITS);
+}
+
+void LatencyHistogram::Record(uint64_t micros)
+{
+    auto& bucket = buckets_[BucketIndex(micros)];
+    // Only the UI thread writes, plain load and store are enough to keep counters consistent.
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    sum_.store(sum_.load(std::memory_order_relaxed) + micros, std::memory_order_relaxed);
+    if (micros > max_.load(std::memory_order_relaxed)) {
+        max_.store(micros, std::memory_order_relaxed);
+    }
+    count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_release);
+}
+
+uint64_t LatencyHistogram::GetMean() const
+{
+    auto count = count_.load(std::memory_order_acquire);
+    return count == 0 ? 0 : sum_.load(std::memory_order_relaxed) / count;
+}
+
+uint64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    uint64_t total = 0;
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+    auto target = static_cast<uint64_t>(std::clamp(percentile, 0.0, PERCENT) / PERCENT * total);
+    target = std::max<uint64_t>(target, 1);
+    uint64_t accumulated = 0;
+    for (uint32_t index = 0; index < BUCKET_COUNT; ++index) {
+        accumulated += buckets_[index].load(std::memory_order_relaxed);
+        if (accumulated >= target) {
+            return BucketLowerBound(index);
+        }
+    }
+    return BucketLowerBound(BUCKET_COUNT - 1);
+}
+
+FrameProfiler::ScopedPhase::ScopedPhase(FrameProfiler& profiler, FramePhase phase) : profiler_(profiler)
+{
+    if (profiler_.IsInFrame()) {
+        profiler_.BeginPhase(phase);
+        started_ = true;
+    }
+}
+
+FrameProfiler::ScopedPhase::~ScopedPhase()
+{
+    if (started_) {
+        profiler_.EndPhase();
+    }
+}
+
+void FrameProfiler::BeginFrame(uint64_t vsyncTime)
+{
+    if (!enabled_) {
+        return;
+    }
+    inFrame_ = true;
+    frameStartTime_ = GetSysTimestamp();
+    current_ = FrameRecord();
+    current_.vsyncTime = vsyncTime;
+    phaseNanos_.fill(0);
+    phaseDepth_ = 0;
+}
+
+void FrameProfiler::BeginPhase(FramePhase phase)
+{
+    if (!inFrame_ || phase >= FramePhase::COUNT) {
+        return;
+    }
+    auto now = GetSysTimestamp();
+    if (phaseDepth_ > 0 && phaseDepth_ <= MAX_PHASE_DEPTH) {
+        AddPhaseTime(phaseStack_[phaseDepth_ - 1], now - phaseStartTime_);
+    }
+    if (phaseDepth_ < MAX_PHASE_DEPTH) {
+        phaseStack_[phaseDepth_] = phase;
+        phaseStartTime_ = now;
+    }
+    ++phaseDepth_;
+}
+
+void FrameProfiler::EndPhase()
+{
+    if (!inFrame_ || phaseDepth_ == 0) {
+        return;
+    }
+    --phaseDepth_;
+    if (phaseDepth_ >= MAX_PHASE_DEPTH) {
+        return;
+    }
+    auto now = GetSysTimestamp();
+    AddPhaseTime(phaseStack_[phaseDepth_], now - phaseStartTime_);
+    // The outer phase goes on from now.
+    phaseStartTime_ = now;
+}
+
+void FrameProfiler::AddPhaseTime(FramePhase phase, int64_t nanos)
+{
+    if (!inFrame_ || phase >= FramePhase::COUNT || nanos <= 0) {
+        return;
+    }
+    // A phase may run more than once in a frame, e.g. layout flushed again by a post flush listener.
+    phaseNanos_[static_cast<size_t>(phase)] += nanos;
+}
+
+void FrameProfiler::EndFrame()
+{
+    if (!inFrame_) {
+        return;
+    }
+    inFrame_ = false;
+    auto frameNanos = GetSysTimestamp() - frameStartTime_;
+    current_.totalMicros = ToMicros(frameNanos);
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        current_.phaseMicros[phase] = ToMicros(phaseNanos_[phase]);
+    }
+
+    auto frameIndex = frameCount_.load(std::memory_order_relaxed);
+    auto& slot = ring_[frameIndex % RECENT_FRAME_COUNT];
+    slot.sequence.store(frameIndex * 2 + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.vsyncTime.store(current_.vsyncTime, std::memory_order_relaxed);
+    slot.totalMicros.store(current_.totalMicros, std::memory_order_relaxed);
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        slot.phaseMicros[phase].store(current_.phaseMicros[phase], std::memory_order_relaxed);
+        phaseHistograms_[phase].Record(current_.phaseMicros[phase]);
+    }
+    slot.sequence.store(frameIndex * 2 + 2, std::memory_order_release);
+    frameHistogram_.Record(current_.totalMicros);
+    if (static_cast<uint64_t>(std::max<int64_t>(frameNanos, 0)) > frameBudgetNs_) {
+        jankCount_.store(jankCount_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    frameCount_.store(frameIndex + 1, std::memory_order_release);
+}
+
+void FrameProfiler::GetRecentFrames(std::vector<FrameRecord>& frames) const
+{
+    frames.clear();
+    auto end = frameCount_.load(std::memory_order_acquire);
+    auto begin = end > RECENT_FRAME_COUNT ? end - RECENT_FRAME_COUNT : 0;
+    for (auto index = begin; index < end; ++index) {
+        const auto& slot = ring_[index % RECENT_FRAME_COUNT];
+        auto sequence = index * 2 + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+            continue;
+        }
+        FrameRecord record;
+        record.vsyncTime = slot.vsyncTime.load(std::memory_order_relaxed);
+        record.totalMicros = slot.totalMicros.load(std::memory_order_relaxed);
+        for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+            record.phaseMicros[phase] = slot.phaseMicros[phase].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // The slot is torn or holds a newer frame when the UI thread wrote it while it was copied.
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+        frames.emplace_back(record);
+    }
+}
+
+void FrameProfiler::Reset()
+{
+    frameCount_.store(0, std::memory_order_release);
+    jankCount_.store(0, std::memory_order_relaxed);
+    frameHistogram_.Reset();
+    for (auto& histogram : phaseHistograms_) {
+        histogram.Reset();
+    }
+}
+
+void FrameProfiler::Dump(std::vector<std::string>& lines) const
+{
+    lines.emplace_back("FrameProfiler: frames=" + std::to_string(GetFrameCount()) +
+                       " jank=" + std::to_string(GetJankCount()) +
+                       " budget=" + std::to_string(frameBudgetNs_ / NANOS_PER_MICRO) + "us");
+    lines.emplace_back(FormatHistogram("frame", frameHistogram_));
+    for (size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        lines.emplace_back(FormatHistogram(GetPhaseName(static_cast<FramePhase>(phase)), phaseHistograms_[phase]));
+    }
+}
+
+const char* FrameProfiler::GetPhaseName(FramePhase phase)
+{
+    switch (phase) {
+        case FramePhase::ANIMATION:
+            return "animation";
+        case FramePhase::BUILD:
+            return "build";
+        case FramePhase::LAYOUT:
+            return "layout";
+        case FramePhase::RENDER:
+            return "render";
+        case FramePhase::RENDER_FINISH:
+            return "renderFinish";
+        case FramePhase::POST_FLUSH:
+            return "postFlush";
+        default:
+            return "unknown";
+    }
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_PROFILER_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+enum class FramePhase : uint32_t {
+    ANIMATION = 0,
+    BUILD,
+    LAYOUT,
+    RENDER,
+    RENDER_FINISH,
+    POST_FLUSH,
+    COUNT,
+};
+
+constexpr size_t FRAME_PHASE_COUNT = static_cast<size_t>(FramePhase::COUNT);
+
+// Latency histogram with log-linear buckets over microseconds: exact below 16us, then 8 sub-buckets for each power
+// of two, so any recorded value is off by at most 12.5%. Written by one thread, readable from any thread.
+class ACE_EXPORT LatencyHistogram final {
+public:
+    LatencyHistogram() = default;
+    ~LatencyHistogram() = default;
+
+    void Record(uint64_t micros);
+    void Reset();
+
+    uint64_t GetCount() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+    uint64_t GetMax() const
+    {
+        return max_.load(std::memory_order_relaxed);
+    }
+    uint64_t GetMean() const;
+    // Value at the given percentile in [0, 100], reported as the lower bound of its bucket.
+    uint64_t GetPercentile(double percentile) const;
+
+private:
+    static constexpr uint32_t LINEAR_BUCKETS = 16;
+    static constexpr uint32_t LINEAR_BITS = 4;
+    static constexpr uint32_t SUB_BUCKET_BITS = 3;
+    static constexpr uint32_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr uint32_t MAX_EXPONENT = 31;
+    static constexpr uint32_t BUCKET_COUNT = LINEAR_BUCKETS + (MAX_EXPONENT - LINEAR_BITS + 1) * SUB_BUCKETS;
+
+    static uint32_t BucketIndex(uint64_t micros);
+    static uint64_t BucketLowerBound(uint32_t index);
+
+    std::array<std::atomic<uint32_t>, BUCKET_COUNT> buckets_ {};
+    std::atomic<uint64_t> count_ { 0 };
+    std::atomic<uint64_t> sum_ { 0 };
+    std::atomic<uint64_t> max_ { 0 };
+
+    ACE_DISALLOW_COPY_AND_MOVE(LatencyHistogram);
+};
+
+struct FrameRecord {
+    uint64_t vsyncTime = 0;
+    uint32_t totalMicros = 0;
+    std::array<uint32_t, FRAME_PHASE_COUNT> phaseMicros {};
+};
+
+// Records the time spent in each pipeline phase of every vsync frame. Frames are written by the UI thread into a
+// lock-free ring buffer and aggregated into per-phase histograms, both can be read from other threads.
+// Phase times are exclusive: while a phase runs inside another one, e.g. a layout flushed by a post flush listener,
+// the time is counted for the inner phase only, so the phases of a frame add up to at most its total time.
+class ACE_EXPORT FrameProfiler final {
+public:
+    static constexpr size_t RECENT_FRAME_COUNT = 128;
+    static constexpr uint64_t DEFAULT_FRAME_BUDGET_NS = 16666667;
+
+    FrameProfiler() = default;
+    ~FrameProfiler() = default;
+
+    class ScopedPhase final {
+    public:
+        ScopedPhase(FrameProfiler& profiler, FramePhase phase);
+        ~ScopedPhase();
+
+    private:
+        FrameProfiler& profiler_;
+        bool started_ = false;
+
+        ACE_DISALLOW_COPY_AND_MOVE(ScopedPhase);
+    };
+
+    void BeginFrame(uint64_t vsyncTime);
+    void EndFrame();
+    // Phases may nest, the running phase is paused until the nested one ends.
+    void BeginPhase(FramePhase phase);
+    void EndPhase();
+    void AddPhaseTime(FramePhase phase, int64_t nanos);
+
+    bool IsInFrame() const
+    {
+        return inFrame_;
+    }
+
+    void SetEnabled(bool enabled)
+    {
+        enabled_ = enabled;
+    }
+
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    // Frames taking longer than the budget are counted as jank.
+    void SetFrameBudget(uint64_t budgetNs)
+    {
+        frameBudgetNs_ = budgetNs;
+    }
+
+    uint64_t GetFrameCount() const
+    {
+        return frameCount_.load(std::memory_order_acquire);
+    }
+
+    uint64_t GetJankCount() const
+    {
+        return jankCount_.load(std::memory_order_relaxed);
+    }
+
+    const LatencyHistogram& GetFrameHistogram() const
+    {
+        return frameHistogram_;
+    }
+
+    const LatencyHistogram& GetPhaseHistogram(FramePhase phase) const
+    {
+        return phaseHistograms_[static_cast<size_t>(phase)];
+    }
+
+    // Copies up to RECENT_FRAME_COUNT latest frames, oldest first.
+    void GetRecentFrames(std::vector<FrameRecord>& frames) const;
+    void Reset();
+    void Dump(std::vector<std::string>& lines) const;
+
+    static const char* GetPhaseName(FramePhase phase);
+
+private:
+    // Written under a sequence lock, the sequence of frame n is 2n + 1 while the UI thread writes the slot and 2n + 2
+    // once it is written. Readers drop the slot when the sequence is not the one of the frame they want, or changes
+    // while they copy it.
+    struct Slot {
+        std::atomic<uint64_t> sequence { 0 };
+        std::atomic<uint64_t> vsyncTime { 0 };
+        std::atomic<uint32_t> totalMicros { 0 };
+        std::array<std::atomic<uint32_t>, FRAME_PHASE_COUNT> phaseMicros {};
+    };
+
+    static constexpr size_t MAX_PHASE_DEPTH = 8;
+
+    bool enabled_ = true;
+    bool inFrame_ = false;
+    uint64_t frameBudgetNs_ = DEFAULT_FRAME_BUDGET_NS;
+    int64_t frameStartTime_ = 0;
+    FrameRecord current_;
+    std::array<int64_t, FRAME_PHASE_COUNT> phaseNanos_ {};
+    // Running phases, the innermost last. Phases nested deeper than MAX_PHASE_DEPTH count for their parent.
+    std::array<FramePhase, MAX_PHASE_DEPTH> phaseStack_ {};
+    size_t phaseDepth_ = 0;
+    int64_t phaseStartTime_ = 0;
+
+    std::array<Slot, RECENT_FRAME_COUNT> ring_ {};
+    std::atomic<uint64_t> frameCount_ { 0 };
+    std::atomic<uint64_t> jankCount_ { 0 };
+    LatencyHistogram frameHistogram_;
+    std::array<LatencyHistogram, FRAME_PHASE_COUNT> phaseHistograms_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameProfiler);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_PROFILER_H
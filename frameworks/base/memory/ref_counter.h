@@ -17,26 +17,13 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_REF_COUNTER_H
 
 #include <atomic>
+#include <thread>
 
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
 
 namespace OHOS::Ace {
 
-// Reference counter.
-class RefCounter {
-public:
-    virtual int32_t IncStrongRef() = 0;
-    virtual int32_t DecStrongRef() = 0;
-    virtual int32_t TryIncStrongRef() = 0;
-    virtual int32_t StrongRefCount() const = 0;
-    virtual int32_t IncWeakRef() = 0;
-    virtual int32_t DecWeakRef() = 0;
-
-protected:
-    virtual ~RefCounter() = default;
-};
-
 // Define thread-safe counter using 'std::atomic' to implement Increase/Decrease count.
 class ThreadSafeCounter final {
 public:
@@ -114,36 +101,22 @@ private:
     ACE_DISALLOW_COPY_AND_MOVE(ThreadUnsafeCounter);
 };
 
-template<class T>
-class RefCounterImpl final : public RefCounter {
-public:
-    static RefCounter* Create()
-    {
-        return new RefCounterImpl();
-    }
+class Referenced;
 
-    int32_t IncStrongRef() final
-    {
-        return strongRef_.Increase();
-    }
-    int32_t DecStrongRef() final
-    {
-        return strongRef_.Decrease();
-    }
-    int32_t TryIncStrongRef() final
-    {
-        return strongRef_.TryIncrease();
-    }
-    int32_t StrongRefCount() const final
-    {
-        return strongRef_.CurrentCount();
-    }
+// Counter shared by all 'WeakPtr' of an instance. It is created the first time a 'WeakPtr' is taken, so instances
+// which are never weakly referenced don't pay for it, and lives on while weak references remain after the instance
+// is released. The instance detaches itself before its memory is released, while 'WeakPtr' only touches the
+// instance with the counter locked, so upgrading never reads a released instance.
+class WeakRefCounter final {
+public:
+    explicit WeakRefCounter(Referenced* referenced) : referenced_(referenced) {}
+    ~WeakRefCounter() = default;
 
-    int32_t IncWeakRef() final
+    int32_t IncWeakRef()
     {
         return weakRef_.Increase();
     }
-    int32_t DecWeakRef() final
+    int32_t DecWeakRef()
     {
         int32_t refCount = weakRef_.Decrease();
         if (refCount == 0) {
@@ -153,15 +126,33 @@ public:
         return refCount;
     }
 
+    // Increase strong reference count of the instance if it is still alive, return true if succeed.
+    inline bool TryIncStrongRef();
+    // Whether the instance is released or being released.
+    inline bool Expired();
+    // Called by the instance while it is being released.
+    inline void Detach();
+
 private:
-    T strongRef_ { 0 };
+    void Lock()
+    {
+        while (locked_.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    void Unlock()
+    {
+        locked_.clear(std::memory_order_release);
+    }
+
+    Referenced* referenced_ { nullptr };
+    std::atomic_flag locked_ = ATOMIC_FLAG_INIT;
     // Weak reference count should start with 1,
     // because instance MUST hold the reference counter for itself.
-    T weakRef_ { 1 };
-};
+    ThreadSafeCounter weakRef_ { 1 };
 
-using ThreadSafeRef = RefCounterImpl<ThreadSafeCounter>;
-using ThreadUnsafeRef = RefCounterImpl<ThreadUnsafeCounter>;
+    ACE_DISALLOW_COPY_AND_MOVE(WeakRefCounter);
+};
 
 } // namespace OHOS::Ace
 
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_REFERENCED_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_REFERENCED_H
 
+#include <atomic>
 #include <string>
 
 #include "base/memory/memory_monitor.h"
@@ -66,11 +67,25 @@ public:
 
     int32_t IncRefCount()
     {
-        return refCounter_->IncStrongRef();
+        if (threadSafe_) {
+            int32_t refCount = refCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+            ACE_DCHECK(refCount > 0);
+            return refCount;
+        }
+        int32_t refCount = refCount_.load(std::memory_order_relaxed) + 1;
+        refCount_.store(refCount, std::memory_order_relaxed);
+        return refCount;
     }
     int32_t DecRefCount()
     {
-        int32_t refCount = refCounter_->DecStrongRef();
+        int32_t refCount = 0;
+        if (threadSafe_) {
+            refCount = refCount_.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        } else {
+            refCount = refCount_.load(std::memory_order_relaxed) - 1;
+            refCount_.store(refCount, std::memory_order_relaxed);
+        }
+        ACE_DCHECK(refCount >= 0);
         if (refCount == 0 && MaybeRelease()) {
             // Release this instance, while its strong reference have reduced to zero.
             delete this;
@@ -80,13 +95,14 @@ public:
 #ifdef ACE_MEMORY_MONITOR
     int32_t RefCount() const
     {
-        return refCounter_->StrongRefCount();
+        return refCount_.load(std::memory_order_relaxed);
     }
 #endif
 
 protected:
-    explicit Referenced(bool threadSafe = true)
-        : refCounter_(threadSafe ? ThreadSafeRef::Create() : ThreadUnsafeRef::Create())
+    // Reference counts are kept in the instance itself, 'threadSafe' only decides whether the strong count is
+    // changed atomically. The counter for weak references is allocated when the first 'WeakPtr' is taken.
+    explicit Referenced(bool threadSafe = true) : threadSafe_(threadSafe)
     {
 #ifdef ACE_MEMORY_MONITOR
         MemoryMonitor::GetInstance().Add(this);
@@ -95,9 +111,13 @@ protected:
 
     virtual ~Referenced()
     {
-        // Decrease weak reference count held by 'Referenced' itself.
-        refCounter_->DecWeakRef();
-        refCounter_ = nullptr;
+        auto weakRefCounter = weakRefCounter_.load(std::memory_order_acquire);
+        if (weakRefCounter != nullptr) {
+            weakRefCounter->Detach();
+            // Decrease weak reference count held by 'Referenced' itself.
+            weakRefCounter->DecWeakRef();
+            weakRefCounter_.store(nullptr, std::memory_order_relaxed);
+        }
 #ifdef ACE_MEMORY_MONITOR
         MemoryMonitor::GetInstance().Remove(this);
 #endif
@@ -113,8 +133,45 @@ private:
     friend class RefPtr;
     template<class T>
     friend class WeakPtr;
+    friend class WeakRefCounter;
+
+    // Increase strong reference count while current value is not zero.
+    bool TryIncRefCount()
+    {
+        int32_t refCount = refCount_.load(std::memory_order_relaxed);
+        do {
+            if (refCount == 0) {
+                return false;
+            }
+            ACE_DCHECK(refCount > 0);
+        } while (!refCount_.compare_exchange_weak(refCount, refCount + 1, std::memory_order_relaxed));
+        return true;
+    }
+
+    WeakRefCounter* GetWeakRefCounter() const
+    {
+        auto weakRefCounter = weakRefCounter_.load(std::memory_order_acquire);
+        if (weakRefCounter != nullptr) {
+            return weakRefCounter;
+        }
+        auto newWeakRefCounter = new WeakRefCounter(const_cast<Referenced*>(this));
+        if (weakRefCounter_.compare_exchange_strong(
+            weakRefCounter, newWeakRefCounter, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return newWeakRefCounter;
+        }
+        // Another thread created the counter first.
+        delete newWeakRefCounter;
+        return weakRefCounter;
+    }
+
+    WeakRefCounter* PeekWeakRefCounter() const
+    {
+        return weakRefCounter_.load(std::memory_order_acquire);
+    }
 
-    RefCounter* refCounter_ { nullptr };
+    std::atomic<int32_t> refCount_ { 0 };
+    bool threadSafe_ { true };
+    mutable std::atomic<WeakRefCounter*> weakRefCounter_ { nullptr };
 
     ACE_DISALLOW_COPY_AND_MOVE(Referenced);
 };
@@ -215,14 +272,15 @@ public:
         return *this;
     }
 
-    // Comparing pointer of reference counter to implement Overloaded operator '==' and '!='.
+    // Comparing pointer of 'Referenced' to implement Overloaded operator '==' and '!=', since an instance inherits
+    // 'Referenced' virtually, it is the same address whichever type the instance is referenced by.
     template<class O>
     bool operator==(const O* rawPtr) const
     {
         if (rawPtr_ == nullptr) {
             return rawPtr == nullptr;
         }
-        return rawPtr != nullptr && rawPtr_->refCounter_ == rawPtr->refCounter_;
+        return rawPtr != nullptr && static_cast<const Referenced*>(rawPtr_) == static_cast<const Referenced*>(rawPtr);
     }
     template<class O>
     bool operator!=(const O* rawPtr) const
@@ -268,7 +326,8 @@ public:
         if (rawPtr_ == nullptr) {
             return other.rawPtr_ != nullptr;
         }
-        return other.rawPtr_ != nullptr && rawPtr_->refCounter_ < other.rawPtr_->refCounter_;
+        return other.rawPtr_ != nullptr &&
+               static_cast<const Referenced*>(rawPtr_) < static_cast<const Referenced*>(other.rawPtr_);
     }
 
 private:
@@ -349,11 +408,11 @@ public:
     RefPtr<T> Upgrade() const
     {
         // A 'WeakPtr' could upgrade to 'RefPtr' if this instance is still alive.
-        return refCounter_ != nullptr && refCounter_->TryIncStrongRef() > 0 ? RefPtr<T>(unsafeRawPtr_, false) : nullptr;
+        return refCounter_ != nullptr && refCounter_->TryIncStrongRef() ? RefPtr<T>(unsafeRawPtr_, false) : nullptr;
     }
     bool Invalid() const
     {
-        return refCounter_ == nullptr || refCounter_->StrongRefCount() == 0;
+        return refCounter_ == nullptr || refCounter_->Expired();
     }
 
     // Use 'Swap' to implement overloaded operator '=', just like 'RefPtr'.
@@ -404,7 +463,7 @@ public:
         if (refCounter_ == nullptr) {
             return rawPtr == nullptr;
         }
-        return rawPtr != nullptr && refCounter_ == rawPtr->refCounter_;
+        return rawPtr != nullptr && refCounter_ == rawPtr->PeekWeakRefCounter();
     }
     template<class O>
     bool operator!=(const O* rawPtr) const
@@ -426,7 +485,10 @@ public:
     template<class O>
     bool operator==(const RefPtr<O>& strong) const
     {
-        return strong.rawPtr_ != nullptr ? strong.rawPtr_->refCounter_ == refCounter_ : refCounter_ == nullptr;
+        if (strong.rawPtr_ == nullptr) {
+            return refCounter_ == nullptr;
+        }
+        return refCounter_ != nullptr && strong.rawPtr_->PeekWeakRefCounter() == refCounter_;
     }
     template<class O>
     bool operator!=(const RefPtr<O>& strong) const
@@ -443,9 +505,9 @@ public:
 
 private:
     // Construct instance by raw pointer.
-    explicit WeakPtr(T* rawPtr) : WeakPtr(rawPtr, rawPtr != nullptr ? rawPtr->refCounter_ : nullptr) {}
+    explicit WeakPtr(T* rawPtr) : WeakPtr(rawPtr, rawPtr != nullptr ? rawPtr->GetWeakRefCounter() : nullptr) {}
     template<class O>
-    WeakPtr(O* rawPtr, RefCounter* aceRef) : unsafeRawPtr_(rawPtr), refCounter_(aceRef)
+    WeakPtr(O* rawPtr, WeakRefCounter* aceRef) : unsafeRawPtr_(rawPtr), refCounter_(aceRef)
     {
         if (refCounter_) {
             refCounter_->IncWeakRef();
@@ -458,9 +520,32 @@ private:
 
     // Notice: Raw pointer of instance is kept, but NEVER use it except succeed to upgrade to 'RefPtr'.
     T* unsafeRawPtr_ { nullptr };
-    RefCounter* refCounter_ { nullptr };
+    WeakRefCounter* refCounter_ { nullptr };
 };
 
+bool WeakRefCounter::TryIncStrongRef()
+{
+    Lock();
+    bool result = referenced_ != nullptr && referenced_->TryIncRefCount();
+    Unlock();
+    return result;
+}
+
+bool WeakRefCounter::Expired()
+{
+    Lock();
+    bool expired = referenced_ == nullptr || referenced_->refCount_.load(std::memory_order_relaxed) == 0;
+    Unlock();
+    return expired;
+}
+
+void WeakRefCounter::Detach()
+{
+    Lock();
+    referenced_ = nullptr;
+    Unlock();
+}
+
 } // namespace OHOS::Ace
 
 #endif // FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_REFERENCED_H
@@ -16,28 +16,45 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_TYPE_INFO_BASE_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_TYPE_INFO_BASE_H
 
+#include <cstdint>
 #include <string>
 
 #include "base/memory/memory_monitor_def.h"
 
 // Generate 'TypeInfo' for each classes.
-// And using hash code of its name for 'TypeId'.
+// And using hash code of its name for 'TypeId', which is computed at compile time.
 #define DECLARE_CLASS_TYPE_INFO(classname)                                              \
 public:                                                                                 \
-    static const char* TypeName()                                                       \
+    static constexpr const char* TypeName()                                             \
     {                                                                                   \
         return #classname;                                                              \
     }                                                                                   \
-    static TypeInfoBase::IdType TypeId()                                                \
+    static constexpr TypeInfoBase::IdType TypeId()                                      \
     {                                                                                   \
-        static TypeInfoBase::IdType myTypeId = std::hash<std::string> {}(TypeName());   \
-        return myTypeId;                                                                \
+        return TypeInfoBase::HashTypeName(#classname);                                  \
     }                                                                                   \
     DECLARE_CLASS_TYPE_SIZE(classname)
 
 // Integrate it into class declaration to support 'DynamicCast'.
+// 'TypeMask' sums up the ids of the class and all its ancestors, so a cast to a type which is not an ancestor fails
+// without walking the class hierarchy, and the walk only goes down the bases which may hold the target type.
 #define DECLARE_RELATIONSHIP_OF_CLASSES(classname, ...) DECLARE_CLASS_TYPE_INFO(classname)            \
+public:                                                                                               \
+    static constexpr uint64_t TypeMask()                                                              \
+    {                                                                                                 \
+        return TypeInfoBase::TypeIdMask(TypeId()) | CombineTypeMask<__VA_ARGS__>();                   \
+    }                                                                                                 \
+                                                                                                      \
 protected:                                                                                            \
+    template<class __T, class... __V>                                                                 \
+    static constexpr uint64_t CombineTypeMask()                                                       \
+    {                                                                                                 \
+        if constexpr (sizeof...(__V) == 0) {                                                          \
+            return __T::TypeMask();                                                                   \
+        } else {                                                                                      \
+            return __T::TypeMask() | CombineTypeMask<__V...>();                                       \
+        }                                                                                             \
+    }                                                                                                 \
     template<class __T, class __O, class... __V>                                                      \
     uintptr_t TrySafeCastById(TypeInfoBase::IdType id) const                                          \
     {                                                                                                 \
@@ -53,7 +70,11 @@ protected:
     }                                                                                                 \
     uintptr_t SafeCastById(TypeInfoBase::IdType id) const override                                    \
     {                                                                                                 \
-        return id == TypeId() ? reinterpret_cast<uintptr_t>(this) : TrySafeCastById<__VA_ARGS__>(id); \
+        if (id == TypeId()) {                                                                         \
+            return reinterpret_cast<uintptr_t>(this);                                                 \
+        }                                                                                             \
+        constexpr uint64_t typeMask = TypeMask();                                                     \
+        return TypeInfoBase::MayBeTypeOf(typeMask, id) ? TrySafeCastById<__VA_ARGS__>(id) : 0;       \
     }                                                                                                 \
     TypeInfoBase::IdType GetTypeId() const override                                                   \
     {                                                                                                 \
@@ -74,8 +95,46 @@ public:
     virtual ~TypeInfoBase() = default;
 
     using IdType = std::size_t;
+
+    // FNV-1a hash of the type name.
+    static constexpr IdType HashTypeName(const char* name)
+    {
+        if constexpr (sizeof(IdType) >= sizeof(uint64_t)) {
+            uint64_t hash = 14695981039346656037ULL;
+            for (; *name != '\0'; ++name) {
+                hash = (hash ^ static_cast<uint8_t>(*name)) * 1099511628211ULL;
+            }
+            return static_cast<IdType>(hash);
+        } else {
+            uint32_t hash = 2166136261U;
+            for (; *name != '\0'; ++name) {
+                hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619U;
+            }
+            return static_cast<IdType>(hash);
+        }
+    }
+
+    // Two bits of a 64 bits mask picked by the id, masks of a class and its ancestors are combined into 'TypeMask'.
+    static constexpr uint64_t TypeIdMask(IdType id)
+    {
+        constexpr uint32_t maskBits = 63;
+        constexpr uint32_t secondBitShift = 6;
+        return (1ULL << (id & maskBits)) | (1ULL << ((id >> secondBitShift) & maskBits));
+    }
+
+    // False if a class with the given mask can never be cast to the type of id.
+    static constexpr bool MayBeTypeOf(uint64_t typeMask, IdType id)
+    {
+        return (typeMask & TypeIdMask(id)) == TypeIdMask(id);
+    }
+
     DECLARE_CLASS_TYPE_INFO(TypeInfoBase);
 
+    static constexpr uint64_t TypeMask()
+    {
+        return TypeIdMask(TypeId());
+    }
+
 protected:
     virtual uintptr_t SafeCastById(IdType id) const
     {
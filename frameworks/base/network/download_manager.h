@@ -28,6 +28,8 @@ public:
 
     virtual ~DownloadManager() = default;
     virtual bool Download(const std::string& url, std::vector<uint8_t>& dataOut) = 0;
+    // Directory of the disk cache of downloaded responses, nothing is cached until it is set.
+    virtual void SetCacheDir(const std::string& cacheDir) {}
 };
 
 } // namespace OHOS::Ace
@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/network/http_cache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <memory>
+#include <sys/stat.h>
+#ifdef WINDOWS_PLATFORM
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include "curl/curl.h"
+
+#include "base/log/log.h"
+#include "base/utils/file_utils.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr char META_SUFFIX[] = ".meta";
+constexpr char DATA_SUFFIX[] = ".data";
+// Temporary files are named by the file they replace, this suffix and a unique part.
+constexpr char TMP_SUFFIX[] = ".tmp";
+constexpr char TMP_TEMPLATE[] = "XXXXXX";
+constexpr char META_HEADER[] = "ACE_HTTP_CACHE_2";
+// Temporary files older than this are left by a crash.
+constexpr int64_t STALE_TMP_FILE_SECONDS = 60 * 60;
+// Trim the cache after this many bytes are stored, instead of scanning the directory on every store.
+constexpr size_t TRIM_INTERVAL_BYTES = 4 * 1024 * 1024;
+constexpr size_t MAX_CACHE_SIZE = 32 * 1024 * 1024;
+// Trim to 3/4 of the limit, so the next few stores do not trim again.
+constexpr size_t TRIM_TARGET_SIZE = MAX_CACHE_SIZE / 4 * 3;
+// Without explicit freshness, a response is fresh for 1/10 of its age since Last-Modified, at most one day.
+constexpr int64_t HEURISTIC_FRESHNESS_DIVISOR = 10;
+constexpr int64_t MAX_HEURISTIC_FRESHNESS = 24 * 60 * 60;
+#ifndef WINDOWS_PLATFORM
+constexpr mode_t CACHE_DIR_MODE = S_IRWXU;
+#endif
+
+std::string TrimSpace(const std::string& str)
+{
+    auto begin = str.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return std::string();
+    }
+    auto end = str.find_last_not_of(" \t\r\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+std::string ToLower(std::string str)
+{
+    std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return std::tolower(c); });
+    return str;
+}
+
+bool ReadFile(const std::string& filePath, std::string& content)
+{
+    std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filePath.c_str(), "rb"), fclose);
+    if (!fp) {
+        return false;
+    }
+    char buffer[BUFSIZ];
+    size_t readSize = 0;
+    while ((readSize = fread(buffer, 1, sizeof(buffer), fp.get())) > 0) {
+        content.append(buffer, readSize);
+    }
+    return ferror(fp.get()) == 0;
+}
+
+// Takes the next line of content from pos, returns false if there is none.
+bool NextLine(const std::string& content, size_t& pos, std::string& line)
+{
+    if (pos >= content.size()) {
+        return false;
+    }
+    auto end = content.find('\n', pos);
+    if (end == std::string::npos) {
+        return false;
+    }
+    line = content.substr(pos, end - pos);
+    pos = end + 1;
+    return true;
+}
+
+struct CacheFileInfo {
+    std::string name;
+    size_t size = 0;
+    int64_t accessTime = 0;
+};
+
+} // namespace
+
+void HttpCache::SetCacheDir(const std::string& cacheDir)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    cacheDir_ = cacheDir;
+}
+
+bool HttpCache::IsEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !cacheDir_.empty();
+}
+
+std::string HttpCache::GetCacheDir() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cacheDir_;
+}
+
+std::string HttpCache::GetFilePath(const std::string& cacheDir, const std::string& url, const char* suffix)
+{
+    // The name must be the same in every run, different urls with the same hash are told by the url in metadata.
+    char name[sizeof(uint64_t) * 2 + 1] = { 0 };
+    if (snprintf(name, sizeof(name), "%016" PRIx64, HashBytes(url.data(), url.size())) < 0) {
+        return std::string();
+    }
+    return cacheDir + "/" + name + suffix;
+}
+
+bool HttpCache::Lookup(const std::string& url, HttpCacheEntry& entry) const
+{
+    auto cacheDir = GetCacheDir();
+    if (cacheDir.empty()) {
+        return false;
+    }
+    std::string content;
+    if (!ReadFile(GetFilePath(cacheDir, url, META_SUFFIX), content)) {
+        return false;
+    }
+    // Metadata is the header, url, etag, last modified, expire time, body size and body hash by line, then the raw
+    // headers.
+    size_t pos = 0;
+    std::string line;
+    if (!NextLine(content, pos, line) || line != META_HEADER) {
+        return false;
+    }
+    // Different urls may have the same hash, check the url of the entry.
+    if (!NextLine(content, pos, line) || line != url) {
+        return false;
+    }
+    std::string expireTime;
+    std::string bodySize;
+    std::string bodyHash;
+    if (!NextLine(content, pos, entry.policy.etag) || !NextLine(content, pos, entry.policy.lastModified) ||
+        !NextLine(content, pos, expireTime) || !NextLine(content, pos, bodySize) || !NextLine(content, pos, bodyHash)) {
+        return false;
+    }
+    entry.policy.expireTime = std::strtoll(expireTime.c_str(), nullptr, 10);
+    entry.bodySize = static_cast<size_t>(std::strtoull(bodySize.c_str(), nullptr, 10));
+    entry.bodyHash = std::strtoull(bodyHash.c_str(), nullptr, 10);
+    entry.headers = content.substr(pos);
+    return true;
+}
+
+bool HttpCache::ReadBody(const std::string& url, const HttpCacheEntry& entry, std::vector<uint8_t>& body) const
+{
+    auto cacheDir = GetCacheDir();
+    if (cacheDir.empty()) {
+        return false;
+    }
+    auto filePath = GetFilePath(cacheDir, url, DATA_SUFFIX);
+    std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filePath.c_str(), "rb"), fclose);
+    if (!fp) {
+        return false;
+    }
+    // One more byte is read to find a body longer than recorded.
+    body.resize(entry.bodySize + 1);
+    if (fread(body.data(), 1, body.size(), fp.get()) != entry.bodySize ||
+        HashBytes(body.data(), entry.bodySize) != entry.bodyHash) {
+        LOGW("cached body of %{private}s does not match its metadata", url.c_str());
+        body.clear();
+        return false;
+    }
+    body.pop_back();
+    // The modify time of the body is its last use, trimming removes the least recently used bodies first.
+#ifdef WINDOWS_PLATFORM
+    _utime(filePath.c_str(), nullptr);
+#else
+    utime(filePath.c_str(), nullptr);
+#endif
+    return true;
+}
+
+bool HttpCache::WriteFile(const std::string& filePath, const char* data, size_t size)
+{
+    // Every write has its own temporary file, concurrent stores of one url don't write into each other.
+    std::string tmpPath = filePath + TMP_SUFFIX + TMP_TEMPLATE;
+    std::unique_ptr<FILE, decltype(&fclose)> fp(FileUtils::CreateTmpFile(tmpPath), fclose);
+    if (!fp) {
+        LOGW("open cache file failed, fail reason: %{public}s", strerror(errno));
+        return false;
+    }
+    bool written = (size == 0 || fwrite(data, 1, size, fp.get()) == size);
+    written = (fclose(fp.release()) == 0) && written;
+    if (!written || !FileUtils::RenameFile(tmpPath, filePath)) {
+        LOGW("write cache file failed, fail reason: %{public}s", strerror(errno));
+        remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool HttpCache::WriteEntry(const std::string& cacheDir, const std::string& url, const HttpCacheEntry& entry)
+{
+    std::string content;
+    content.append(META_HEADER)
+        .append("\n")
+        .append(url)
+        .append("\n")
+        .append(entry.policy.etag)
+        .append("\n")
+        .append(entry.policy.lastModified)
+        .append("\n")
+        .append(std::to_string(entry.policy.expireTime))
+        .append("\n")
+        .append(std::to_string(entry.bodySize))
+        .append("\n")
+        .append(std::to_string(entry.bodyHash))
+        .append("\n")
+        .append(entry.headers);
+    return WriteFile(GetFilePath(cacheDir, url, META_SUFFIX), content.data(), content.size());
+}
+
+void HttpCache::Store(const std::string& url, const HttpCacheEntry& entry, const std::vector<uint8_t>& body)
+{
+    auto cacheDir = GetCacheDir();
+    if (cacheDir.empty() || url.find('\n') != std::string::npos) {
+        return;
+    }
+#ifdef WINDOWS_PLATFORM
+    mkdir(cacheDir.c_str());
+#else
+    mkdir(cacheDir.c_str(), CACHE_DIR_MODE);
+#endif
+    // Write the body first, the entry is visible only when its metadata is written.
+    if (!WriteFile(GetFilePath(cacheDir, url, DATA_SUFFIX), reinterpret_cast<const char*>(body.data()), body.size())) {
+        return;
+    }
+    HttpCacheEntry newEntry = entry;
+    newEntry.bodySize = body.size();
+    newEntry.bodyHash = HashBytes(body.data(), body.size());
+    if (!WriteEntry(cacheDir, url, newEntry)) {
+        remove(GetFilePath(cacheDir, url, DATA_SUFFIX).c_str());
+        return;
+    }
+    bool needTrim = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bytesSinceTrim_ += body.size();
+        if (bytesSinceTrim_ >= TRIM_INTERVAL_BYTES) {
+            bytesSinceTrim_ = 0;
+            needTrim = true;
+        }
+    }
+    if (needTrim) {
+        Trim(cacheDir);
+    }
+}
+
+void HttpCache::Update(const std::string& url, const HttpCacheEntry& entry)
+{
+    auto cacheDir = GetCacheDir();
+    if (cacheDir.empty()) {
+        return;
+    }
+    WriteEntry(cacheDir, url, entry);
+}
+
+void HttpCache::Remove(const std::string& url)
+{
+    auto cacheDir = GetCacheDir();
+    if (cacheDir.empty()) {
+        return;
+    }
+    remove(GetFilePath(cacheDir, url, META_SUFFIX).c_str());
+    remove(GetFilePath(cacheDir, url, DATA_SUFFIX).c_str());
+}
+
+void HttpCache::Trim(const std::string& cacheDir)
+{
+    std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(cacheDir.c_str()), closedir);
+    if (!dir) {
+        return;
+    }
+    std::vector<CacheFileInfo> fileInfos;
+    size_t totalSize = 0;
+    const size_t suffixLength = strlen(DATA_SUFFIX);
+    const size_t tmpLength = strlen(TMP_SUFFIX) + strlen(TMP_TEMPLATE);
+    auto now = static_cast<int64_t>(time(nullptr));
+    for (dirent* filePtr = readdir(dir.get()); filePtr != nullptr; filePtr = readdir(dir.get())) {
+        std::string name(filePtr->d_name);
+        struct stat fileStatus;
+        if (name.size() > tmpLength && name.compare(name.size() - tmpLength, strlen(TMP_SUFFIX), TMP_SUFFIX) == 0) {
+            auto tmpPath = cacheDir + "/" + name;
+            if (stat(tmpPath.c_str(), &fileStatus) == 0 &&
+                now - static_cast<int64_t>(fileStatus.st_mtime) > STALE_TMP_FILE_SECONDS) {
+                remove(tmpPath.c_str());
+            }
+            continue;
+        }
+        if (name.size() <= suffixLength || name.compare(name.size() - suffixLength, suffixLength, DATA_SUFFIX) != 0) {
+            continue;
+        }
+        if (stat((cacheDir + "/" + name).c_str(), &fileStatus) != 0) {
+            continue;
+        }
+        CacheFileInfo info;
+        info.name = name.substr(0, name.size() - suffixLength);
+        info.size = static_cast<size_t>(fileStatus.st_size);
+        info.accessTime = static_cast<int64_t>(fileStatus.st_mtime);
+        totalSize += info.size;
+        fileInfos.emplace_back(std::move(info));
+    }
+    if (totalSize <= MAX_CACHE_SIZE) {
+        return;
+    }
+    std::sort(fileInfos.begin(), fileInfos.end(),
+        [](const CacheFileInfo& lhs, const CacheFileInfo& rhs) { return lhs.accessTime < rhs.accessTime; });
+    size_t removedCount = 0;
+    for (const auto& info : fileInfos) {
+        if (totalSize <= TRIM_TARGET_SIZE) {
+            break;
+        }
+        auto basePath = cacheDir + "/" + info.name;
+        remove((basePath + META_SUFFIX).c_str());
+        remove((basePath + DATA_SUFFIX).c_str());
+        totalSize -= info.size;
+        ++removedCount;
+    }
+    LOGI("trim http cache, remove %{public}zu files, %{public}zu bytes left", removedCount, totalSize);
+}
+
+bool HttpCache::ParsePolicy(const std::string& headers, int64_t now, HttpCachePolicy& policy)
+{
+    bool noCache = false;
+    bool hasCacheControl = false;
+    int64_t maxAge = -1;
+    int64_t expires = -1;
+    int64_t lastModifiedTime = -1;
+    size_t pos = 0;
+    while (pos < headers.size()) {
+        auto end = headers.find('\n', pos);
+        auto line = headers.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+        pos = (end == std::string::npos) ? headers.size() : end + 1;
+        auto colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        auto name = ToLower(TrimSpace(line.substr(0, colon)));
+        auto value = TrimSpace(line.substr(colon + 1));
+        if (name == "cache-control") {
+            hasCacheControl = true;
+            size_t directivePos = 0;
+            while (directivePos <= value.size()) {
+                auto directiveEnd = value.find(',', directivePos);
+                auto directive = ToLower(TrimSpace(value.substr(directivePos,
+                    directiveEnd == std::string::npos ? std::string::npos : directiveEnd - directivePos)));
+                directivePos = (directiveEnd == std::string::npos) ? value.size() + 1 : directiveEnd + 1;
+                if (directive == "no-store") {
+                    return false;
+                } else if (directive == "no-cache") {
+                    noCache = true;
+                } else if (directive.compare(0, strlen("max-age="), "max-age=") == 0) {
+                    maxAge = std::strtoll(directive.c_str() + strlen("max-age="), nullptr, 10);
+                }
+            }
+        } else if (name == "pragma") {
+            if (!hasCacheControl && ToLower(value) == "no-cache") {
+                noCache = true;
+            }
+        } else if (name == "expires") {
+            // An invalid date means the response is already expired.
+            expires = std::max(static_cast<int64_t>(curl_getdate(value.c_str(), nullptr)), static_cast<int64_t>(0));
+        } else if (name == "etag") {
+            policy.etag = value;
+        } else if (name == "last-modified") {
+            policy.lastModified = value;
+            lastModifiedTime = static_cast<int64_t>(curl_getdate(value.c_str(), nullptr));
+        } else if (name == "vary") {
+            // Entries are keyed by url only, responses varying by request headers cannot be reused.
+            if (ToLower(value) != "accept-encoding") {
+                return false;
+            }
+        }
+    }
+
+    if (noCache) {
+        policy.expireTime = 0;
+    } else if (maxAge >= 0) {
+        policy.expireTime = now + maxAge;
+    } else if (expires >= 0) {
+        policy.expireTime = expires;
+    } else if (lastModifiedTime > 0 && lastModifiedTime < now) {
+        policy.expireTime =
+            now + std::min((now - lastModifiedTime) / HEURISTIC_FRESHNESS_DIVISOR, MAX_HEURISTIC_FRESHNESS);
+    } else {
+        policy.expireTime = 0;
+    }
+    // A stale response is still worth storing if the server can confirm it by a conditional request.
+    return policy.expireTime > now || !policy.etag.empty() || !policy.lastModified.empty();
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_NETWORK_HTTP_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_NETWORK_HTTP_CACHE_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+struct HttpCachePolicy {
+    std::string etag;
+    std::string lastModified;
+    // Seconds since epoch, the response is used without asking the server until then.
+    int64_t expireTime = 0;
+};
+
+struct HttpCacheEntry {
+    HttpCachePolicy policy;
+    // Raw header lines of the cached response.
+    std::string headers;
+    size_t bodySize = 0;
+    // Hash of the body the metadata was written with, a body replaced by another store is not taken for it.
+    uint64_t bodyHash = 0;
+};
+
+// Disk cache of GET responses following ETag, Last-Modified, Expires and Cache-Control of the server.
+// Every response is kept in two files named by the hash of its url, a small metadata file and the body, so the
+// metadata can be refreshed after a 304 without writing the body again. Files are written to unique temporary files
+// and replaced by rename, readers never see a partly written file, and the body is checked against the hash kept in
+// the metadata, so metadata and body of different stores are never paired. When the cache grows over its limit, the
+// least recently used bodies are removed.
+class HttpCache final {
+public:
+    HttpCache() = default;
+    ~HttpCache() = default;
+
+    // The cache is disabled until a directory is set.
+    void SetCacheDir(const std::string& cacheDir);
+    bool IsEnabled() const;
+
+    bool Lookup(const std::string& url, HttpCacheEntry& entry) const;
+    bool ReadBody(const std::string& url, const HttpCacheEntry& entry, std::vector<uint8_t>& body) const;
+
+    void Store(const std::string& url, const HttpCacheEntry& entry, const std::vector<uint8_t>& body);
+    // Updates the metadata of a cached response after the server confirmed it is still valid.
+    void Update(const std::string& url, const HttpCacheEntry& entry);
+    void Remove(const std::string& url);
+
+    // Headers are the raw header lines of one response. Returns false if the response must not be stored.
+    static bool ParsePolicy(const std::string& headers, int64_t now, HttpCachePolicy& policy);
+
+private:
+    std::string GetCacheDir() const;
+    static std::string GetFilePath(const std::string& cacheDir, const std::string& url, const char* suffix);
+    static bool WriteFile(const std::string& filePath, const char* data, size_t size);
+    bool WriteEntry(const std::string& cacheDir, const std::string& url, const HttpCacheEntry& entry);
+    void Trim(const std::string& cacheDir);
+
+    mutable std::mutex mutex_;
+    std::string cacheDir_;
+    size_t bytesSinceTrim_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(HttpCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_NETWORK_HTTP_CACHE_H
@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/network/http_transfer_engine.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <pthread.h>
+#include <strings.h>
+#include <thread>
+#include <unordered_map>
+
+#include "curl/curl.h"
+
+#include "base/log/log.h"
+#include "base/network/http_cache.h"
+#include "base/thread/background_task_executor.h"
+#include "base/utils/singleton.h"
+#include "base/utils/utils.h"
+
+#define ACE_CURL_EASY_SET_OPTION(handle, opt, data)                                                 \
+    do {                                                                                            \
+        CURLcode result = curl_easy_setopt(handle, opt, data);                                      \
+        if (result != CURLE_OK) {                                                                   \
+            LOGE("Failed to set option: %{public}s, %{public}s", #opt, curl_easy_strerror(result)); \
+            return false;                                                                           \
+        }                                                                                           \
+    } while (0)
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr size_t PRIORITY_COUNT = static_cast<size_t>(TransferPriority::COUNT);
+constexpr size_t MAX_ACTIVE_TRANSFERS = 16;
+// The same as common browsers, more connections to one host seldom make it faster.
+constexpr size_t MAX_HOST_TRANSFERS = 6;
+// Idle connections kept for reuse.
+constexpr long MAX_CACHED_CONNECTIONS = 32;
+constexpr int POLL_TIMEOUT_MS = 1000;
+constexpr size_t MAX_CACHED_BODY_SIZE = 4 * 1024 * 1024;
+constexpr long HTTP_OK = 200;
+constexpr long HTTP_NOT_MODIFIED = 304;
+constexpr char HTTP_METHOD_GET[] = "GET";
+constexpr char HTTP_METHOD_HEAD[] = "HEAD";
+constexpr char HTTP_METHOD_POST[] = "POST";
+constexpr char STATUS_LINE_PREFIX[] = "HTTP/";
+
+void SetThreadName()
+{
+#if defined(MAC_PLATFORM) || defined(IOS_PLATFORM)
+    pthread_setname_np("ace.http");
+#elif !defined(WINDOWS_PLATFORM)
+    pthread_setname_np(pthread_self(), "ace.http");
+#endif
+}
+
+int64_t GetNowSeconds()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// Host and port of the url, transfers are bounded by this key.
+std::string GetHost(const std::string& url)
+{
+    auto begin = url.find("://");
+    begin = (begin == std::string::npos) ? 0 : begin + strlen("://");
+    auto end = url.find_first_of("/?#", begin);
+    return url.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+}
+
+bool IsCacheable(const HttpRequest& request)
+{
+    if (!request.useCache || request.method != HTTP_METHOD_GET) {
+        return false;
+    }
+    // Requests with their own validators or cache directives are left to the server, so are partial requests, the
+    // cache only holds whole responses.
+    for (const auto& header : request.headers) {
+        if (strcasecmp(header.first.c_str(), "If-None-Match") == 0 ||
+            strcasecmp(header.first.c_str(), "If-Modified-Since") == 0 ||
+            strcasecmp(header.first.c_str(), "Cache-Control") == 0 ||
+            strcasecmp(header.first.c_str(), "Range") == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Transfer {
+    TransferId id = INVALID_TRANSFER_ID;
+    HttpRequest request;
+    HttpTransferEngine::Callback callback;
+    std::string host;
+    std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> handle { nullptr, &curl_easy_cleanup };
+    std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> headerList { nullptr, &curl_slist_free_all };
+    HttpResponse response;
+    // The cached response is revalidated by the transfer if it has validators.
+    bool revalidate = false;
+    HttpCacheEntry cachedEntry;
+    // Guarded by the mutex of the engine.
+    bool cancelled = false;
+    char errorBuffer[CURL_ERROR_SIZE] = { 0 };
+};
+
+class HttpTransferEngineImpl final : public HttpTransferEngine, public Singleton<HttpTransferEngineImpl> {
+    DECLARE_SINGLETON(HttpTransferEngineImpl);
+    ACE_DISALLOW_MOVE(HttpTransferEngineImpl);
+
+public:
+    TransferId Submit(HttpRequest&& request, Callback&& callback) override
+    {
+        if (!callback) {
+            return INVALID_TRANSFER_ID;
+        }
+        auto transfer = std::make_shared<Transfer>();
+        transfer->request = std::move(request);
+        transfer->callback = std::move(callback);
+        transfer->host = GetHost(transfer->request.url);
+        if (!Initialize()) {
+            transfer->response.error = "failed to initialize curl";
+            Complete(transfer);
+            return INVALID_TRANSFER_ID;
+        }
+
+        if (IsCacheable(transfer->request) && cache_.Lookup(transfer->request.url, transfer->cachedEntry)) {
+            const auto& policy = transfer->cachedEntry.policy;
+            if (policy.expireTime > GetNowSeconds() && CompleteFromCache(*transfer)) {
+                Complete(transfer);
+                return INVALID_TRANSFER_ID;
+            }
+            transfer->revalidate = !policy.etag.empty() || !policy.lastModified.empty();
+        }
+
+        TransferId id = INVALID_TRANSFER_ID;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            id = nextId_++;
+            transfer->id = id;
+            transfers_.emplace(id, transfer);
+            pending_[static_cast<size_t>(transfer->request.priority) % PRIORITY_COUNT].emplace_back(transfer);
+        }
+        WakeUp();
+        return id;
+    }
+
+    void Cancel(TransferId id) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto iter = transfers_.find(id);
+            if (iter == transfers_.end()) {
+                return;
+            }
+            iter->second->cancelled = true;
+            hasCancelled_ = true;
+        }
+        WakeUp();
+    }
+
+    void SetCacheDir(const std::string& cacheDir) override
+    {
+        cache_.SetCacheDir(cacheDir);
+    }
+
+private:
+    bool Initialize()
+    {
+        if (initialized_) {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (initialized_) {
+            return true;
+        }
+        if (curl_global_init(CURL_GLOBAL_ALL) != CURLE_OK) {
+            LOGE("Failed to initialize 'curl'");
+            return false;
+        }
+        multi_ = curl_multi_init();
+        share_ = curl_share_init();
+        if (multi_ == nullptr || share_ == nullptr) {
+            LOGE("Failed to create curl multi or share handle");
+            curl_multi_cleanup(multi_);
+            curl_share_cleanup(share_);
+            multi_ = nullptr;
+            share_ = nullptr;
+            curl_global_cleanup();
+            return false;
+        }
+        // Connections are already shared by the multi handle, DNS results and TLS sessions are shared here.
+        // All handles are used on the transfer thread only, so the share needs no lock.
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(MAX_HOST_TRANSFERS));
+        curl_multi_setopt(multi_, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(MAX_ACTIVE_TRANSFERS));
+        curl_multi_setopt(multi_, CURLMOPT_MAXCONNECTS, MAX_CACHED_CONNECTIONS);
+        thread_ = std::thread(&HttpTransferEngineImpl::ThreadLoop, this);
+        initialized_ = true;
+        return true;
+    }
+
+    void WakeUp()
+    {
+        condition_.notify_one();
+        curl_multi_wakeup(multi_);
+    }
+
+    bool HasPendingTransfers() const
+    {
+        for (const auto& queue : pending_) {
+            if (!queue.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ThreadLoop()
+    {
+        SetThreadName();
+        std::vector<std::shared_ptr<Transfer>> finished;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this] { return !running_ || !active_.empty() || HasPendingTransfers(); });
+                if (!running_) {
+                    break;
+                }
+                if (hasCancelled_) {
+                    hasCancelled_ = false;
+                    TakeCancelledTransfers(finished);
+                }
+                StartPendingTransfers(finished);
+            }
+            for (auto& transfer : finished) {
+                Complete(transfer);
+            }
+            finished.clear();
+
+            int runningHandles = 0;
+            curl_multi_perform(multi_, &runningHandles);
+            ReadFinishedTransfers();
+            if (!active_.empty()) {
+                curl_multi_poll(multi_, nullptr, 0, POLL_TIMEOUT_MS, nullptr);
+            }
+        }
+
+        // Nobody should wait for a transfer which will never run.
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (auto& queue : pending_) {
+            finished.insert(finished.end(), queue.begin(), queue.end());
+            queue.clear();
+        }
+        for (auto& [handle, transfer] : active_) {
+            curl_multi_remove_handle(multi_, handle);
+            finished.emplace_back(transfer);
+        }
+        active_.clear();
+        lock.unlock();
+        for (auto& transfer : finished) {
+            transfer->response.status = TransferStatus::CANCELLED;
+            Complete(transfer);
+        }
+    }
+
+    // Called with mutex_ locked.
+    void TakeCancelledTransfers(std::vector<std::shared_ptr<Transfer>>& finished)
+    {
+        for (auto& queue : pending_) {
+            for (auto iter = queue.begin(); iter != queue.end();) {
+                if ((*iter)->cancelled) {
+                    (*iter)->response.status = TransferStatus::CANCELLED;
+                    finished.emplace_back(*iter);
+                    iter = queue.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+        }
+        for (auto iter = active_.begin(); iter != active_.end();) {
+            if (iter->second->cancelled) {
+                iter->second->response.status = TransferStatus::CANCELLED;
+                finished.emplace_back(iter->second);
+                iter = RemoveActiveTransfer(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+    // Called with mutex_ locked. Transfers which fail to start are moved to finished.
+    void StartPendingTransfers(std::vector<std::shared_ptr<Transfer>>& finished)
+    {
+        for (auto& queue : pending_) {
+            // Transfers to a busy host wait, transfers to other hosts are not blocked by them.
+            for (auto iter = queue.begin(); iter != queue.end() && active_.size() < MAX_ACTIVE_TRANSFERS;) {
+                auto hostIter = hostTransfers_.find((*iter)->host);
+                if (hostIter != hostTransfers_.end() && hostIter->second >= MAX_HOST_TRANSFERS) {
+                    ++iter;
+                    continue;
+                }
+                auto transfer = *iter;
+                iter = queue.erase(iter);
+                if (!StartTransfer(*transfer) || curl_multi_add_handle(multi_, transfer->handle.get()) != CURLM_OK) {
+                    LOGE("Failed to start transfer, url: %{private}s", transfer->request.url.c_str());
+                    transfer->response.error = "failed to start transfer";
+                    finished.emplace_back(transfer);
+                    continue;
+                }
+                ++hostTransfers_[transfer->host];
+                active_.emplace(transfer->handle.get(), transfer);
+            }
+        }
+    }
+
+    using ActiveTransfers = std::unordered_map<CURL*, std::shared_ptr<Transfer>>;
+
+    ActiveTransfers::iterator RemoveActiveTransfer(ActiveTransfers::iterator iter)
+    {
+        curl_multi_remove_handle(multi_, iter->first);
+        auto hostIter = hostTransfers_.find(iter->second->host);
+        if (hostIter != hostTransfers_.end() && --hostIter->second == 0) {
+            hostTransfers_.erase(hostIter);
+        }
+        return active_.erase(iter);
+    }
+
+    bool StartTransfer(Transfer& transfer)
+    {
+        transfer.handle.reset(curl_easy_init());
+        if (!transfer.handle) {
+            LOGE("Failed to create transfer task");
+            return false;
+        }
+        auto* handle = transfer.handle.get();
+        const auto& request = transfer.request;
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_URL, request.url.c_str());
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_SHARE, share_);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_NOSIGNAL, 1L);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_WRITEFUNCTION, OnWritingBody);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_WRITEDATA, &transfer.response.body);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_HEADERFUNCTION, OnWritingHeader);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_HEADERDATA, &transfer.response.headers);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_ERRORBUFFER, transfer.errorBuffer);
+        // Some servers don't like requests that are made without a user-agent field, so we provide one
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_USERAGENT, "libcurl-agent/1.0");
+        // Accept every encoding curl can decode, the body is given out decoded.
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_ACCEPT_ENCODING, "");
+#if !defined(WINDOWS_PLATFORM) and !defined(MAC_PLATFORM)
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_CAINFO, "/etc/ssl/certs/cacert.pem");
+#endif
+#ifdef IOS_PLATFORM
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_SSL_VERIFYPEER, 0L);
+        ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_SSL_VERIFYHOST, 0L);
+#endif
+        if (request.timeoutMs > 0) {
+            ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_TIMEOUT_MS, static_cast<long>(request.timeoutMs));
+        }
+        if (request.connectTimeoutMs > 0) {
+            ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(request.connectTimeoutMs));
+        }
+
+        if (request.method == HTTP_METHOD_HEAD) {
+            ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_NOBODY, 1L);
+        } else if (request.method != HTTP_METHOD_GET) {
+            if (request.method != HTTP_METHOD_POST) {
+                ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_CUSTOMREQUEST, request.method.c_str());
+            }
+            if (request.method == HTTP_METHOD_POST || !request.body.empty()) {
+                // The request outlives the transfer, so the body is not copied by curl.
+                ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_POSTFIELDSIZE, static_cast<long>(request.body.size()));
+                ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_POSTFIELDS, request.body.c_str());
+            }
+        }
+
+        curl_slist* headerList = nullptr;
+        for (const auto& [key, value] : request.headers) {
+            headerList = curl_slist_append(headerList, (key + ":" + value).c_str());
+        }
+        if (transfer.revalidate) {
+            const auto& policy = transfer.cachedEntry.policy;
+            if (!policy.etag.empty()) {
+                headerList = curl_slist_append(headerList, ("If-None-Match: " + policy.etag).c_str());
+            }
+            if (!policy.lastModified.empty()) {
+                headerList = curl_slist_append(headerList, ("If-Modified-Since: " + policy.lastModified).c_str());
+            }
+        }
+        transfer.headerList.reset(headerList);
+        if (headerList != nullptr) {
+            ACE_CURL_EASY_SET_OPTION(handle, CURLOPT_HTTPHEADER, headerList);
+        }
+        return true;
+    }
+
+    void ReadFinishedTransfers()
+    {
+        CURLMsg* message = nullptr;
+        int messagesLeft = 0;
+        while ((message = curl_multi_info_read(multi_, &messagesLeft)) != nullptr) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            // The message is freed when its handle is removed.
+            CURL* handle = message->easy_handle;
+            CURLcode result = message->data.result;
+            std::shared_ptr<Transfer> transfer;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto iter = active_.find(handle);
+                if (iter == active_.end()) {
+                    continue;
+                }
+                transfer = iter->second;
+                RemoveActiveTransfer(iter);
+            }
+            if (FinishTransfer(*transfer, result)) {
+                Complete(transfer);
+            }
+        }
+    }
+
+    // Returns false if the transfer is queued again.
+    bool FinishTransfer(Transfer& transfer, CURLcode result)
+    {
+        auto& response = transfer.response;
+        const auto& url = transfer.request.url;
+        if (result != CURLE_OK) {
+            LOGE("Failed to transfer, url: %{private}s, %{public}s", url.c_str(), curl_easy_strerror(result));
+            response.error = (transfer.errorBuffer[0] != '\0') ? transfer.errorBuffer : curl_easy_strerror(result);
+            response.status = TransferStatus::FAILED;
+            return true;
+        }
+        long code = 0;
+        curl_easy_getinfo(transfer.handle.get(), CURLINFO_RESPONSE_CODE, &code);
+        response.code = static_cast<int32_t>(code);
+        response.status = TransferStatus::SUCCESS;
+
+        if (transfer.revalidate && code == HTTP_NOT_MODIFIED) {
+            HttpCacheEntry entry = transfer.cachedEntry;
+            HttpCachePolicy policy;
+            HttpCache::ParsePolicy(response.headers, GetNowSeconds(), policy);
+            entry.policy.expireTime = policy.expireTime;
+            if (!policy.etag.empty()) {
+                entry.policy.etag = policy.etag;
+            }
+            if (!policy.lastModified.empty()) {
+                entry.policy.lastModified = policy.lastModified;
+            }
+            transfer.cachedEntry = entry;
+            if (!CompleteFromCache(transfer)) {
+                // The cached body is gone, ask for the whole response again.
+                LOGW("cached response is lost, request again, url: %{private}s", url.c_str());
+                cache_.Remove(url);
+                transfer.revalidate = false;
+                transfer.response = HttpResponse();
+                transfer.handle.reset();
+                transfer.headerList.reset();
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto iter = transfers_.find(transfer.id);
+                if (iter == transfers_.end()) {
+                    response.status = TransferStatus::FAILED;
+                    response.error = "cached response is lost";
+                    return true;
+                }
+                pending_[static_cast<size_t>(transfer.request.priority) % PRIORITY_COUNT].emplace_front(iter->second);
+                return false;
+            }
+            BackgroundTaskExecutor::GetInstance().PostTask(
+                [this, url, entry]() { cache_.Update(url, entry); }, BgTaskPriority::LOW);
+            return true;
+        }
+
+        if (code == HTTP_OK && IsCacheable(transfer.request) && response.body.size() <= MAX_CACHED_BODY_SIZE) {
+            HttpCacheEntry entry;
+            if (HttpCache::ParsePolicy(response.headers, GetNowSeconds(), entry.policy)) {
+                entry.headers = response.headers;
+                BackgroundTaskExecutor::GetInstance().PostTask(
+                    [this, url, entry, body = response.body]() { cache_.Store(url, entry, body); },
+                    BgTaskPriority::LOW);
+            }
+        }
+        return true;
+    }
+
+    bool CompleteFromCache(Transfer& transfer)
+    {
+        auto& response = transfer.response;
+        if (!cache_.ReadBody(transfer.request.url, transfer.cachedEntry, response.body)) {
+            return false;
+        }
+        response.status = TransferStatus::SUCCESS;
+        response.code = static_cast<int32_t>(HTTP_OK);
+        response.headers = transfer.cachedEntry.headers;
+        response.fromCache = true;
+        return true;
+    }
+
+    void Complete(const std::shared_ptr<Transfer>& transfer)
+    {
+        if (transfer->id != INVALID_TRANSFER_ID) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            transfers_.erase(transfer->id);
+        }
+        transfer->handle.reset();
+        transfer->headerList.reset();
+        transfer->callback(std::move(transfer->response));
+    }
+
+    static size_t OnWritingBody(void* data, size_t size, size_t memBytes, void* userData)
+    {
+        // size is always 1, for more details see https://curl.haxx.se/libcurl/c/CURLOPT_WRITEFUNCTION.html
+        auto& body = *static_cast<std::vector<uint8_t>*>(userData);
+        auto chunkData = static_cast<uint8_t*>(data);
+        body.insert(body.end(), chunkData, chunkData + memBytes);
+        return memBytes;
+    }
+
+    static size_t OnWritingHeader(void* data, size_t size, size_t memBytes, void* userData)
+    {
+        auto& headers = *static_cast<std::string*>(userData);
+        auto line = static_cast<const char*>(data);
+        // Keep the headers of the last response only, such as the final one after a redirect.
+        const size_t prefixLength = strlen(STATUS_LINE_PREFIX);
+        if (memBytes >= prefixLength && strncmp(line, STATUS_LINE_PREFIX, prefixLength) == 0) {
+            headers.clear();
+        }
+        headers.append(line, memBytes);
+        return memBytes;
+    }
+
+    std::atomic<bool> initialized_ { false };
+    CURLM* multi_ = nullptr;
+    CURLSH* share_ = nullptr;
+    HttpCache cache_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::thread thread_;
+    bool running_ = true;
+    bool hasCancelled_ = false;
+    TransferId nextId_ = INVALID_TRANSFER_ID + 1;
+    std::unordered_map<TransferId, std::shared_ptr<Transfer>> transfers_;
+    std::array<std::deque<std::shared_ptr<Transfer>>, PRIORITY_COUNT> pending_;
+    // Only changed on the transfer thread.
+    ActiveTransfers active_;
+    std::unordered_map<std::string, size_t> hostTransfers_;
+};
+
+HttpTransferEngineImpl::HttpTransferEngineImpl() = default;
+
+HttpTransferEngineImpl::~HttpTransferEngineImpl()
+{
+    if (!initialized_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    WakeUp();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    curl_multi_cleanup(multi_);
+    curl_share_cleanup(share_);
+    curl_global_cleanup();
+}
+
+} // namespace
+
+HttpTransferEngine& HttpTransferEngine::GetInstance()
+{
+    return Singleton<HttpTransferEngineImpl>::GetInstance();
+}
+
+bool HttpTransferEngine::Perform(HttpRequest&& request, HttpResponse& response)
+{
+    std::promise<HttpResponse> promise;
+    auto future = promise.get_future();
+    Submit(std::move(request), [&promise](HttpResponse&& result) { promise.set_value(std::move(result)); });
+    response = future.get();
+    return response.status == TransferStatus::SUCCESS;
+}
+
+} // namespace OHOS::Ace
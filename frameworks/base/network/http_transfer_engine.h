@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_NETWORK_HTTP_TRANSFER_ENGINE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_NETWORK_HTTP_TRANSFER_ENGINE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS::Ace {
+
+// Transfers of a higher priority are started before any transfer of a lower one.
+enum class TransferPriority {
+    HIGH = 0,
+    DEFAULT,
+    LOW,
+    COUNT,
+};
+
+enum class TransferStatus {
+    SUCCESS = 0,
+    FAILED,
+    CANCELLED,
+};
+
+using TransferId = uint64_t;
+constexpr TransferId INVALID_TRANSFER_ID = 0;
+
+struct HttpRequest {
+    std::string url;
+    std::string method = "GET";
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    TransferPriority priority = TransferPriority::DEFAULT;
+    // 0 means no limit.
+    int64_t timeoutMs = 0;
+    int64_t connectTimeoutMs = 0;
+    // Whether a GET may be answered from or stored into the disk cache.
+    bool useCache = true;
+};
+
+struct HttpResponse {
+    TransferStatus status = TransferStatus::FAILED;
+    int32_t code = 0;
+    // Raw header lines of the final response, headers of redirects are dropped.
+    std::string headers;
+    std::vector<uint8_t> body;
+    std::string error;
+    bool fromCache = false;
+};
+
+// Shared HTTP client. All transfers run on one thread through a curl multi handle, so connections, DNS results and
+// TLS sessions are reused between requests, and many transfers progress at the same time without holding a thread
+// each. Transfers to one host and in total are bounded, waiting transfers are started by priority.
+// GET responses are kept in a disk cache once a cache directory is set, see HttpCache.
+class HttpTransferEngine {
+public:
+    // Called once for every submitted transfer, on the transfer thread or, for a response served from the cache
+    // without asking the server, on the thread calling Submit. It must not block.
+    using Callback = std::function<void(HttpResponse&& response)>;
+
+    static HttpTransferEngine& GetInstance();
+
+    virtual ~HttpTransferEngine() = default;
+
+    virtual TransferId Submit(HttpRequest&& request, Callback&& callback) = 0;
+    // The callback gets TransferStatus::CANCELLED unless the transfer is already done.
+    virtual void Cancel(TransferId id) = 0;
+    virtual void SetCacheDir(const std::string& cacheDir) = 0;
+
+    // Submits the transfer and waits for its response.
+    bool Perform(HttpRequest&& request, HttpResponse& response);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_NETWORK_HTTP_TRANSFER_ENGINE_H
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/resource/mapped_file.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sys/stat.h>
+#include <unordered_map>
+#ifndef WINDOWS_PLATFORM
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// Files smaller than this are read into memory instead of mapped.
+constexpr size_t MIN_MAPPED_FILE_SIZE = 16 * 1024;
+// Cached mappings only hold address space and clean pages of page cache, which the system can reclaim at any time.
+constexpr size_t MAX_CACHED_FILE_COUNT = 32;
+constexpr size_t MAX_CACHED_FILE_SIZE = 64 * 1024 * 1024;
+
+struct FileStatus {
+    size_t size = 0;
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    int64_t modifyTime = 0;
+};
+
+bool GetFileStatus(const std::string& filePath, FileStatus& status)
+{
+    struct stat fileStat;
+    if (stat(filePath.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size < 0) {
+        return false;
+    }
+    status.size = static_cast<size_t>(fileStat.st_size);
+    status.device = static_cast<uint64_t>(fileStat.st_dev);
+    status.inode = static_cast<uint64_t>(fileStat.st_ino);
+    status.modifyTime = static_cast<int64_t>(fileStat.st_mtime);
+    return true;
+}
+
+// LRU cache of mapped files by path.
+class MappedFileCache final {
+public:
+    static MappedFileCache& GetInstance()
+    {
+        static MappedFileCache instance;
+        return instance;
+    }
+
+    RefPtr<MappedFile> Get(const std::string& filePath, const std::function<bool(const RefPtr<MappedFile>&)>& isValid)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = index_.find(filePath);
+        if (iter == index_.end()) {
+            return nullptr;
+        }
+        if (!isValid(iter->second->second)) {
+            Erase(iter);
+            return nullptr;
+        }
+        files_.splice(files_.end(), files_, iter->second);
+        return iter->second->second;
+    }
+
+    void Put(const std::string& filePath, const RefPtr<MappedFile>& file)
+    {
+        if (file->GetSize() > MAX_CACHED_FILE_SIZE) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = index_.find(filePath);
+        if (iter != index_.end()) {
+            Erase(iter);
+        }
+        files_.emplace_back(filePath, file);
+        index_.emplace(filePath, std::prev(files_.end()));
+        totalSize_ += file->GetSize();
+        while (!files_.empty() && (files_.size() > MAX_CACHED_FILE_COUNT || totalSize_ > MAX_CACHED_FILE_SIZE)) {
+            Erase(index_.find(files_.front().first));
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        index_.clear();
+        files_.clear();
+        totalSize_ = 0;
+    }
+
+private:
+    using FileList = std::list<std::pair<std::string, RefPtr<MappedFile>>>;
+
+    MappedFileCache() = default;
+    ~MappedFileCache() = default;
+
+    void Erase(std::unordered_map<std::string, FileList::iterator>::iterator iter)
+    {
+        totalSize_ -= iter->second->second->GetSize();
+        files_.erase(iter->second);
+        index_.erase(iter);
+    }
+
+    std::mutex mutex_;
+    FileList files_;
+    std::unordered_map<std::string, FileList::iterator> index_;
+    size_t totalSize_ = 0;
+};
+
+} // namespace
+
+MappedFile::~MappedFile()
+{
+#ifndef WINDOWS_PLATFORM
+    if (mapped_ && mapping_ != nullptr) {
+        munmap(mapping_, size_);
+    }
+#endif
+}
+
+RefPtr<MappedFile> MappedFile::Open(const std::string& filePath, size_t maxSize)
+{
+    FileStatus status;
+    if (!GetFileStatus(filePath, status)) {
+        LOGD("file is not a regular file: %{private}s", filePath.c_str());
+        return nullptr;
+    }
+    if (status.size > maxSize) {
+        LOGE("file is too large, size: %{public}zu", status.size);
+        return nullptr;
+    }
+    auto cached = MappedFileCache::GetInstance().Get(filePath, [&status](const RefPtr<MappedFile>& file) {
+        return file->size_ == status.size && file->device_ == status.device && file->inode_ == status.inode &&
+               file->modifyTime_ == status.modifyTime;
+    });
+    if (cached) {
+        return cached;
+    }
+    auto file = OpenFile(filePath, status.size);
+    if (!file) {
+        return nullptr;
+    }
+    file->device_ = status.device;
+    file->inode_ = status.inode;
+    file->modifyTime_ = status.modifyTime;
+    if (file->mapped_) {
+        MappedFileCache::GetInstance().Put(filePath, file);
+    }
+    return file;
+}
+
+RefPtr<MappedFile> MappedFile::OpenFile(const std::string& filePath, size_t fileSize)
+{
+    auto file = Referenced::Claim(new MappedFile());
+#ifndef WINDOWS_PLATFORM
+    if (fileSize >= MIN_MAPPED_FILE_SIZE) {
+        int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            LOGE("open file failed, fail reason: %{public}s", strerror(errno));
+            return nullptr;
+        }
+        // The mapping keeps the file content reachable after the descriptor is closed.
+        void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapping != MAP_FAILED) {
+            file->mapping_ = mapping;
+            file->size_ = fileSize;
+            file->mapped_ = true;
+            return file;
+        }
+        LOGW("mmap file failed, read it instead, fail reason: %{public}s", strerror(errno));
+    }
+#endif
+    std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filePath.c_str(), "rb"), fclose);
+    if (!fp) {
+        LOGE("open file failed, fail reason: %{public}s", strerror(errno));
+        return nullptr;
+    }
+    std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[fileSize]);
+    if (!buffer) {
+        LOGE("alloc buffer for file failed, size: %{public}zu", fileSize);
+        return nullptr;
+    }
+    if (fread(buffer.get(), 1, fileSize, fp.get()) != fileSize) {
+        LOGE("read file failed");
+        return nullptr;
+    }
+    file->buffer_ = std::move(buffer);
+    file->size_ = fileSize;
+    return file;
+}
+
+void MappedFile::ClearCache()
+{
+    MappedFileCache::GetInstance().Clear();
+}
+
+} // namespace OHOS::Ace
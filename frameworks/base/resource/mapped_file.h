@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_RESOURCE_MAPPED_FILE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_RESOURCE_MAPPED_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "base/resource/asset_manager.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Read-only content of a file shared by reference count.
+// Files large enough are mapped into memory, so readers use the pages of the page cache directly instead of a heap
+// copy, small files are read into a buffer since a mapping costs at least one page and more syscalls.
+// Mappings of recently opened files are kept in a small cache and reused while the file is not changed.
+class ACE_EXPORT MappedFile final : public Asset {
+public:
+    ~MappedFile() override;
+
+    // Returns nullptr if the file cannot be read or is larger than maxSize, an empty file has no content.
+    static RefPtr<MappedFile> Open(const std::string& filePath, size_t maxSize = SIZE_MAX);
+
+    // Drops all cached mappings, mappings still in use are released by their last reference.
+    static void ClearCache();
+
+    size_t GetSize() const override
+    {
+        return size_;
+    }
+
+    const uint8_t* GetData() const override
+    {
+        return mapped_ ? static_cast<const uint8_t*>(mapping_) : buffer_.get();
+    }
+
+    bool IsMapped() const
+    {
+        return mapped_;
+    }
+
+private:
+    MappedFile() = default;
+
+    static RefPtr<MappedFile> OpenFile(const std::string& filePath, size_t fileSize);
+
+    void* mapping_ = nullptr;
+    std::unique_ptr<uint8_t[]> buffer_;
+    size_t size_ = 0;
+    bool mapped_ = false;
+
+    // Identity of the file when it is opened, to check whether a cached mapping is still up to date.
+    uint64_t device_ = 0;
+    uint64_t inode_ = 0;
+    int64_t modifyTime_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(MappedFile);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_RESOURCE_MAPPED_FILE_H
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_document.h"
+#include "base/json/json_util.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string TEST_JSON = "{ \"name\": \"ace\", \"version\": 9, \"ratio\": -1.5e2, \"enabled\": true, "
+                              "\"empty\": null, \"list\": [ 1, \"two\", { \"three\": 3 }, [] ], "
+                              "\"escaped\": \"a\\\"b\\\\c\\n\\u4e2d\\ud83d\\ude00\" }";
+constexpr int32_t VERSION = 9;
+constexpr double RATIO = -150.0;
+constexpr int32_t LIST_SIZE = 4;
+constexpr int32_t MEMBER_COUNT = 64;
+
+// Records every callback as one token.
+class RecordHandler final : public JsonHandler {
+public:
+    bool OnNull() override
+    {
+        tokens.emplace_back("null");
+        return true;
+    }
+    bool OnBool(bool value) override
+    {
+        tokens.emplace_back(value ? "true" : "false");
+        return true;
+    }
+    bool OnNumber(double value) override
+    {
+        tokens.emplace_back(std::to_string(static_cast<int32_t>(value)));
+        return true;
+    }
+    bool OnString(std::string_view value) override
+    {
+        tokens.emplace_back("\"" + std::string(value) + "\"");
+        return true;
+    }
+    bool OnKey(std::string_view key) override
+    {
+        tokens.emplace_back(std::string(key) + ":");
+        return true;
+    }
+    bool OnStartObject() override
+    {
+        tokens.emplace_back("{");
+        return true;
+    }
+    bool OnEndObject() override
+    {
+        tokens.emplace_back("}");
+        return true;
+    }
+    bool OnStartArray() override
+    {
+        tokens.emplace_back("[");
+        return !stopAtArray;
+    }
+    bool OnEndArray() override
+    {
+        tokens.emplace_back("]");
+        return true;
+    }
+
+    std::vector<std::string> tokens;
+    bool stopAtArray = false;
+};
+
+} // namespace
+
+class JsonDocumentTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: JsonDocumentTest001
+ * @tc.desc: Read values of all types from a json document.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonDocumentTest, JsonDocumentTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse the test json.
+     * @tc.expected: step1. the root is a valid object.
+     */
+    auto document = JsonUtil::ParseJsonDocument(std::string(TEST_JSON));
+    ASSERT_TRUE(document->IsValid());
+    auto root = document->GetRoot();
+    ASSERT_TRUE(root.IsObject());
+
+    /**
+     * @tc.steps: step2. read the members.
+     * @tc.expected: step2. values are read as written, missing or mistyped members return the default value.
+     */
+    EXPECT_EQ(root.GetString("name", ""), "ace");
+    EXPECT_EQ(root.GetInt("version", 0), VERSION);
+    EXPECT_EQ(root.GetDouble("ratio", 0.0), RATIO);
+    EXPECT_TRUE(root.GetBool("enabled", false));
+    EXPECT_TRUE(root.GetValue("empty").IsNull());
+    EXPECT_EQ(root.GetValue("escaped").GetString(), "a\"b\\c\n\xE4\xB8\xAD\xF0\x9F\x98\x80");
+    EXPECT_FALSE(root.Contains("missing"));
+    EXPECT_FALSE(root.GetValue("missing").IsValid());
+    EXPECT_EQ(root.GetInt("name", -1), -1);
+    EXPECT_FALSE(root.Contains("Name"));
+
+    /**
+     * @tc.steps: step3. walk the array by index and by GetNext.
+     * @tc.expected: step3. both walks see the same items.
+     */
+    auto list = root.GetValue("list");
+    ASSERT_EQ(list.GetArraySize(), LIST_SIZE);
+    EXPECT_EQ(list.GetArrayItem(1).GetStringView(), "two");
+    EXPECT_EQ(list.GetArrayItem(2).GetInt("three", 0), 3);
+    EXPECT_EQ(list.GetArrayItem(3).GetArraySize(), 0);
+    EXPECT_FALSE(list.GetArrayItem(LIST_SIZE).IsValid());
+    int32_t count = 0;
+    for (auto item = list.GetChild(); item.IsValid(); item = item.GetNext()) {
+        ++count;
+    }
+    EXPECT_EQ(count, LIST_SIZE);
+    EXPECT_EQ(root.GetChild().GetKey(), "name");
+}
+
+/**
+ * @tc.name: JsonDocumentTest002
+ * @tc.desc: Look up members of a large object, and reject invalid json.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonDocumentTest, JsonDocumentTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse an object with many members, the first key is repeated at the end.
+     * @tc.expected: step1. every member is found and the first of repeated keys wins.
+     */
+    std::string json = "{";
+    for (int32_t i = 0; i < MEMBER_COUNT; ++i) {
+        json += "\"key" + std::to_string(i) + "\": " + std::to_string(i) + ", ";
+    }
+    json += "\"key0\": -1 }";
+    auto document = JsonUtil::ParseJsonDocument(std::move(json));
+    ASSERT_TRUE(document->IsValid());
+    auto root = document->GetRoot();
+    EXPECT_EQ(root.GetArraySize(), MEMBER_COUNT + 1);
+    for (int32_t i = 0; i < MEMBER_COUNT; ++i) {
+        EXPECT_EQ(root.GetInt("key" + std::to_string(i), -1), i);
+    }
+
+    /**
+     * @tc.steps: step2. parse invalid json.
+     * @tc.expected: step2. the document is invalid and its root is an invalid node.
+     */
+    const std::vector<std::string> invalidJsons = { "", "{", "[1,]", "{\"a\" 1}", "\"abc", "tru", "1 2", "{} x",
+        "\"\\ud83d\"", "\"\\x\"", "+1", "01", ".5", "1.", "-", "1e", "1e+", "[-.5]", "0x1" };
+    for (const auto& invalidJson : invalidJsons) {
+        auto invalidDocument = JsonUtil::ParseJsonDocument(std::string(invalidJson));
+        EXPECT_FALSE(invalidDocument->IsValid()) << invalidJson;
+        EXPECT_FALSE(invalidDocument->GetRoot().IsValid());
+    }
+
+    /**
+     * @tc.steps: step3. parse invalid json and get the offset where the parsing stopped.
+     * @tc.expected: step3. the offset is at the first character which breaks the json grammar.
+     */
+    const std::vector<std::pair<std::string, size_t>> errorOffsets = { { "{\"a\" 1}", 5 }, { "[1, 01]", 5 },
+        { "[1.]", 3 }, { "[1, 2] x", 7 } };
+    for (const auto& [invalidJson, offset] : errorOffsets) {
+        auto invalidDocument = JsonUtil::ParseJsonDocument(std::string(invalidJson));
+        EXPECT_FALSE(invalidDocument->IsValid()) << invalidJson;
+        EXPECT_EQ(invalidDocument->GetErrorOffset(), offset) << invalidJson;
+    }
+
+    /**
+     * @tc.steps: step4. parse numbers of all forms in the json grammar.
+     * @tc.expected: step4. the values are right.
+     */
+    auto numbers = JsonUtil::ParseJsonDocument("[-0, 0.5, -1.5e+2, 1E2, 2e-1]");
+    ASSERT_TRUE(numbers->IsValid());
+    const std::vector<double> values = { 0.0, 0.5, -150.0, 100.0, 0.2 };
+    ASSERT_EQ(numbers->GetRoot().GetArraySize(), static_cast<int32_t>(values.size()));
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_DOUBLE_EQ(numbers->GetRoot().GetArrayItem(static_cast<int32_t>(i)).GetDouble(), values[i]);
+    }
+}
+
+/**
+ * @tc.name: JsonDocumentTest003
+ * @tc.desc: Stream values of a json text to a handler.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonDocumentTest, JsonDocumentTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. stream a json text.
+     * @tc.expected: step1. the handler gets the values in order.
+     */
+    RecordHandler handler;
+    EXPECT_TRUE(JsonUtil::ParseJsonStream("{\"a\": [1, true, null], \"b\": {\"c\": \"d\"}}", handler));
+    const std::vector<std::string> expected = { "{", "a:", "[", "1", "true", "null", "]", "b:", "{", "c:", "\"d\"",
+        "}", "}" };
+    EXPECT_EQ(handler.tokens, expected);
+
+    /**
+     * @tc.steps: step2. stop streaming from the handler.
+     * @tc.expected: step2. parsing fails and no more values are passed.
+     */
+    RecordHandler stopHandler;
+    stopHandler.stopAtArray = true;
+    EXPECT_FALSE(JsonUtil::ParseJsonStream("{\"a\": [1, 2]}", stopHandler));
+    const std::vector<std::string> stopped = { "{", "a:", "[" };
+    EXPECT_EQ(stopHandler.tokens, stopped);
+}
+
+} // namespace OHOS::Ace
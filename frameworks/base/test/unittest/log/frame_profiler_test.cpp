@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "base/log/frame_profiler.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr uint64_t LINEAR_MAX = 15;
+constexpr uint64_t LARGE_VALUE = 1000;
+constexpr uint64_t VALUE_COUNT = 100;
+// Values are reported as the lower bound of their bucket, at most 1/8 below.
+constexpr double BUCKET_ERROR = 0.125;
+constexpr int64_t PHASE_NANOS = 2000000;
+constexpr uint32_t PHASE_MICROS = 2000;
+constexpr uint64_t EXTRA_FRAMES = 3;
+constexpr auto OUTER_SLEEP = std::chrono::milliseconds(2);
+constexpr auto INNER_SLEEP = std::chrono::milliseconds(10);
+constexpr uint32_t OUTER_MICROS = 2000;
+constexpr uint32_t INNER_MICROS = 10000;
+constexpr uint64_t CONCURRENT_FRAMES = 100000;
+constexpr int64_t NANOS_PER_MICRO = 1000;
+
+uint32_t GetPhaseMicros(const FrameRecord& record, FramePhase phase)
+{
+    return record.phaseMicros[static_cast<size_t>(phase)];
+}
+
+} // namespace
+
+class FrameProfilerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: FrameProfiler001
+ * @tc.desc: Latency histograms report counts, mean, max and percentiles.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameProfilerTest, FrameProfiler001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record small values.
+     * @tc.expected: step1. they are reported exactly.
+     */
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0u);
+    for (uint64_t value = 0; value <= LINEAR_MAX; ++value) {
+        histogram.Record(value);
+    }
+    EXPECT_EQ(histogram.GetCount(), LINEAR_MAX + 1);
+    EXPECT_EQ(histogram.GetMax(), LINEAR_MAX);
+    EXPECT_EQ(histogram.GetPercentile(0.0), 0u);
+    EXPECT_EQ(histogram.GetPercentile(100.0), LINEAR_MAX);
+
+    /**
+     * @tc.steps: step2. record a large value.
+     * @tc.expected: step2. it is reported within the bucket error, max and mean are exact.
+     */
+    histogram.Reset();
+    histogram.Record(LARGE_VALUE);
+    EXPECT_EQ(histogram.GetMax(), LARGE_VALUE);
+    EXPECT_EQ(histogram.GetMean(), LARGE_VALUE);
+    EXPECT_LE(histogram.GetPercentile(50.0), LARGE_VALUE);
+    EXPECT_GE(histogram.GetPercentile(50.0), LARGE_VALUE * (1.0 - BUCKET_ERROR));
+
+    /**
+     * @tc.steps: step3. record 1 to 100.
+     * @tc.expected: step3. the median and p90 are within the bucket error.
+     */
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    for (uint64_t value = 1; value <= VALUE_COUNT; ++value) {
+        histogram.Record(value);
+    }
+    EXPECT_EQ(histogram.GetMean(), (VALUE_COUNT + 1) / 2);
+    EXPECT_LE(histogram.GetPercentile(50.0), 50u);
+    EXPECT_GE(histogram.GetPercentile(50.0), 50 * (1.0 - BUCKET_ERROR));
+    EXPECT_LE(histogram.GetPercentile(90.0), 90u);
+    EXPECT_GE(histogram.GetPercentile(90.0), 90 * (1.0 - BUCKET_ERROR));
+}
+
+/**
+ * @tc.name: FrameProfiler002
+ * @tc.desc: Frames are kept in the ring buffer, aggregated and counted as jank.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameProfilerTest, FrameProfiler002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record more frames than the ring buffer holds, each with build time, over a zero budget.
+     * @tc.expected: step1. the latest frames are kept oldest first, every frame is jank.
+     */
+    FrameProfiler profiler;
+    profiler.SetFrameBudget(0);
+    uint64_t frameCount = FrameProfiler::RECENT_FRAME_COUNT + EXTRA_FRAMES;
+    for (uint64_t vsyncTime = 0; vsyncTime < frameCount; ++vsyncTime) {
+        profiler.BeginFrame(vsyncTime);
+        EXPECT_TRUE(profiler.IsInFrame());
+        profiler.AddPhaseTime(FramePhase::BUILD, PHASE_NANOS);
+        profiler.EndFrame();
+    }
+    EXPECT_FALSE(profiler.IsInFrame());
+    EXPECT_EQ(profiler.GetFrameCount(), frameCount);
+    EXPECT_EQ(profiler.GetJankCount(), frameCount);
+    std::vector<FrameRecord> frames;
+    profiler.GetRecentFrames(frames);
+    ASSERT_EQ(frames.size(), FrameProfiler::RECENT_FRAME_COUNT);
+    EXPECT_EQ(frames.front().vsyncTime, EXTRA_FRAMES);
+    EXPECT_EQ(frames.back().vsyncTime, frameCount - 1);
+    EXPECT_EQ(GetPhaseMicros(frames.back(), FramePhase::BUILD), PHASE_MICROS);
+    EXPECT_EQ(GetPhaseMicros(frames.back(), FramePhase::LAYOUT), 0u);
+    EXPECT_EQ(profiler.GetPhaseHistogram(FramePhase::BUILD).GetCount(), frameCount);
+    EXPECT_EQ(profiler.GetPhaseHistogram(FramePhase::BUILD).GetMax(), PHASE_MICROS);
+
+    /**
+     * @tc.steps: step2. dump, then reset.
+     * @tc.expected: step2. there is a line for the frames, the frame time and every phase, counts are cleared.
+     */
+    std::vector<std::string> lines;
+    profiler.Dump(lines);
+    EXPECT_EQ(lines.size(), FRAME_PHASE_COUNT + 2);
+    profiler.Reset();
+    EXPECT_EQ(profiler.GetFrameCount(), 0u);
+    EXPECT_EQ(profiler.GetJankCount(), 0u);
+    EXPECT_EQ(profiler.GetFrameHistogram().GetCount(), 0u);
+    profiler.GetRecentFrames(frames);
+    EXPECT_TRUE(frames.empty());
+
+    /**
+     * @tc.steps: step3. record a frame with the profiler disabled.
+     * @tc.expected: step3. nothing is recorded.
+     */
+    profiler.SetEnabled(false);
+    profiler.BeginFrame(0);
+    EXPECT_FALSE(profiler.IsInFrame());
+    profiler.AddPhaseTime(FramePhase::BUILD, PHASE_NANOS);
+    profiler.EndFrame();
+    EXPECT_EQ(profiler.GetFrameCount(), 0u);
+}
+
+/**
+ * @tc.name: FrameProfiler003
+ * @tc.desc: Time of a phase nested in another one is counted for the nested phase only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameProfilerTest, FrameProfiler003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. run a phase outside of a frame.
+     * @tc.expected: step1. it is not recorded.
+     */
+    FrameProfiler profiler;
+    {
+        FrameProfiler::ScopedPhase phase(profiler, FramePhase::LAYOUT);
+    }
+    EXPECT_EQ(profiler.GetFrameCount(), 0u);
+
+    /**
+     * @tc.steps: step2. run layout inside post flush in a frame.
+     * @tc.expected: step2. post flush does not include the layout time, phases add up to at most the frame time.
+     */
+    profiler.BeginFrame(0);
+    {
+        FrameProfiler::ScopedPhase postFlush(profiler, FramePhase::POST_FLUSH);
+        std::this_thread::sleep_for(OUTER_SLEEP);
+        {
+            FrameProfiler::ScopedPhase layout(profiler, FramePhase::LAYOUT);
+            std::this_thread::sleep_for(INNER_SLEEP);
+        }
+    }
+    profiler.EndFrame();
+    std::vector<FrameRecord> frames;
+    profiler.GetRecentFrames(frames);
+    ASSERT_EQ(frames.size(), 1u);
+    auto layoutMicros = GetPhaseMicros(frames[0], FramePhase::LAYOUT);
+    auto postFlushMicros = GetPhaseMicros(frames[0], FramePhase::POST_FLUSH);
+    EXPECT_GE(layoutMicros, INNER_MICROS);
+    EXPECT_GE(postFlushMicros, OUTER_MICROS);
+    EXPECT_LT(postFlushMicros, INNER_MICROS);
+    EXPECT_LE(layoutMicros + postFlushMicros, frames[0].totalMicros);
+}
+
+/**
+ * @tc.name: FrameProfiler004
+ * @tc.desc: Recent frames read while the UI thread records frames are never torn.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameProfilerTest, FrameProfiler004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record frames on another thread, the build time of each frame in micros is its vsync time.
+     */
+    FrameProfiler profiler;
+    std::atomic<bool> finished { false };
+    std::thread uiThread([&profiler, &finished]() {
+        for (uint64_t vsyncTime = 0; vsyncTime < CONCURRENT_FRAMES; ++vsyncTime) {
+            profiler.BeginFrame(vsyncTime);
+            profiler.AddPhaseTime(FramePhase::BUILD, static_cast<int64_t>(vsyncTime) * NANOS_PER_MICRO);
+            profiler.EndFrame();
+        }
+        finished = true;
+    });
+
+    /**
+     * @tc.steps: step2. read the recent frames until all frames are recorded.
+     * @tc.expected: step2. every frame read is whole and frames are read oldest first.
+     */
+    std::vector<FrameRecord> frames;
+    bool isWhole = true;
+    bool isOrdered = true;
+    while (!finished) {
+        profiler.GetRecentFrames(frames);
+        for (size_t i = 0; i < frames.size(); ++i) {
+            isWhole = isWhole && GetPhaseMicros(frames[i], FramePhase::BUILD) == frames[i].vsyncTime;
+            isOrdered = isOrdered && (i == 0 || frames[i - 1].vsyncTime < frames[i].vsyncTime);
+        }
+    }
+    uiThread.join();
+    EXPECT_TRUE(isWhole);
+    EXPECT_TRUE(isOrdered);
+    profiler.GetRecentFrames(frames);
+    ASSERT_EQ(frames.size(), FrameProfiler::RECENT_FRAME_COUNT);
+    EXPECT_EQ(frames.back().vsyncTime, CONCURRENT_FRAMES - 1);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "base/memory/ace_type.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+class TestBaseType : public virtual AceType {
+    DECLARE_ACE_TYPE(TestBaseType, AceType);
+};
+
+class TestOtherType : public virtual AceType {
+    DECLARE_ACE_TYPE(TestOtherType, AceType);
+};
+
+class TestDerivedType : public TestBaseType {
+    DECLARE_ACE_TYPE(TestDerivedType, TestBaseType);
+};
+
+class TestMultipleType final : public TestDerivedType, public TestOtherType {
+    DECLARE_ACE_TYPE(TestMultipleType, TestDerivedType, TestOtherType);
+};
+
+// Type ids are hashed from the class names at compile time, each class must get its own.
+static_assert(TestBaseType::TypeId() != AceType::TypeId() && TestBaseType::TypeId() != TypeInfoBase::TypeId(),
+    "type ids of a class and its bases must differ");
+static_assert(TestDerivedType::TypeId() != TestBaseType::TypeId() && TestDerivedType::TypeId() != AceType::TypeId(),
+    "type ids of a class and its bases must differ");
+static_assert(TestOtherType::TypeId() != TestBaseType::TypeId() && TestOtherType::TypeId() != TestDerivedType::TypeId(),
+    "type ids of sibling classes must differ");
+static_assert(TestMultipleType::TypeId() != TestDerivedType::TypeId() &&
+                  TestMultipleType::TypeId() != TestOtherType::TypeId(),
+    "type ids of a class and its bases must differ");
+
+// The mask of a class holds the masks of all its bases, so casts to any of them are not pruned.
+static_assert((TestDerivedType::TypeMask() & TestBaseType::TypeMask()) == TestBaseType::TypeMask(),
+    "mask of a derived class must contain the mask of its base");
+static_assert(TypeInfoBase::MayBeTypeOf(TestDerivedType::TypeMask(), TestBaseType::TypeId()) &&
+                  TypeInfoBase::MayBeTypeOf(TestDerivedType::TypeMask(), AceType::TypeId()),
+    "derived class must be castable to its bases");
+static_assert(TypeInfoBase::MayBeTypeOf(TestMultipleType::TypeMask(), TestBaseType::TypeId()) &&
+                  TypeInfoBase::MayBeTypeOf(TestMultipleType::TypeMask(), TestOtherType::TypeId()),
+    "class must be castable to the bases of all its parents");
+
+} // namespace
+
+class AceTypeTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: AceType001
+ * @tc.desc: An instance is cast to its own type and to its bases, not to a derived or unrelated type.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceType001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. cast a derived instance held by its base type.
+     * @tc.expected: step1. it is an instance of itself and of its bases, and not of an unrelated type.
+     */
+    RefPtr<TestBaseType> derived = AceType::MakeRefPtr<TestDerivedType>();
+    EXPECT_TRUE(AceType::InstanceOf<TestDerivedType>(derived));
+    EXPECT_TRUE(AceType::InstanceOf<TestBaseType>(derived));
+    EXPECT_TRUE(AceType::InstanceOf<AceType>(derived));
+    EXPECT_FALSE(AceType::InstanceOf<TestOtherType>(derived));
+    EXPECT_FALSE(AceType::InstanceOf<TestMultipleType>(derived));
+    EXPECT_EQ(AceType::TypeId(derived), TestDerivedType::TypeId());
+
+    /**
+     * @tc.steps: step2. cast a base instance.
+     * @tc.expected: step2. it is not an instance of a class derived from it.
+     */
+    RefPtr<AceType> base = AceType::MakeRefPtr<TestBaseType>();
+    EXPECT_TRUE(AceType::InstanceOf<TestBaseType>(base));
+    EXPECT_FALSE(AceType::DynamicCast<TestDerivedType>(base));
+}
+
+/**
+ * @tc.name: AceType002
+ * @tc.desc: An instance with several parents is cast to each of them, and back from each of them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceType002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. cast an instance with two parents to both of them.
+     * @tc.expected: step1. both casts point into the same instance.
+     */
+    auto multiple = AceType::MakeRefPtr<TestMultipleType>();
+    auto derived = AceType::DynamicCast<TestDerivedType>(multiple);
+    auto other = AceType::DynamicCast<TestOtherType>(multiple);
+    ASSERT_TRUE(derived);
+    ASSERT_TRUE(other);
+    EXPECT_EQ(AceType::RawPtr(derived), static_cast<TestDerivedType*>(AceType::RawPtr(multiple)));
+    EXPECT_EQ(AceType::RawPtr(other), static_cast<TestOtherType*>(AceType::RawPtr(multiple)));
+
+    /**
+     * @tc.steps: step2. cast back from each parent, and across them.
+     * @tc.expected: step2. every cast finds the same instance.
+     */
+    EXPECT_EQ(AceType::DynamicCast<TestMultipleType>(other), multiple);
+    EXPECT_EQ(AceType::DynamicCast<TestMultipleType>(derived), multiple);
+    EXPECT_EQ(AceType::DynamicCast<TestOtherType>(derived), other);
+    EXPECT_EQ(AceType::DynamicCast<TestBaseType>(other), AceType::DynamicCast<TestBaseType>(multiple));
+}
+
+} // namespace OHOS::Ace
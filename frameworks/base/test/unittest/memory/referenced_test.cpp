@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "base/memory/referenced.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t THREAD_COUNT = 8;
+constexpr int32_t LOOP_COUNT = 10000;
+constexpr int32_t RELEASE_ROUNDS = 200;
+
+std::atomic<int32_t> g_destroyedCount { 0 };
+bool g_upgradedInDestructor = false;
+bool g_invalidInDestructor = false;
+
+class TestReferenced : public virtual Referenced {
+public:
+    explicit TestReferenced(bool threadSafe = true) : Referenced(threadSafe) {}
+    ~TestReferenced() override
+    {
+        ++g_destroyedCount;
+    }
+};
+
+class TestBase : public virtual Referenced {
+public:
+    int32_t baseValue = 0;
+};
+
+class TestOther : public virtual Referenced {
+public:
+    int32_t otherValue = 0;
+};
+
+class TestDerived final : public TestBase, public TestOther {};
+
+// Upgrades a weak reference of itself while it is being destroyed.
+class SelfUpgrading final : public Referenced {
+public:
+    ~SelfUpgrading() override
+    {
+        g_upgradedInDestructor = (self.Upgrade() != nullptr);
+        g_invalidInDestructor = self.Invalid();
+    }
+
+    WeakPtr<SelfUpgrading> self;
+};
+
+// Kept alive when its strong count drops to zero for the first time.
+class KeptOnce final : public Referenced {
+public:
+    bool MaybeRelease() override
+    {
+        if (kept) {
+            return true;
+        }
+        kept = true;
+        return false;
+    }
+
+    bool kept = false;
+};
+
+} // namespace
+
+class ReferencedTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        g_destroyedCount = 0;
+    }
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: Referenced001
+ * @tc.desc: Strong references keep an instance alive until the last one is released.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ReferencedTest, Referenced001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. copy and move strong references of a thread safe and a thread unsafe instance.
+     * @tc.expected: step1. the strong count follows the references, no weak counter is allocated.
+     */
+    for (bool threadSafe : { true, false }) {
+        auto ptr = Referenced::MakeRefPtr<TestReferenced>(threadSafe);
+        EXPECT_EQ(ptr->refCount_.load(), 1);
+        auto copy = ptr;
+        EXPECT_EQ(ptr->refCount_.load(), 2);
+        auto moved = std::move(copy);
+        EXPECT_EQ(ptr->refCount_.load(), 2);
+        EXPECT_EQ(copy, nullptr);
+        EXPECT_EQ(ptr->PeekWeakRefCounter(), nullptr);
+
+        /**
+         * @tc.steps: step2. release the references one by one.
+         * @tc.expected: step2. the instance is destroyed with the last reference.
+         */
+        moved.Reset();
+        EXPECT_EQ(g_destroyedCount, 0);
+        ptr.Reset();
+        EXPECT_EQ(g_destroyedCount, 1);
+        g_destroyedCount = 0;
+    }
+
+    /**
+     * @tc.steps: step3. reference one instance by its different bases.
+     * @tc.expected: step3. the references are equal and ordered the same.
+     */
+    auto derived = Referenced::MakeRefPtr<TestDerived>();
+    RefPtr<TestBase> base = derived;
+    RefPtr<TestOther> other = derived;
+    EXPECT_TRUE(base == other);
+    EXPECT_FALSE(base < other || other < base);
+    EXPECT_EQ(derived->refCount_.load(), 3);
+}
+
+/**
+ * @tc.name: Referenced002
+ * @tc.desc: Weak references upgrade only while the instance is alive.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ReferencedTest, Referenced002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. take weak references of an instance.
+     * @tc.expected: step1. they don't keep it alive, upgrade to it and compare equal to it.
+     */
+    auto ptr = Referenced::MakeRefPtr<TestReferenced>();
+    WeakPtr<TestReferenced> weak = ptr;
+    ASSERT_NE(ptr->PeekWeakRefCounter(), nullptr);
+    WeakPtr<Referenced> baseWeak = weak;
+    EXPECT_EQ(ptr->refCount_.load(), 1);
+    EXPECT_TRUE(weak == ptr);
+    EXPECT_TRUE(baseWeak == weak);
+    EXPECT_FALSE(weak.Invalid());
+    auto upgraded = weak.Upgrade();
+    EXPECT_EQ(upgraded, ptr);
+    EXPECT_EQ(ptr->refCount_.load(), 2);
+
+    /**
+     * @tc.steps: step2. release all strong references.
+     * @tc.expected: step2. the instance is destroyed, weak references are invalid and don't upgrade.
+     */
+    upgraded.Reset();
+    ptr.Reset();
+    EXPECT_EQ(g_destroyedCount, 1);
+    EXPECT_TRUE(weak.Invalid());
+    EXPECT_EQ(weak.Upgrade(), nullptr);
+    EXPECT_EQ(baseWeak.Upgrade(), nullptr);
+
+    /**
+     * @tc.steps: step3. keep an instance alive at zero strong references, then reference it again.
+     * @tc.expected: step3. old weak references upgrade again once it is referenced.
+     */
+    auto keptOnce = new KeptOnce();
+    auto kept = Referenced::Claim(keptOnce);
+    WeakPtr<KeptOnce> keptWeak = kept;
+    kept.Reset();
+    EXPECT_EQ(keptWeak.Upgrade(), nullptr);
+    kept = Referenced::Claim(keptOnce);
+    EXPECT_EQ(keptWeak.Upgrade(), kept);
+}
+
+/**
+ * @tc.name: Referenced003
+ * @tc.desc: Weak references of an instance being destroyed don't upgrade.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ReferencedTest, Referenced003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. release an instance which upgrades a weak reference of itself in its destructor.
+     * @tc.expected: step1. the weak reference is invalid and doesn't upgrade, and stays so after the release.
+     */
+    g_upgradedInDestructor = true;
+    g_invalidInDestructor = false;
+    auto ptr = Referenced::MakeRefPtr<SelfUpgrading>();
+    WeakPtr<SelfUpgrading> weak = ptr;
+    ptr->self = weak;
+    ptr.Reset();
+    EXPECT_FALSE(g_upgradedInDestructor);
+    EXPECT_TRUE(g_invalidInDestructor);
+    EXPECT_EQ(weak.Upgrade(), nullptr);
+    EXPECT_TRUE(weak.Invalid());
+}
+
+/**
+ * @tc.name: Referenced004
+ * @tc.desc: Strong and weak references are changed from many threads at the same time.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ReferencedTest, Referenced004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. copy, upgrade and release references of one instance on many threads.
+     * @tc.expected: step1. only the references of the test remain at last.
+     */
+    auto ptr = Referenced::MakeRefPtr<TestReferenced>();
+    WeakPtr<TestReferenced> weak = ptr;
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_COUNT; ++i) {
+        threads.emplace_back([&ptr, &weak] {
+            for (int32_t j = 0; j < LOOP_COUNT; ++j) {
+                RefPtr<TestReferenced> copy = ptr;
+                WeakPtr<TestReferenced> weakCopy = copy;
+                auto upgraded = weak.Upgrade();
+                EXPECT_NE(upgraded, nullptr);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(ptr->refCount_.load(), 1);
+    EXPECT_EQ(g_destroyedCount, 0);
+
+    /**
+     * @tc.steps: step2. release the last strong reference while other threads upgrade weak references.
+     * @tc.expected: step2. every instance is destroyed exactly once, upgrades after that fail.
+     */
+    for (int32_t round = 0; round < RELEASE_ROUNDS; ++round) {
+        auto released = Referenced::MakeRefPtr<TestReferenced>();
+        WeakPtr<TestReferenced> releasedWeak = released;
+        std::atomic<bool> start { false };
+        std::vector<std::thread> upgraders;
+        for (int32_t i = 0; i < THREAD_COUNT; ++i) {
+            upgraders.emplace_back([&releasedWeak, &start] {
+                while (!start.load()) {}
+                for (int32_t j = 0; j < THREAD_COUNT; ++j) {
+                    auto upgraded = releasedWeak.Upgrade();
+                }
+            });
+        }
+        start = true;
+        released.Reset();
+        for (auto& thread : upgraders) {
+            thread.join();
+        }
+        EXPECT_EQ(releasedWeak.Upgrade(), nullptr);
+    }
+    EXPECT_EQ(g_destroyedCount, RELEASE_ROUNDS);
+}
+
+} // namespace OHOS::Ace
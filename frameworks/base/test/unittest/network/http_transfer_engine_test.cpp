@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <limits>
+#include <mutex>
+#include <sys/stat.h>
+
+#include "gtest/gtest.h"
+
+#include "base/network/http_cache.h"
+#include "base/network/http_transfer_engine.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string TEST_DIR = "/data/test/resource/httptransfer";
+const std::string TEST_FILE = TEST_DIR + "/content.txt";
+const std::string TEST_CACHE_DIR = TEST_DIR + "/cache";
+const std::string TEST_URL = "http://127.0.0.1/image.png";
+const std::string TEST_CONTENT = "http transfer engine test content";
+const std::string OTHER_CONTENT = "other content of the same url";
+constexpr int64_t NOW = 1650000000;
+constexpr int64_t MAX_AGE = 600;
+constexpr int32_t TRANSFER_COUNT = 32;
+constexpr int32_t HTTP_OK = 200;
+
+} // namespace
+
+class HttpTransferEngineTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+void HttpTransferEngineTest::SetUpTestCase()
+{
+    mkdir(TEST_DIR.c_str(), S_IRWXU);
+    FILE* file = fopen(TEST_FILE.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(TEST_CONTENT.data(), 1, TEST_CONTENT.size(), file);
+    fclose(file);
+}
+
+void HttpTransferEngineTest::TearDownTestCase()
+{
+    remove(TEST_FILE.c_str());
+}
+
+/**
+ * @tc.name: HttpCachePolicy001
+ * @tc.desc: Parse cache policies from response headers.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HttpTransferEngineTest, HttpCachePolicy001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse a response with max-age and ETag.
+     * @tc.expected: step1. it is stored and fresh for max-age.
+     */
+    HttpCachePolicy policy;
+    std::string headers = "HTTP/1.1 200 OK\r\nCache-Control: public, max-age=600\r\nETag: \"abc\"\r\n\r\n";
+    EXPECT_TRUE(HttpCache::ParsePolicy(headers, NOW, policy));
+    EXPECT_EQ(policy.expireTime, NOW + MAX_AGE);
+    EXPECT_EQ(policy.etag, "\"abc\"");
+
+    /**
+     * @tc.steps: step2. parse a response with no-cache and Last-Modified.
+     * @tc.expected: step2. it is stored but must be revalidated.
+     */
+    HttpCachePolicy noCachePolicy;
+    headers = "HTTP/1.1 200 OK\r\ncache-control: no-cache\r\nLast-Modified: Mon, 04 Apr 2022 08:00:00 GMT\r\n\r\n";
+    EXPECT_TRUE(HttpCache::ParsePolicy(headers, NOW, noCachePolicy));
+    EXPECT_EQ(noCachePolicy.expireTime, 0);
+    EXPECT_FALSE(noCachePolicy.lastModified.empty());
+
+    /**
+     * @tc.steps: step3. parse responses with no-store, with Vary and without validators.
+     * @tc.expected: step3. none of them is stored.
+     */
+    HttpCachePolicy otherPolicy;
+    EXPECT_FALSE(HttpCache::ParsePolicy("Cache-Control: no-store, max-age=600\r\n", NOW, otherPolicy));
+    EXPECT_FALSE(HttpCache::ParsePolicy("Cache-Control: max-age=600\r\nVary: Cookie\r\n", NOW, otherPolicy));
+    EXPECT_FALSE(HttpCache::ParsePolicy("Content-Type: image/png\r\n", NOW, otherPolicy));
+}
+
+/**
+ * @tc.name: HttpCacheStore001
+ * @tc.desc: Store, read and update a cached response.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HttpTransferEngineTest, HttpCacheStore001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. store a response into the cache.
+     */
+    HttpCache cache;
+    cache.SetCacheDir(TEST_CACHE_DIR);
+    HttpCacheEntry entry;
+    entry.policy.etag = "\"abc\"";
+    entry.policy.expireTime = NOW;
+    entry.headers = "HTTP/1.1 200 OK\r\n\r\n";
+    std::vector<uint8_t> body(TEST_CONTENT.begin(), TEST_CONTENT.end());
+    cache.Store(TEST_URL, entry, body);
+
+    /**
+     * @tc.steps: step2. look up the response and read its body.
+     * @tc.expected: step2. the metadata and the body are the same as stored.
+     */
+    HttpCacheEntry cachedEntry;
+    ASSERT_TRUE(cache.Lookup(TEST_URL, cachedEntry));
+    EXPECT_EQ(cachedEntry.policy.etag, entry.policy.etag);
+    EXPECT_EQ(cachedEntry.policy.expireTime, entry.policy.expireTime);
+    EXPECT_EQ(cachedEntry.headers, entry.headers);
+    std::vector<uint8_t> cachedBody;
+    ASSERT_TRUE(cache.ReadBody(TEST_URL, cachedEntry, cachedBody));
+    EXPECT_EQ(cachedBody, body);
+
+    /**
+     * @tc.steps: step3. update the expire time, then remove the response.
+     * @tc.expected: step3. the new expire time is read back, and nothing is found after removed.
+     */
+    cachedEntry.policy.expireTime = NOW + MAX_AGE;
+    cache.Update(TEST_URL, cachedEntry);
+    HttpCacheEntry updatedEntry;
+    ASSERT_TRUE(cache.Lookup(TEST_URL, updatedEntry));
+    EXPECT_EQ(updatedEntry.policy.expireTime, NOW + MAX_AGE);
+    cache.Remove(TEST_URL);
+    EXPECT_FALSE(cache.Lookup(TEST_URL, updatedEntry));
+}
+
+/**
+ * @tc.name: HttpCacheStore002
+ * @tc.desc: Metadata is not paired with the body of another store.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HttpTransferEngineTest, HttpCacheStore002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. store a response and look up its metadata, then store another body of the url.
+     */
+    HttpCache cache;
+    cache.SetCacheDir(TEST_CACHE_DIR);
+    HttpCacheEntry entry;
+    entry.headers = "HTTP/1.1 200 OK\r\n\r\n";
+    cache.Store(TEST_URL, entry, std::vector<uint8_t>(TEST_CONTENT.begin(), TEST_CONTENT.end()));
+    HttpCacheEntry oldEntry;
+    ASSERT_TRUE(cache.Lookup(TEST_URL, oldEntry));
+    std::vector<uint8_t> otherBody(OTHER_CONTENT.begin(), OTHER_CONTENT.end());
+    cache.Store(TEST_URL, entry, otherBody);
+
+    /**
+     * @tc.steps: step2. read the body with the old and the new metadata.
+     * @tc.expected: step2. the body is rejected with the old metadata and read with the new one.
+     */
+    std::vector<uint8_t> cachedBody;
+    EXPECT_FALSE(cache.ReadBody(TEST_URL, oldEntry, cachedBody));
+    EXPECT_TRUE(cachedBody.empty());
+    HttpCacheEntry newEntry;
+    ASSERT_TRUE(cache.Lookup(TEST_URL, newEntry));
+    ASSERT_TRUE(cache.ReadBody(TEST_URL, newEntry, cachedBody));
+    EXPECT_EQ(cachedBody, otherBody);
+    cache.Remove(TEST_URL);
+}
+
+/**
+ * @tc.name: HttpTransferEngine001
+ * @tc.desc: Perform a transfer of a local file.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HttpTransferEngineTest, HttpTransferEngine001, TestSize.Level1)
+{
+    HttpRequest request;
+    request.url = "file://" + TEST_FILE;
+    HttpResponse response;
+    EXPECT_TRUE(HttpTransferEngine::GetInstance().Perform(std::move(request), response));
+    EXPECT_EQ(response.status, TransferStatus::SUCCESS);
+    EXPECT_EQ(std::string(response.body.begin(), response.body.end()), TEST_CONTENT);
+}
+
+/**
+ * @tc.name: HttpTransferEngine002
+ * @tc.desc: Submit many transfers at the same time and cancel some of them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HttpTransferEngineTest, HttpTransferEngine002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. submit transfers of different priorities, cancel every fourth one.
+     */
+    std::mutex mutex;
+    std::condition_variable condition;
+    int32_t finishedCount = 0;
+    std::atomic<int32_t> succeededCount { 0 };
+    std::atomic<int32_t> cancelledCount { 0 };
+    std::vector<TransferId> ids;
+    for (int32_t i = 0; i < TRANSFER_COUNT; ++i) {
+        HttpRequest request;
+        request.url = "file://" + TEST_FILE;
+        request.priority = (i % 2 == 0) ? TransferPriority::HIGH : TransferPriority::LOW;
+        ids.emplace_back(HttpTransferEngine::GetInstance().Submit(std::move(request), [&](HttpResponse&& response) {
+            if (response.status == TransferStatus::SUCCESS && response.body.size() == TEST_CONTENT.size()) {
+                ++succeededCount;
+            } else if (response.status == TransferStatus::CANCELLED) {
+                ++cancelledCount;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            ++finishedCount;
+            condition.notify_one();
+        }));
+    }
+    for (int32_t i = 0; i < TRANSFER_COUNT; i += 4) {
+        HttpTransferEngine::GetInstance().Cancel(ids[i]);
+    }
+
+    /**
+     * @tc.steps: step2. wait for all transfers.
+     * @tc.expected: step2. every transfer is either done or cancelled, and calls back exactly once.
+     */
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [&finishedCount] { return finishedCount == TRANSFER_COUNT; });
+    EXPECT_EQ(succeededCount + cancelledCount, TRANSFER_COUNT);
+    EXPECT_LE(cancelledCount, TRANSFER_COUNT / 4);
+}
+
+/**
+ * @tc.name: HttpTransferEngine003
+ * @tc.desc: A fresh cached response is returned without a transfer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HttpTransferEngineTest, HttpTransferEngine003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. store a fresh response of an unreachable url into the cache of the engine.
+     */
+    HttpCache cache;
+    cache.SetCacheDir(TEST_CACHE_DIR);
+    HttpCacheEntry entry;
+    entry.policy.expireTime = std::numeric_limits<int32_t>::max();
+    cache.Store(TEST_URL, entry, std::vector<uint8_t>(TEST_CONTENT.begin(), TEST_CONTENT.end()));
+    HttpTransferEngine::GetInstance().SetCacheDir(TEST_CACHE_DIR);
+
+    /**
+     * @tc.steps: step2. request the url.
+     * @tc.expected: step2. the cached response is returned.
+     */
+    HttpRequest request;
+    request.url = TEST_URL;
+    HttpResponse response;
+    EXPECT_TRUE(HttpTransferEngine::GetInstance().Perform(std::move(request), response));
+    EXPECT_TRUE(response.fromCache);
+    EXPECT_EQ(response.code, HTTP_OK);
+    EXPECT_EQ(std::string(response.body.begin(), response.body.end()), TEST_CONTENT);
+
+    /**
+     * @tc.steps: step3. request a range of the url.
+     * @tc.expected: step3. the cached response is not returned for a partial request.
+     */
+    HttpRequest rangeRequest;
+    rangeRequest.url = TEST_URL;
+    rangeRequest.headers.emplace_back("Range", "bytes=0-3");
+    HttpResponse rangeResponse;
+    HttpTransferEngine::GetInstance().Perform(std::move(rangeRequest), rangeResponse);
+    EXPECT_FALSE(rangeResponse.fromCache);
+    cache.Remove(TEST_URL);
+}
+
+} // namespace OHOS::Ace
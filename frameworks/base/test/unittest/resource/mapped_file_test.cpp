@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/resource/mapped_file.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string TEST_DIR = "/data/test/resource/mappedfile";
+const std::string EMPTY_FILE = TEST_DIR + "/empty.txt";
+const std::string SMALL_FILE = TEST_DIR + "/small.txt";
+const std::string LARGE_FILE = TEST_DIR + "/large.bin";
+const std::string TEMP_FILE = TEST_DIR + "/temp.bin";
+const std::string SMALL_CONTENT = "mapped file test content";
+// Files of 16KB and more are mapped, at most 32 mappings are cached.
+constexpr size_t LARGE_FILE_SIZE = 32 * 1024;
+constexpr size_t CACHED_FILE_COUNT = 32;
+
+void WriteFile(const std::string& filePath, const std::string& content)
+{
+    FILE* file = fopen(filePath.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(content.data(), 1, content.size(), file);
+    fclose(file);
+}
+
+// Replaces the file by a new one, so mappings of the former file stay valid.
+void ReplaceFile(const std::string& filePath, const std::string& content)
+{
+    WriteFile(TEMP_FILE, content);
+    ASSERT_EQ(rename(TEMP_FILE.c_str(), filePath.c_str()), 0);
+}
+
+std::string GetFileContent(const RefPtr<MappedFile>& file)
+{
+    return std::string(reinterpret_cast<const char*>(file->GetData()), file->GetSize());
+}
+
+std::string GetCachedFilePath(size_t index)
+{
+    return TEST_DIR + "/cached_" + std::to_string(index) + ".bin";
+}
+
+} // namespace
+
+class MappedFileTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override {}
+};
+
+void MappedFileTest::SetUpTestCase()
+{
+    mkdir(TEST_DIR.c_str(), S_IRWXU);
+    WriteFile(EMPTY_FILE, "");
+    WriteFile(SMALL_FILE, SMALL_CONTENT);
+    WriteFile(LARGE_FILE, std::string(LARGE_FILE_SIZE, 'a'));
+    for (size_t i = 0; i <= CACHED_FILE_COUNT; ++i) {
+        WriteFile(GetCachedFilePath(i), std::string(LARGE_FILE_SIZE, 'b'));
+    }
+}
+
+void MappedFileTest::TearDownTestCase()
+{
+    MappedFile::ClearCache();
+    remove(EMPTY_FILE.c_str());
+    remove(SMALL_FILE.c_str());
+    remove(LARGE_FILE.c_str());
+    for (size_t i = 0; i <= CACHED_FILE_COUNT; ++i) {
+        remove(GetCachedFilePath(i).c_str());
+    }
+    rmdir(TEST_DIR.c_str());
+}
+
+void MappedFileTest::SetUp()
+{
+    MappedFile::ClearCache();
+}
+
+/**
+ * @tc.name: MappedFile001
+ * @tc.desc: Small and empty files are read, missing and too large files are not opened.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MappedFileTest, MappedFile001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. open a small file and an empty file.
+     * @tc.expected: step1. they are read into memory with their content.
+     */
+    auto smallFile = MappedFile::Open(SMALL_FILE);
+    ASSERT_TRUE(smallFile);
+    EXPECT_FALSE(smallFile->IsMapped());
+    EXPECT_EQ(GetFileContent(smallFile), SMALL_CONTENT);
+    auto emptyFile = MappedFile::Open(EMPTY_FILE);
+    ASSERT_TRUE(emptyFile);
+    EXPECT_EQ(emptyFile->GetSize(), 0u);
+
+    /**
+     * @tc.steps: step2. open a missing file and a directory.
+     * @tc.expected: step2. they are not opened.
+     */
+    EXPECT_FALSE(MappedFile::Open(TEST_DIR + "/missing.txt"));
+    EXPECT_FALSE(MappedFile::Open(TEST_DIR));
+
+    /**
+     * @tc.steps: step3. open files with a max size.
+     * @tc.expected: step3. files larger than the max size are not opened, even when their mapping is cached.
+     */
+    EXPECT_FALSE(MappedFile::Open(SMALL_FILE, SMALL_CONTENT.size() - 1));
+    EXPECT_TRUE(MappedFile::Open(SMALL_FILE, SMALL_CONTENT.size()));
+    EXPECT_TRUE(MappedFile::Open(LARGE_FILE));
+    EXPECT_FALSE(MappedFile::Open(LARGE_FILE, LARGE_FILE_SIZE - 1));
+}
+
+/**
+ * @tc.name: MappedFile002
+ * @tc.desc: Mappings of large files are cached until the file changes or the cache is cleared.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MappedFileTest, MappedFile002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. open a large file twice.
+     * @tc.expected: step1. it is mapped once and the mapping is shared.
+     */
+    auto largeFile = MappedFile::Open(LARGE_FILE);
+    ASSERT_TRUE(largeFile);
+    EXPECT_TRUE(largeFile->IsMapped());
+    EXPECT_EQ(GetFileContent(largeFile), std::string(LARGE_FILE_SIZE, 'a'));
+    EXPECT_EQ(MappedFile::Open(LARGE_FILE), largeFile);
+
+    /**
+     * @tc.steps: step2. replace the file, then open it.
+     * @tc.expected: step2. the file is mapped again with the new content, the former mapping is still readable.
+     */
+    ReplaceFile(LARGE_FILE, std::string(LARGE_FILE_SIZE, 'c'));
+    auto changedFile = MappedFile::Open(LARGE_FILE);
+    ASSERT_TRUE(changedFile);
+    EXPECT_NE(changedFile, largeFile);
+    EXPECT_EQ(GetFileContent(changedFile), std::string(LARGE_FILE_SIZE, 'c'));
+    EXPECT_EQ(GetFileContent(largeFile), std::string(LARGE_FILE_SIZE, 'a'));
+
+    /**
+     * @tc.steps: step3. clear the cache, then open the file.
+     * @tc.expected: step3. the file is mapped again, the mapping in use is still readable.
+     */
+    MappedFile::ClearCache();
+    auto reopenedFile = MappedFile::Open(LARGE_FILE);
+    ASSERT_TRUE(reopenedFile);
+    EXPECT_NE(reopenedFile, changedFile);
+    EXPECT_EQ(GetFileContent(changedFile), std::string(LARGE_FILE_SIZE, 'c'));
+    EXPECT_EQ(MappedFile::Open(LARGE_FILE), reopenedFile);
+}
+
+/**
+ * @tc.name: MappedFile003
+ * @tc.desc: The least recently used mapping is evicted when the cache is full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MappedFileTest, MappedFile003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. open as many files as the cache holds, then open the first one again.
+     * @tc.expected: step1. all of them are cached, the first one is now the most recently used.
+     */
+    std::vector<RefPtr<MappedFile>> files;
+    for (size_t i = 0; i < CACHED_FILE_COUNT; ++i) {
+        files.emplace_back(MappedFile::Open(GetCachedFilePath(i)));
+        ASSERT_TRUE(files.back());
+    }
+    EXPECT_EQ(MappedFile::Open(GetCachedFilePath(0)), files[0]);
+
+    /**
+     * @tc.steps: step2. open one more file.
+     * @tc.expected: step2. the least recently used file is evicted, the others are still cached.
+     */
+    auto lastFile = MappedFile::Open(GetCachedFilePath(CACHED_FILE_COUNT));
+    ASSERT_TRUE(lastFile);
+    EXPECT_EQ(MappedFile::Open(GetCachedFilePath(CACHED_FILE_COUNT)), lastFile);
+    EXPECT_EQ(MappedFile::Open(GetCachedFilePath(0)), files[0]);
+    EXPECT_EQ(MappedFile::Open(GetCachedFilePath(2)), files[2]);
+    auto evictedFile = MappedFile::Open(GetCachedFilePath(1));
+    ASSERT_TRUE(evictedFile);
+    EXPECT_NE(evictedFile, files[1]);
+    EXPECT_EQ(GetFileContent(files[1]), std::string(LARGE_FILE_SIZE, 'b'));
+}
+
+} // namespace OHOS::Ace
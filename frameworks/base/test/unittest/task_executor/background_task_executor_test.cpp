@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "base/thread/background_task_executor.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t WAIT_SECONDS = 5;
+constexpr int32_t STOLEN_TASK_COUNT = 16;
+
+} // namespace
+
+class BackgroundTaskExecutorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override;
+
+    // Occupies every background thread with a task which waits to be released.
+    bool BlockAllThreads();
+    // Lets one blocked task return, so one thread runs the queued tasks alone.
+    void ReleaseOneThread();
+    bool WaitForTasks(size_t count);
+
+protected:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    size_t blockedCount_ = 0;
+    size_t releaseCount_ = 0;
+    std::vector<int32_t> executed_;
+};
+
+void BackgroundTaskExecutorTest::TearDown()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    releaseCount_ = blockedCount_;
+    condition_.notify_all();
+    condition_.wait_for(lock, std::chrono::seconds(WAIT_SECONDS), [this] { return blockedCount_ == 0; });
+}
+
+bool BackgroundTaskExecutorTest::BlockAllThreads()
+{
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    for (size_t i = 0; i < executor.maxThreadNum_; ++i) {
+        executor.PostTask([this] {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ++blockedCount_;
+            condition_.notify_all();
+            condition_.wait(lock, [this] { return releaseCount_ > 0; });
+            --releaseCount_;
+            --blockedCount_;
+            condition_.notify_all();
+        });
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    return condition_.wait_for(lock, std::chrono::seconds(WAIT_SECONDS),
+        [this, &executor] { return blockedCount_ == executor.maxThreadNum_; });
+}
+
+void BackgroundTaskExecutorTest::ReleaseOneThread()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++releaseCount_;
+    condition_.notify_all();
+}
+
+bool BackgroundTaskExecutorTest::WaitForTasks(size_t count)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return condition_.wait_for(
+        lock, std::chrono::seconds(WAIT_SECONDS), [this, count] { return executed_.size() == count; });
+}
+
+/**
+ * @tc.name: BackgroundTaskExecutor001
+ * @tc.desc: Queued tasks run by priority, whatever order they are posted in.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BackgroundTaskExecutorTest, BackgroundTaskExecutor001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. block all threads, then post tasks from the lowest priority to the highest.
+     */
+    ASSERT_TRUE(BlockAllThreads());
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    const BgTaskPriority priorities[] = { BgTaskPriority::LOW, BgTaskPriority::PREFETCH, BgTaskPriority::DEFAULT };
+    for (auto priority : priorities) {
+        executor.PostTask(
+            [this, priority] {
+                std::lock_guard<std::mutex> lock(mutex_);
+                executed_.emplace_back(static_cast<int32_t>(priority));
+                condition_.notify_all();
+            },
+            priority);
+    }
+    auto statistics = executor.GetStatistics();
+    EXPECT_EQ(statistics.queuedTasks[static_cast<size_t>(BgTaskPriority::LOW)], 1UL);
+
+    /**
+     * @tc.steps: step2. let one thread run the queued tasks.
+     * @tc.expected: step2. the tasks run from the highest priority to the lowest.
+     */
+    ReleaseOneThread();
+    ASSERT_TRUE(WaitForTasks(BG_TASK_PRIORITY_COUNT));
+    std::vector<int32_t> expected = { static_cast<int32_t>(BgTaskPriority::DEFAULT),
+        static_cast<int32_t>(BgTaskPriority::PREFETCH), static_cast<int32_t>(BgTaskPriority::LOW) };
+    EXPECT_EQ(executed_, expected);
+}
+
+/**
+ * @tc.name: BackgroundTaskExecutor002
+ * @tc.desc: An idle thread steals the tasks queued for busy threads.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BackgroundTaskExecutorTest, BackgroundTaskExecutor002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. block all threads, then post tasks, which are spread over the queues of all threads.
+     */
+    ASSERT_TRUE(BlockAllThreads());
+    auto& executor = BackgroundTaskExecutor::GetInstance();
+    auto stolenTasks = executor.GetStatistics().stolenTasks;
+    for (int32_t i = 0; i < STOLEN_TASK_COUNT; ++i) {
+        executor.PostTask([this, i] {
+            std::lock_guard<std::mutex> lock(mutex_);
+            executed_.emplace_back(i);
+            condition_.notify_all();
+        });
+    }
+
+    /**
+     * @tc.steps: step2. let one thread run.
+     * @tc.expected: step2. it runs all tasks, taking the ones queued for the other threads.
+     */
+    ReleaseOneThread();
+    ASSERT_TRUE(WaitForTasks(STOLEN_TASK_COUNT));
+    EXPECT_GT(executor.GetStatistics().stolenTasks, stolenTasks);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "base/utils/string_expression.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr double VP_SCALE = 2.0;
+constexpr double PERCENT_BASE = 1000.0;
+
+double ConvertToPx(const Dimension& dimension)
+{
+    switch (dimension.Unit()) {
+        case DimensionUnit::VP:
+            return dimension.Value() * VP_SCALE;
+        case DimensionUnit::PERCENT:
+            return dimension.Value() * PERCENT_BASE;
+        default:
+            return dimension.Value();
+    }
+}
+
+double Calculate(const std::string& expression)
+{
+    return StringExpression::CalculateExp(expression, ConvertToPx);
+}
+
+} // namespace
+
+class StringExpressionTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: StringExpression001
+ * @tc.desc: Operands are converted by the calc function and combined.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringExpressionTest, StringExpression001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. calculate expressions with a single kind of operator.
+     * @tc.expected: step1. the results are the same as with the former regex implementation.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px + 20px)"), 120.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(10px - 4px - 3px)"), 3.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(80px / 4 / 2)"), 10.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc( 3px*2 )"), 6.0);
+
+    /**
+     * @tc.steps: step2. calculate expressions with other units.
+     * @tc.expected: step2. every operand is converted by the calc function.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc(10vp + 2px)"), 22.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(50% / 2 - 10vp)"), 230.0);
+
+    /**
+     * @tc.steps: step3. divide by zero.
+     * @tc.expected: step3. the result is 0.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px / 0)"), 0.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px / 0 + 5px)"), 5.0);
+}
+
+/**
+ * @tc.name: StringExpression002
+ * @tc.desc: Mixed operators are applied from left to right and brackets group, as with the former implementation.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringExpressionTest, StringExpression002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. calculate expressions mixing + and * without brackets.
+     * @tc.expected: step1. operators are applied from left to right.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px - 20px * 2)"), 160.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px * 2 - 20px)"), 180.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px / 4 + 2 * 3px)"), 81.0);
+
+    /**
+     * @tc.steps: step2. calculate expressions with brackets.
+     * @tc.expected: step2. bracketed expressions are calculated first.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc((100px - 20px) * 2)"), 160.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px - (20px * 2))"), 60.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100% - (10vp + 2px) * 2)"), 1956.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(2 * (3px + (4px - 1px) * 2))"), 24.0);
+}
+
+/**
+ * @tc.name: StringExpression003
+ * @tc.desc: Malformed expressions are calculated as 0.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringExpressionTest, StringExpression003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. calculate expressions missing an operand.
+     * @tc.expected: step1. the result is 0, as with the former implementation.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc()"), 0.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px + )"), 0.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(* 2px)"), 0.0);
+
+    /**
+     * @tc.steps: step2. calculate expressions with unmatched brackets.
+     * @tc.expected: step2. the result is 0, the former implementation ignored the unmatched part.
+     */
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px + 20px"), 0.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc(100px + 20px))"), 0.0);
+    EXPECT_DOUBLE_EQ(Calculate("calc((100px)"), 0.0);
+}
+
+} // namespace OHOS::Ace
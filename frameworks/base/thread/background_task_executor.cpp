@@ -26,6 +26,10 @@ namespace {
 
 constexpr size_t MAX_BACKGROUND_THREADS = 8;
 constexpr uint32_t PURGE_FLAG_MASK = (1 << MAX_BACKGROUND_THREADS) - 1;
+constexpr size_t INVALID_QUEUE_INDEX = static_cast<size_t>(-1);
+
+// Queue owned by the background thread running on this thread.
+thread_local size_t currentQueueIndex = INVALID_QUEUE_INDEX;
 
 void SetThreadName(uint32_t threadNo)
 {
@@ -38,6 +42,20 @@ void SetThreadName(uint32_t threadNo)
 #endif
 }
 
+const char* GetPriorityName(size_t priority)
+{
+    switch (static_cast<BgTaskPriority>(priority)) {
+        case BgTaskPriority::DEFAULT:
+            return "default";
+        case BgTaskPriority::PREFETCH:
+            return "prefetch";
+        case BgTaskPriority::LOW:
+            return "low";
+        default:
+            return "unknown";
+    }
+}
+
 } // namespace
 
 BackgroundTaskExecutor& BackgroundTaskExecutor::GetInstance()
@@ -46,7 +64,8 @@ BackgroundTaskExecutor& BackgroundTaskExecutor::GetInstance()
     return instance;
 }
 
-BackgroundTaskExecutor::BackgroundTaskExecutor() : maxThreadNum_(MAX_BACKGROUND_THREADS)
+BackgroundTaskExecutor::BackgroundTaskExecutor()
+    : queues_(MAX_BACKGROUND_THREADS), maxThreadNum_(MAX_BACKGROUND_THREADS)
 {
     if (maxThreadNum_ > 1) {
         // Start other threads in the first created thread.
@@ -78,21 +97,7 @@ bool BackgroundTaskExecutor::PostTask(Task&& task, BgTaskPriority priority)
     if (!task) {
         return false;
     }
-
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!running_) {
-        return false;
-    }
-    switch (priority) {
-        case BgTaskPriority::LOW:
-            lowPriorityTasks_.emplace_back(std::move(task));
-            break;
-        default:
-            tasks_.emplace_back(std::move(task));
-            break;
-    }
-    condition_.notify_one();
-    return true;
+    return PostQueuedTask({ std::move(task), Clock::now() }, priority);
 }
 
 bool BackgroundTaskExecutor::PostTask(const Task& task, BgTaskPriority priority)
@@ -100,23 +105,72 @@ bool BackgroundTaskExecutor::PostTask(const Task& task, BgTaskPriority priority)
     if (!task) {
         return false;
     }
+    return PostQueuedTask({ task, Clock::now() }, priority);
+}
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!running_) {
+bool BackgroundTaskExecutor::PostQueuedTask(QueuedTask&& task, BgTaskPriority priority)
+{
+    if (!running_.load(std::memory_order_acquire)) {
         return false;
     }
-    switch (priority) {
-        case BgTaskPriority::LOW:
-            lowPriorityTasks_.emplace_back(task);
-            break;
-        default:
-            tasks_.emplace_back(task);
-            break;
+    auto priorityIndex = static_cast<size_t>(priority);
+    if (priorityIndex >= BG_TASK_PRIORITY_COUNT) {
+        priorityIndex = static_cast<size_t>(BgTaskPriority::DEFAULT);
+    }
+    // Keep tasks posted by a background task on its own thread, spread the others over all queues.
+    auto queueIndex = currentQueueIndex;
+    if (queueIndex >= queues_.size()) {
+        queueIndex = nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+    auto& queue = queues_[queueIndex];
+    {
+        // Counted under the queue lock like the pop, so the count never wraps around when the task is taken at once.
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks[priorityIndex].emplace_back(std::move(task));
+        pendingTasks_[priorityIndex].fetch_add(1);
+    }
+
+    // An idle thread counts itself before it checks the pending tasks, so it either sees this task or is woken here.
+    if (idleThreadNum_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        condition_.notify_one();
     }
-    condition_.notify_one();
     return true;
 }
 
+bool BackgroundTaskExecutor::PopTaskFromQueue(size_t queueIndex, size_t priority, QueuedTask& task)
+{
+    auto& queue = queues_[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    auto& tasks = queue.tasks[priority];
+    if (tasks.empty()) {
+        return false;
+    }
+    task = std::move(tasks.front());
+    tasks.pop_front();
+    pendingTasks_[priority].fetch_sub(1);
+    return true;
+}
+
+bool BackgroundTaskExecutor::PopTask(size_t queueIndex, QueuedTask& task)
+{
+    for (size_t priority = 0; priority < BG_TASK_PRIORITY_COUNT; ++priority) {
+        if (pendingTasks_[priority].load() == 0) {
+            continue;
+        }
+        // Own queue first, then steal from the others.
+        for (size_t offset = 0; offset < queues_.size(); ++offset) {
+            if (PopTaskFromQueue((queueIndex + offset) % queues_.size(), priority, task)) {
+                if (offset != 0) {
+                    stolenTasks_.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void BackgroundTaskExecutor::StartNewThreads(size_t num)
 {
     uint32_t currentThreadNo = 0;
@@ -160,47 +214,85 @@ void BackgroundTaskExecutor::ThreadLoop(uint32_t threadNo)
 
     SetThreadName(threadNo);
 
-    Task task;
+    const size_t queueIndex = (threadNo - 1) % queues_.size();
+    currentQueueIndex = queueIndex;
     const uint32_t purgeFlag = (1 << (threadNo - 1));
-    std::unique_lock<std::mutex> lock(mutex_);
-    while (running_) {
-        if (tasks_.empty() && lowPriorityTasks_.empty()) {
-            if ((purgeFlags_ & purgeFlag) != purgeFlag) {
-                condition_.wait(lock);
-                continue;
-            }
+    QueuedTask task;
+    while (running_.load(std::memory_order_acquire)) {
+        if (PopTask(queueIndex, task)) {
+            auto waitUs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - task.postTime).count());
+            totalWaitUs_.fetch_add(waitUs, std::memory_order_relaxed);
+            auto maxWaitUs = maxWaitUs_.load(std::memory_order_relaxed);
+            while (waitUs > maxWaitUs && !maxWaitUs_.compare_exchange_weak(maxWaitUs, waitUs)) {}
+
+            // Execute the task and clear after execution.
+            task.task();
+            task.task = nullptr;
+            executedTasks_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
 
-            lock.unlock();
+        if ((purgeFlags_.fetch_and(~purgeFlag) & purgeFlag) != 0) {
             LOGD("Purge malloc cache for background thread %{public}u", threadNo);
             PurgeMallocCache();
-            lock.lock();
-            purgeFlags_ &= ~purgeFlag;
             continue;
         }
-        // deal with tasks_ first. do lowPriorityTasks_ only when all tasks_ done.
-        if (!tasks_.empty()) {
-            task = std::move(tasks_.front());
-            tasks_.pop_front();
-        } else {
-            task = std::move(lowPriorityTasks_.front());
-            lowPriorityTasks_.pop_front();
-        }
 
-        lock.unlock();
-        // Execute the task and clear after execution.
-        task();
-        task = nullptr;
-        lock.lock();
+        std::unique_lock<std::mutex> lock(mutex_);
+        idleThreadNum_.fetch_add(1);
+        condition_.wait(lock, [this, purgeFlag]() {
+            if (!running_.load() || (purgeFlags_.load() & purgeFlag) != 0) {
+                return true;
+            }
+            for (const auto& pendingTasks : pendingTasks_) {
+                if (pendingTasks.load() > 0) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        idleThreadNum_.fetch_sub(1);
     }
 
+    currentQueueIndex = INVALID_QUEUE_INDEX;
     LOGD("Background thread is stopped");
 }
 
 void BackgroundTaskExecutor::TriggerGarbageCollection()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     purgeFlags_ = PURGE_FLAG_MASK;
+    std::lock_guard<std::mutex> lock(mutex_);
     condition_.notify_all();
 }
 
+BgTaskStatistics BackgroundTaskExecutor::GetStatistics() const
+{
+    BgTaskStatistics statistics;
+    for (size_t priority = 0; priority < BG_TASK_PRIORITY_COUNT; ++priority) {
+        statistics.queuedTasks[priority] = pendingTasks_[priority].load(std::memory_order_relaxed);
+    }
+    statistics.executedTasks = executedTasks_.load(std::memory_order_relaxed);
+    statistics.stolenTasks = stolenTasks_.load(std::memory_order_relaxed);
+    statistics.averageWaitUs =
+        statistics.executedTasks == 0 ? 0 : totalWaitUs_.load(std::memory_order_relaxed) / statistics.executedTasks;
+    statistics.maxWaitUs = maxWaitUs_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void BackgroundTaskExecutor::Dump(std::vector<std::string>& lines) const
+{
+    auto statistics = GetStatistics();
+    std::string queued = "BackgroundTaskExecutor: queued";
+    for (size_t priority = 0; priority < BG_TASK_PRIORITY_COUNT; ++priority) {
+        queued.append(" ").append(GetPriorityName(priority)).append("=");
+        queued.append(std::to_string(statistics.queuedTasks[priority]));
+    }
+    lines.emplace_back(queued);
+    lines.emplace_back(
+        "executed=" + std::to_string(statistics.executedTasks) + " stolen=" + std::to_string(statistics.stolenTasks));
+    lines.emplace_back("wait: mean=" + std::to_string(statistics.averageWaitUs) +
+                       "us max=" + std::to_string(statistics.maxWaitUs) + "us");
+}
+
 } // namespace OHOS::Ace
@@ -16,18 +16,47 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_BACKGROUND_TASK_EXECUTOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_BACKGROUND_TASK_EXECUTOR_H
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <list>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "base/utils/noncopyable.h"
 
 namespace OHOS::Ace {
 
+// Tasks of a higher priority are always taken before any task of a lower one.
 enum class BgTaskPriority {
-    DEFAULT,
+    // Work for content on screen now, such as decoding a visible image.
+    DEFAULT = 0,
+    // Work for content which will be needed soon, such as loading an image created by script.
+    PREFETCH,
+    // Housekeeping, such as writing cache files, runs only when nothing else is queued.
     LOW,
+    COUNT,
 };
 
+constexpr size_t BG_TASK_PRIORITY_COUNT = static_cast<size_t>(BgTaskPriority::COUNT);
+
+struct BgTaskStatistics {
+    std::array<size_t, BG_TASK_PRIORITY_COUNT> queuedTasks {};
+    uint64_t executedTasks = 0;
+    // Tasks taken from the queue of another thread.
+    uint64_t stolenTasks = 0;
+    uint64_t averageWaitUs = 0;
+    uint64_t maxWaitUs = 0;
+};
+
+// Background thread pool. Every thread owns a queue, tasks posted from a background thread go to its own queue and
+// the others are spread over all queues, idle threads steal from the queues of busy ones. So threads do not contend
+// on a single lock, and tasks posted by a running background task stay on the same thread.
 class BackgroundTaskExecutor {
     ACE_DISALLOW_COPY_AND_MOVE(BackgroundTaskExecutor);
 
@@ -41,22 +70,49 @@ public:
 
     void TriggerGarbageCollection();
 
+    BgTaskStatistics GetStatistics() const;
+    void Dump(std::vector<std::string>& lines) const;
+
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct QueuedTask {
+        Task task;
+        Clock::time_point postTime;
+    };
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::array<std::deque<QueuedTask>, BG_TASK_PRIORITY_COUNT> tasks;
+    };
+
     BackgroundTaskExecutor();
     ~BackgroundTaskExecutor();
 
+    bool PostQueuedTask(QueuedTask&& task, BgTaskPriority priority);
+    bool PopTask(size_t queueIndex, QueuedTask& task);
+    bool PopTaskFromQueue(size_t queueIndex, size_t priority, QueuedTask& task);
     void StartNewThreads(size_t num = 1);
     void ThreadLoop(uint32_t threadNo);
 
+    std::vector<TaskQueue> queues_;
+    std::array<std::atomic<size_t>, BG_TASK_PRIORITY_COUNT> pendingTasks_ {};
+    std::atomic<size_t> nextQueue_ { 0 };
+
+    // Guards sleeping of idle threads and the thread list.
     std::mutex mutex_;
     std::condition_variable condition_;
-    std::list<Task> tasks_;
-    std::list<Task> lowPriorityTasks_;
+    std::atomic<size_t> idleThreadNum_ { 0 };
     std::list<std::thread> threads_;
     size_t currentThreadNum_ { 0 };
     size_t maxThreadNum_ { 0 };
-    bool running_ { true };
-    uint32_t purgeFlags_ { 0 };
+    std::atomic<bool> running_ { true };
+    std::atomic<uint32_t> purgeFlags_ { 0 };
+
+    std::atomic<uint64_t> executedTasks_ { 0 };
+    std::atomic<uint64_t> stolenTasks_ { 0 };
+    std::atomic<uint64_t> totalWaitUs_ { 0 };
+    std::atomic<uint64_t> maxWaitUs_ { 0 };
 };
 
 } // namespace OHOS::Ace
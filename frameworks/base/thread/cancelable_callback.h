@@ -52,6 +52,12 @@ public:
         return impl_ && impl_->callback_;
     }
 
+    // Canceled through any copy of this callback.
+    bool IsCanceled() const
+    {
+        return !impl_ || impl_->status_.load(std::memory_order_relaxed) == CANCELED;
+    }
+
 private:
     enum : int32_t {
         READY,
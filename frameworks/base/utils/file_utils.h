@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_FILE_UTILS_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_FILE_UTILS_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#ifdef WINDOWS_PLATFORM
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace OHOS::Ace::FileUtils {
+
+// Opens a new file for writing named by the template, which ends with XXXXXX replaced by the name of the file.
+inline FILE* CreateTmpFile(std::string& tmpPath)
+{
+#ifdef WINDOWS_PLATFORM
+    if (_mktemp_s(&tmpPath[0], tmpPath.size() + 1) != 0) {
+        return nullptr;
+    }
+    return fopen(tmpPath.c_str(), "wb");
+#else
+    int fd = mkstemp(&tmpPath[0]);
+    if (fd < 0) {
+        return nullptr;
+    }
+    FILE* fp = fdopen(fd, "wb");
+    if (fp == nullptr) {
+        close(fd);
+        remove(tmpPath.c_str());
+    }
+    return fp;
+#endif
+}
+
+// Replaces the file at to by the file at from, rename fails on Windows when the target exists.
+inline bool RenameFile(const std::string& from, const std::string& to)
+{
+#ifdef WINDOWS_PLATFORM
+    remove(to.c_str());
+#endif
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+
+} // namespace OHOS::Ace::FileUtils
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_FILE_UTILS_H
@@ -17,118 +17,118 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
 
 #include <functional>
-#include <map>
-#include <regex>
 #include <string>
 #include <vector>
 
+#include "base/geometry/dimension.h"
+#include "base/log/log.h"
+#include "base/utils/string_utils.h"
+
 namespace OHOS::Ace::StringExpression {
-void InitMapping(std::map<std::string, int> &mapping)
+constexpr char CALC_KEYWORD[] = "calc";
+constexpr size_t CALC_KEYWORD_LENGTH = sizeof(CALC_KEYWORD) - 1;
+
+inline bool IsOperator(char c)
 {
-    mapping["+"] = 0;
-    mapping["-"] = 0;
-    mapping["*"] = 1;
-    mapping["/"] = 1;
-    mapping["("] = 2;
-    mapping[")"] = 2;
+    return c == '+' || c == '-' || c == '*' || c == '/' || c == '(' || c == ')';
 }
 
-std::vector<std::string> ConvertDal2Rpn(std::string formula)
+inline bool ApplyOperator(std::vector<double>& operands, char op)
 {
-    std::vector<std::string> result;
-    std::vector<std::string> opStack;
-    std::map<std::string, int> OpMapping;
-    std::string curNum, curOp;
-    std::regex calc("calc");
-    std::regex space(" ");
-    std::string ops = "+-*/()";
-    formula = regex_replace(formula, calc, "");
-    formula = regex_replace(formula, space, "");
-    for (std::size_t i = 0; i < formula.size(); ++i) {
-        if (ops.find(formula[i]) == ops.npos) {
-            curNum += formula[i];
-        } else {
-            if (!curNum.empty()) {
-                result.push_back(curNum);
-                curNum.clear();
-            }
-            curOp = formula[i];
-            if (opStack.empty()) {
-                opStack.push_back(curOp);
-            } else if (curOp == "(") {
-                opStack.push_back(curOp);
-            } else if (curOp == ")") {
-                while (opStack.back() != "(") {
-                    result.push_back(opStack.back());
-                    opStack.pop_back();
-                    if (opStack.empty()) {
-                        LOGE("ExpressionError, opStack is empty");
-                        result.push_back("0");
-                        return result;
-                    }
-                }
-                opStack.pop_back();
-            } else if (opStack.back() == "(") {
-                opStack.push_back(curOp);
-            } else if (OpMapping[curOp] > OpMapping[opStack.back()] && (!opStack.empty())) {
-                opStack.push_back(curOp);
-            } else {
-                while ((opStack.back() != "(") && (OpMapping[opStack.back()] >= OpMapping[curOp]))  {
-                    result.push_back(opStack.back());
-                    opStack.pop_back();
-                    if (opStack.empty())
-                        break;
-                }
-                opStack.push_back(curOp);
-            }
-        }
+    if (operands.size() < 2) {
+        LOGE("ExpressionError, size < 2");
+        return false;
     }
-    if (!opStack.empty()) {
-        LOGE("opStack is not empty");
+    double right = operands.back();
+    operands.pop_back();
+    double& left = operands.back();
+    switch (op) {
+        case '+':
+            left = left + right;
+            break;
+        case '-':
+            left = left - right;
+            break;
+        case '*':
+            left = left * right;
+            break;
+        case '/':
+            left = (right != 0.0) ? left / right : 0.0;
+            break;
+        default:
+            left = 0.0;
+            break;
     }
-    return result;
+    return true;
 }
 
-double CalculateExp(std::string expression, const std::function<double(const Dimension&)> calcFunc)
+// Evaluates calc() expressions like "calc(100% - (10vp + 2px) * 2)" in a single pass, operands are dimensions which
+// are converted to px by calcFunc. Operators all have the same priority and are applied from left to right, only
+// brackets group, so "calc(100px - 20px * 2)" is 160px as it has always been. Returns 0.0 for a malformed expression.
+inline double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc)
 {
-    std::vector<std::string> rpnexp = ConvertDal2Rpn(expression);
-    std::vector<double> result;
-    double num = 0.0;
-    std::string ops = "+-*/()";
-    for (std::size_t i = 0; i < rpnexp.size(); ++i) {
-        if (ops.find(rpnexp[i]) == ops.npos) {
-            std::string value = rpnexp[i];
-            Dimension dim = StringUtils::StringToDimensionWithUnit(value);
-            num = calcFunc(dim);
-            result.push_back(num);
-        } else {
-            if (result.size() < 2) {
-                LOGE("ExpressionError, size < 2");
+    std::vector<double> operands;
+    std::vector<char> operators;
+    std::string operand;
+    auto pushOperand = [&operands, &operand, &calcFunc]() {
+        if (!operand.empty()) {
+            operands.push_back(calcFunc(StringUtils::StringToDimensionWithUnit(operand)));
+            operand.clear();
+        }
+    };
+    for (size_t i = 0; i < expression.size(); ++i) {
+        char c = expression[i];
+        if (c == ' ') {
+            continue;
+        }
+        if (expression.compare(i, CALC_KEYWORD_LENGTH, CALC_KEYWORD) == 0) {
+            i += CALC_KEYWORD_LENGTH - 1;
+            continue;
+        }
+        if (!IsOperator(c)) {
+            operand.push_back(c);
+            continue;
+        }
+        pushOperand();
+        if (c == '(') {
+            operators.push_back(c);
+            continue;
+        }
+        if (c == ')') {
+            while (!operators.empty() && operators.back() != '(') {
+                if (!ApplyOperator(operands, operators.back())) {
+                    return 0.0;
+                }
+                operators.pop_back();
+            }
+            if (operators.empty()) {
+                LOGE("ExpressionError, opStack is empty");
                 return 0.0;
             }
-            double num1 = result.back();
-            result.pop_back();
-            double num2 = result.back();
-            result.pop_back();
-            double opRes = 0.0;
-            if (rpnexp[i] == "+") {
-                opRes = num2 + num1;
-            } else if (rpnexp[i] == "-") {
-                opRes = num2 - num1;
-            } else if (rpnexp[i] == "*") {
-                opRes = num2 * num1;
-            } else if (rpnexp[i] == "/" && num1 != 0) {
-                opRes = num2 / num1;
+            operators.pop_back();
+            continue;
+        }
+        while (!operators.empty() && operators.back() != '(') {
+            if (!ApplyOperator(operands, operators.back())) {
+                return 0.0;
             }
-            result.push_back(opRes);
+            operators.pop_back();
+        }
+        operators.push_back(c);
+    }
+    pushOperand();
+    while (!operators.empty()) {
+        if (operators.back() == '(' || !ApplyOperator(operands, operators.back())) {
+            LOGE("ExpressionError, unmatched bracket or operator");
+            return 0.0;
         }
+        operators.pop_back();
     }
-    if (result.size() == 1) {
-        return result.back();
-    } else {
+    if (operands.size() != 1) {
         LOGE("ExpressionError");
         return 0.0;
     }
+    return operands.back();
 }
 } // namespace OHOS::Ace::StringExpression
 
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 
 namespace OHOS::Ace {
@@ -108,6 +109,18 @@ inline uint64_t GetNanoseconds()
     return nanoseconds.count();
 }
 
+// 64 bits FNV-1a hash of data. Unlike std::hash it is the same between runs, builds and platforms, so it can name
+// files kept on disk. Pass a result as hash to go on with more data.
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+    constexpr uint64_t fnvPrime = 1099511628211ULL;
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * fnvPrime;
+    }
+    return hash;
+}
+
 } // namespace OHOS::Ace
 
 #endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_UTILS_H
@@ -16,6 +16,7 @@
 #include "frameworks/bridge/card_frontend/js_card_parser.h"
 
 #include <array>
+#include <cctype>
 
 #include "base/i18n/localization.h"
 #include "base/resource/ace_res_config.h"
@@ -107,6 +108,52 @@ std::string GetDeviceDpi(double dpi)
     return "mdpi";
 }
 
+// Collects the names which the bindings in value may read, e.g. "{{flag ? list[idx].name : $t('title')}}" reads flag,
+// list, idx and name. Collecting more names than are read only costs an extra update of the node.
+void CollectBindingKeys(const std::string& value, std::unordered_set<std::string>& keys)
+{
+    auto start = value.find("{{");
+    while (start != std::string::npos) {
+        auto end = value.find("}}", start + 2);
+        if (end == std::string::npos) {
+            return;
+        }
+        auto expression = StringUtils::TrimStr(value.substr(start + 2, end - start - 2));
+        keys.emplace(expression);
+        std::string name;
+        char quote = 0;
+        for (auto ch : expression) {
+            if (quote != 0) {
+                // names in string literals are not read.
+                quote = (ch == quote) ? 0 : quote;
+                continue;
+            }
+            if (std::isalnum(static_cast<unsigned char>(ch)) || ch == '_' || ch == '$') {
+                name.push_back(ch);
+                continue;
+            }
+            if (ch == '\'' || ch == '"') {
+                quote = ch;
+            }
+            if (!name.empty()) {
+                keys.emplace(name);
+                name.clear();
+            }
+        }
+        if (!name.empty()) {
+            keys.emplace(name);
+        }
+        start = value.find("{{", end + 2);
+    }
+}
+
+void CollectBindingKeys(const std::unique_ptr<JsonValue>& value, std::unordered_set<std::string>& keys)
+{
+    if (value && value->IsValid()) {
+        CollectBindingKeys(value->IsString() ? value->GetString() : value->ToString(), keys);
+    }
+}
+
 void GetAttrOptionsSeriesPoint(const std::unique_ptr<JsonValue>& jsonPoint, PointInfo& pointInfo)
 {
     if (!jsonPoint || !jsonPoint->IsValid() || !jsonPoint->IsObject()) {
@@ -1168,13 +1215,126 @@ void JsCardParser::UpdatePageData(const std::string& dataList, const RefPtr<JsAc
         LOGE("update card data error");
         return;
     }
+    changedKeys_.clear();
     while (data && data->IsValid()) {
         auto key = data->GetKey();
+        auto oldData = dataJson_->GetValue(key);
+        if (!oldData->IsValid() || oldData->ToString() != data->ToString()) {
+            changedKeys_.emplace(key);
+        }
         dataJson_->Replace(key.c_str(), data);
         repeatJson_->Replace(key.c_str(), data);
         data = data->GetNext();
     }
+    if (changedKeys_.empty()) {
+        LOGI("card data is not changed");
+        return;
+    }
+    CollectChangedKeys();
+    // only nodes reading the changed data are updated.
+    updateMode_ = UpdateMode::CHANGED;
     SetUpdateStatus(page);
+    updateMode_ = UpdateMode::ALL;
+    changedKeys_.clear();
+}
+
+void JsCardParser::CollectChangedKeys()
+{
+    // data may bind other data, eg: "title": "{{name}}", it changes when the data it binds changes.
+    std::unordered_map<std::string, std::unordered_set<std::string>> boundKeys;
+    auto data = dataJson_->GetChild();
+    while (data && data->IsValid()) {
+        std::unordered_set<std::string> keys;
+        CollectBindingKeys(data, keys);
+        if (!keys.empty()) {
+            boundKeys.emplace(data->GetKey(), std::move(keys));
+        }
+        data = data->GetNext();
+    }
+    bool hasNewKey = true;
+    while (hasNewKey) {
+        hasNewKey = false;
+        for (const auto& [key, keys] : boundKeys) {
+            if (changedKeys_.count(key) == 0 && HasChangedKey(keys)) {
+                changedKeys_.emplace(key);
+                hasNewKey = true;
+            }
+        }
+    }
+}
+
+bool JsCardParser::HasChangedKey(const std::unordered_set<std::string>& keys) const
+{
+    for (const auto& key : changedKeys_) {
+        if (keys.count(key) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const NodeBinding& JsCardParser::CompileBinding(const std::unique_ptr<JsonValue>& rootJson)
+{
+    static const NodeBinding emptyBinding;
+    if (!rootJson || !rootJson->IsValid()) {
+        return emptyBinding;
+    }
+    auto iter = nodeBindings_.find(rootJson->GetJsonObject());
+    if (iter != nodeBindings_.end()) {
+        return iter->second;
+    }
+    // a custom component may be used in its own template, it is taken as dynamic until compiled.
+    auto& binding = nodeBindings_[rootJson->GetJsonObject()];
+    binding.isDynamic = true;
+    binding.isTreeDynamic = true;
+
+    NodeBinding result;
+    static const std::array<const char*, 6> bindingFields = { "attr", "style", "classList", "id", "shown", "repeat" };
+    for (const auto& field : bindingFields) {
+        CollectBindingKeys(rootJson->GetValue(field), result.keys);
+    }
+    auto eventList = rootJson->GetValue("events");
+    if (eventList && eventList->IsValid() && eventJson_) {
+        auto event = eventList->GetChild();
+        while (event && event->IsValid()) {
+            auto actionJson = eventJson_->GetValue(event->GetString());
+            if (actionJson->Contains("action") && actionJson->GetString("action") == "proxy") {
+                result.isDynamic = true;
+            }
+            CollectBindingKeys(actionJson, result.keys);
+            event = event->GetNext();
+        }
+    }
+
+    result.treeKeys = result.keys;
+    result.isTreeDynamic = result.isDynamic;
+    auto mergeTree = [&result](const NodeBinding& child) {
+        result.treeKeys.insert(child.treeKeys.begin(), child.treeKeys.end());
+        result.isTreeDynamic = result.isTreeDynamic || child.isTreeDynamic;
+    };
+    auto type = rootJson->GetString("type");
+    if (!type.empty() && rootBody_->Contains(type)) {
+        mergeTree(CompileBinding(rootBody_->GetValue(type)->GetValue("template")));
+    }
+    auto childList = rootJson->GetValue("children");
+    if (childList && childList->IsValid()) {
+        auto child = childList->GetChild();
+        while (child && child->IsValid()) {
+            mergeTree(CompileBinding(child));
+            child = child->GetNext();
+        }
+    }
+    binding = std::move(result);
+    return binding;
+}
+
+bool JsCardParser::IsBindingChanged(const std::unique_ptr<JsonValue>& rootJson, bool withDescendants)
+{
+    const auto& binding = CompileBinding(rootJson);
+    if (withDescendants) {
+        return binding.isTreeDynamic || HasChangedKey(binding.treeKeys);
+    }
+    return binding.isDynamic || HasChangedKey(binding.keys);
 }
 
 void JsCardParser::UpdateStyle(const RefPtr<JsAcePage>& page)
@@ -1272,13 +1432,26 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
         LOGE("fail to UpdateDomNode due to page or root is invalid");
         return;
     }
+    auto updateMode = updateMode_;
     if (rootJson->Contains("repeat") && !isRepeat_) {
+        // all items are updated when the list changes, otherwise only nodes of items reading the changed data.
+        if (updateMode_ == UpdateMode::CHANGED && IsBindingChanged(rootJson, false)) {
+            updateMode_ = UpdateMode::ALL;
+        } else if (updateMode_ == UpdateMode::CHANGED && !IsBindingChanged(rootJson, true)) {
+            updateMode_ = UpdateMode::NONE;
+        }
         CreateRepeatDomNode(page, rootJson, parentId);
+        updateMode_ = updateMode;
         return;
     }
     auto type = rootJson->GetString("type");
     if (type == "block") {
+        // children of a block are all updated when whether the block is shown changes.
+        if (updateMode_ == UpdateMode::CHANGED && IsBindingChanged(rootJson, false)) {
+            updateMode_ = UpdateMode::ALL;
+        }
         CreateBlockNode(page, rootJson, parentId);
+        updateMode_ = updateMode;
         return;
     }
     int32_t selfId = 0;
@@ -1291,11 +1464,17 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
             ++listNodeIndex_;
         }
     }
+    type = rootJson->GetValue("type")->GetString();
+    bool isCustomComponent = rootBody_->Contains(type);
+    // nodes which are not updated are still visited to keep node ids in step.
+    bool needUpdate = updateMode_ == UpdateMode::ALL ||
+                      (updateMode_ == UpdateMode::CHANGED && IsBindingChanged(rootJson, isCustomComponent));
     bool shouldShow = true;
     bool hasShownAttr = false;
-    GetShownAttr(rootJson, dataJson, propsJson, shouldShow, hasShownAttr);
-    type = rootJson->GetValue("type")->GetString();
-    if (rootBody_->Contains(type)) {
+    if (needUpdate) {
+        GetShownAttr(rootJson, dataJson, propsJson, shouldShow, hasShownAttr);
+    }
+    if (isCustomComponent) {
         // if rootBody contains this type, it must be a customer component.
         auto customJson = rootBody_->GetValue(type);
         auto customJsonTemplate = customJson->GetValue("template");
@@ -1306,37 +1485,44 @@ void JsCardParser::UpdateDomNode(const RefPtr<Framework::JsAcePage>& page, const
         if (!attrList || !attrList->IsValid()) {
             return;
         }
-        auto attr = attrList->GetChild();
-        while (attr && attr->IsValid()) {
-            auto key = attr->GetKey();
-            auto value = attr->IsString() ? attr->GetString() : attr->ToString();
-            UpdateProps(key, value, customJsonProps);
-            attr = attr->GetNext();
+        // props of a custom component are bound in its attributes, the component is updated as a whole.
+        updateMode_ = needUpdate ? UpdateMode::ALL : UpdateMode::NONE;
+        if (needUpdate) {
+            auto attr = attrList->GetChild();
+            while (attr && attr->IsValid()) {
+                auto key = attr->GetKey();
+                auto value = attr->IsString() ? attr->GetString() : attr->ToString();
+                UpdateProps(key, value, customJsonProps);
+                attr = attr->GetNext();
+            }
+            ParseStyles(rootJson, selfId, customStyles_, styleJson);
         }
-        ParseStyles(rootJson, selfId, customStyles_, styleJson);
         UpdateDomNode(page, customJsonTemplate, parentId, idArray, customJsonData, customJsonStyle, customJsonProps);
+        updateMode_ = updateMode;
         return;
     }
-    std::vector<std::pair<std::string, std::string>> attrs;
-    std::vector<std::pair<std::string, std::string>> styles(customStyles_);
-    customStyles_.clear();
-    std::vector<std::string> events;
-    auto styleCommand = Referenced::MakeRefPtr<JsCommandUpdateDomElementStyles>(selfId);
-    auto attrCommand = Referenced::MakeRefPtr<JsCommandUpdateDomElementAttrs>(selfId);
-    auto ptr = Referenced::RawPtr(attrCommand);
-    if (shouldShow && hasShownAttr) {
-        attrs.emplace_back(std::make_pair("show", TRUE));
-    }
-    ParseAttributes(rootJson, selfId, attrs, static_cast<JsCommandDomElementOperator*>(ptr), dataJson, propsJson);
-    if (!shouldShow && hasShownAttr) {
-        attrs.emplace_back(std::make_pair("show", FALSE));
+    if (needUpdate) {
+        std::vector<std::pair<std::string, std::string>> attrs;
+        std::vector<std::pair<std::string, std::string>> styles(customStyles_);
+        customStyles_.clear();
+        std::vector<std::string> events;
+        auto styleCommand = Referenced::MakeRefPtr<JsCommandUpdateDomElementStyles>(selfId);
+        auto attrCommand = Referenced::MakeRefPtr<JsCommandUpdateDomElementAttrs>(selfId);
+        auto ptr = Referenced::RawPtr(attrCommand);
+        if (shouldShow && hasShownAttr) {
+            attrs.emplace_back(std::make_pair("show", TRUE));
+        }
+        ParseAttributes(rootJson, selfId, attrs, static_cast<JsCommandDomElementOperator*>(ptr), dataJson, propsJson);
+        if (!shouldShow && hasShownAttr) {
+            attrs.emplace_back(std::make_pair("show", FALSE));
+        }
+        ParseStyles(rootJson, selfId, styles, styleJson);
+        ParseEvents(rootJson, events, page, selfId);
+        attrCommand->SetAttributes(std::move(attrs));
+        styleCommand->SetStyles(std::move(styles));
+        page->PushCommand(attrCommand);
+        page->PushCommand(styleCommand);
     }
-    ParseStyles(rootJson, selfId, styles, styleJson);
-    ParseEvents(rootJson, events, page, selfId);
-    attrCommand->SetAttributes(std::move(attrs));
-    styleCommand->SetStyles(std::move(styles));
-    page->PushCommand(attrCommand);
-    page->PushCommand(styleCommand);
 
     auto childList = rootJson->GetValue("children");
     if (childList && childList->IsValid()) {
@@ -1892,7 +2078,8 @@ void JsCardParser::ProcessRepeatNode(const RefPtr<Framework::JsAcePage>& page,
         auto factor = loopIter->second;
         int32_t lastSize = factor > 0 ? array.size() / factor : 0;
         auto updateSize = std::min(static_cast<int32_t>(lastSize), repeatValue->GetArraySize());
-        for (auto i = 0; i < updateSize; ++i) {
+        // items not reading changed data are not walked, nodeId_ skips all ids of the repeat below.
+        for (auto i = 0; i < updateSize && updateMode_ != UpdateMode::NONE; ++i) {
             SetRepeatItemValue(i, repeatValue, hasKeyValue);
             UpdateDomNode(page, rootJson, parentId, array);
         }
@@ -2001,6 +2188,7 @@ bool JsCardParser::Initialize()
     // repeatJson contains dataJson.
     repeatJson_ = JsonUtil::ParseJsonString(dataJson_->ToString());
     LoadMediaQueryStyle();
+    CompileBinding(rootJson_);
     return true;
 }
 
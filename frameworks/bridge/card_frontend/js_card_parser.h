@@ -17,6 +17,8 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_JS_CARD_PARSER_H
 
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "base/memory/referenced.h"
@@ -28,6 +30,16 @@ namespace OHOS::Ace::Framework {
 
 enum class ParsingStatus { CREATE, UPDATE };
 
+// Data keys read by the bindings of a template node, collected once when the template is loaded.
+struct NodeBinding {
+    std::unordered_set<std::string> keys;
+    // Keys read by the node and all of its descendants, including the templates of custom components.
+    std::unordered_set<std::string> treeKeys;
+    // The node has bindings which are not analyzed, such as proxy actions, it is updated on every update.
+    bool isDynamic = false;
+    bool isTreeDynamic = false;
+};
+
 class ACE_EXPORT JsCardParser : public Referenced {
 public:
     JsCardParser(const WeakPtr<PipelineContext>& context, const WeakPtr<AssetManager>& assertManager,
@@ -195,6 +207,10 @@ private:
         const std::unique_ptr<JsonValue>& propsJson, const std::string& key, bool& value, bool& hasAttr);
     void ParseVersionAndUpdateData();
     void ReplaceParam(const std::unique_ptr<JsonValue>& node);
+    const NodeBinding& CompileBinding(const std::unique_ptr<JsonValue>& rootJson);
+    bool IsBindingChanged(const std::unique_ptr<JsonValue>& rootJson, bool withDescendants);
+    bool HasChangedKey(const std::unordered_set<std::string>& keys) const;
+    void CollectChangedKeys();
 
     double density_ = 1.0;
     int32_t nodeId_ = 0;
@@ -203,6 +219,12 @@ private:
     int32_t listNodeIndex_ = 0;
     ColorMode colorMode_ = ColorMode::LIGHT;
     ParsingStatus parsingStatus_ = ParsingStatus::CREATE;
+    // ALL updates every node, CHANGED only nodes reading changedKeys_. NONE updates no node, nodes are still walked to
+    // keep ids in step, except items of a repeat, whose ids are skipped as a whole.
+    enum class UpdateMode { ALL, CHANGED, NONE };
+    UpdateMode updateMode_ = UpdateMode::ALL;
+    std::unordered_set<std::string> changedKeys_;
+    std::unordered_map<const JsonObject*, NodeBinding> nodeBindings_;
     std::vector<int32_t> idArray_;
     WeakPtr<PipelineContext> context_;
     WeakPtr<AssetManager> assetManager_;
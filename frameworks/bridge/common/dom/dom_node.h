@@ -945,6 +945,9 @@ private:
     T ParseThemeReference(const std::string& value, std::function<T()>&& noRefFunc,
         std::function<T(uint32_t refId)>&& idRefFunc, const T& errorValue) const
     {
+        if (!ThemeUtils::MayBeThemeReference(value)) {
+            return noRefFunc();
+        }
         const auto& parseResult = ThemeUtils::ParseThemeIdReference(value, GetThemeConstants());
         if (!parseResult.parseSuccess) {
             return noRefFunc();
@@ -236,7 +236,7 @@ void QJSDeclarativeEngine::LoadJs(const std::string& url, const RefPtr<JsAcePage
         return;
     }
 
-    JSValue compiled = engineInstance_->CompileSource(GetInstanceName(), url, jsContent.c_str(), jsContent.size());
+    JSValue compiled = engineInstance_->CompileSource(url, jsContent.c_str(), jsContent.size());
     if (JS_IsException(compiled)) {
         LOGE("js compilation failed url=[%{public}s]", url.c_str());
         return;
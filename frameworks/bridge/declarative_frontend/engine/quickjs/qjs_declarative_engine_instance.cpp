@@ -16,11 +16,8 @@
 #include "frameworks/bridge/declarative_frontend/engine/quickjs/qjs_declarative_engine_instance.h"
 
 #include <cstdlib>
-#include <fcntl.h>
 #include <fstream>
 #include <streambuf>
-#include <sys/stat.h>
-#include <unistd.h>
 
 #include "base/log/ace_trace.h"
 #include "base/log/event_report.h"
@@ -32,9 +29,9 @@
 #include "frameworks/bridge/declarative_frontend/jsview/js_view_register.h"
 #include "frameworks/bridge/js_frontend/engine/common/js_constants.h"
 #include "frameworks/bridge/js_frontend/engine/common/runtime_constants.h"
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_group_js_bridge.h"
 #include "frameworks/core/common/ace_application_info.h"
-#include "frameworks/core/image/image_cache.h"
 
 #if !defined(WINDOWS_PLATFORM) and !defined(MAC_PLATFORM)
 #include "native_engine/impl/quickjs/quickjs_native_engine.h"
@@ -188,7 +185,7 @@ RefPtr<PipelineContext> QJSDeclarativeEngineInstance::GetPipelineContext(JSConte
 int QJSDeclarativeEngineInstance::EvalBuf(
     JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int evalFlags)
 {
-    JSValue val = JS_Eval(ctx, buf, bufLen, filename, evalFlags);
+    JSValue val = QJSBytecodeCache::GetInstance().Eval(ctx, buf, bufLen, filename, evalFlags);
     int32_t ret = JS_CALL_SUCCESS;
     if (JS_IsException(val)) {
         LOGE("[Qjs Native] EvalBuf failed!");
@@ -200,87 +197,18 @@ int QJSDeclarativeEngineInstance::EvalBuf(
     return ret;
 }
 
-void QJSDeclarativeEngineInstance::output_object_code(JSContext* ctx, int fho, JSValueConst obj)
-{
-    uint8_t* out_buf;
-    size_t out_buf_len;
-    out_buf = JS_WriteObject(ctx, &out_buf_len, obj, JS_WRITE_OBJ_BYTECODE);
-    if (!out_buf) {
-        js_std_dump_error(ctx);
-        return;
-    }
-
-    int count __attribute__((unused));
-    count = write(fho, out_buf, out_buf_len);
-    LOGD("Bytes written to file: %d vs. %zu", count, out_buf_len);
-
-    js_free(ctx, out_buf);
-}
-
-JSValue QJSDeclarativeEngineInstance::eval_binary_buf(JSContext* ctx, const uint8_t* buf, size_t buf_len)
-{
-    JSValue obj;
-    obj = JS_ReadObject(ctx, buf, buf_len, JS_READ_OBJ_BYTECODE);
-    if (JS_IsException(obj)) {
-        LOGE("eval_binary_buf (ReadObj) failed");
-        js_std_dump_error(ctx);
-        return obj;
-    }
-    js_std_loop(ctx);
-    return JS_EvalFunction(ctx, obj);
-}
-
-JSValue QJSDeclarativeEngineInstance::CompileSource(
-    std::string instanceName, std::string url, const char* buf, size_t bufSize)
+JSValue QJSDeclarativeEngineInstance::CompileSource(const std::string& url, const char* buf, size_t bufSize)
 {
     LOGD("Compiling file url %s", url.c_str());
 
     ACE_SCOPED_TRACE("Compile JS");
     JSContext* ctx = GetQJSContext();
-
-    // temporary use image cache path to store the snapshot
-    std::string separator = "/";
-#if defined(WINDOWS_PLATFORM)
-    separator = "\\";
-#endif
-    std::size_t h1 = std::hash<std::string> {}(instanceName + separator + url);
-    std::string filename = ImageCache::GetImageCacheFilePath() + separator;
-    filename.append(std::to_string(h1));
-
-    struct stat statbuf;
-    int statres = stat(filename.c_str(), &statbuf);
-
-    JSValue retVal = JS_NULL;
-    int fhi;
-    if (statres == 0 && (fhi = open(filename.c_str(), O_RDONLY)) != -1) {
-        uint8_t* in_buf = (uint8_t*)malloc(statbuf.st_size + 5);
-        if (!in_buf) {
-            close(fhi);
-            return JS_NULL;
-        }
-        read(fhi, in_buf, statbuf.st_size);
-        close(fhi);
-        retVal = eval_binary_buf(GetQJSContext(), in_buf, statbuf.st_size);
-        free(in_buf);
-    } else {
-        // Evaluate and write to the file
-        LOGD("cache file does not exist, compiling source file");
-        retVal = JS_Eval(GetQJSContext(), buf, bufSize, url.c_str(), JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
-        js_std_loop(ctx);
-        if (JS_IsException(retVal)) {
-            LOGE("Failed reading (source) JS file %s into QuickJS!", url.c_str());
-            QJSUtils::JsStdDumpErrorAce(ctx);
-            return JS_UNDEFINED;
-        }
-
-        int fho = creat(filename.c_str(), S_IRWXU | S_IRWXG | S_IRWXO);
-        if (fho != -1) {
-            LOGD("Compiled cache file opened for writing %s", filename.c_str());
-            output_object_code(GetQJSContext(), fho, retVal);
-            close(fho);
-        } else {
-            LOGE("Compiled cache file writing failed to %s", filename.c_str());
-        }
+    JSValue retVal = QJSBytecodeCache::GetInstance().Eval(
+        ctx, buf, bufSize, url.c_str(), JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    js_std_loop(ctx);
+    if (JS_IsException(retVal)) {
+        LOGE("Failed reading (source) JS file %s into QuickJS!", url.c_str());
+        QJSUtils::JsStdDumpErrorAce(ctx);
     }
     return retVal;
 }
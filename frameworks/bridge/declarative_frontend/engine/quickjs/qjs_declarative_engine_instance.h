@@ -95,7 +95,7 @@ public:
         return frontendDelegate_;
     }
 
-    JSValue CompileSource(std::string instanceName, std::string url, const char* buf, size_t bufSize);
+    JSValue CompileSource(const std::string& url, const char* buf, size_t bufSize);
 
     void CallPlatformFunction(const std::string& channel, std::vector<uint8_t>&& data, int32_t id, int32_t groupType)
     {
@@ -157,9 +157,6 @@ public:
     static int EvalBuf(JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int evalFlags);
 
 private:
-    void output_object_code(JSContext* ctx, int fho, JSValueConst obj);
-    JSValue eval_binary_buf(JSContext* ctx, const uint8_t* buf, size_t buf_len);
-
     thread_local static JSRuntime* runtime_;
     JSContext* context_ = nullptr;
     RefPtr<FrontendDelegate> frontendDelegate_;
@@ -559,6 +559,10 @@ bool FrontendDelegateDeclarative::OnRestoreData(const std::string& data)
 
 void FrontendDelegateDeclarative::OnMemoryLevel(const int32_t level)
 {
+    auto pipelineContext = pipelineContextHolder_.Get();
+    if (pipelineContext && pipelineContext->GetImageCache()) {
+        pipelineContext->GetImageCache()->OnMemoryLevel(level);
+    }
     taskExecutor_->PostTask(
         [onMemoryLevel = onMemoryLevel_, level]() {
             if (onMemoryLevel) {
@@ -41,6 +41,24 @@
 #include "core/pipeline/base/sole_child_component.h"
 
 namespace OHOS::Ace::Framework {
+namespace {
+
+// Names of the wrapping slots, used as keys of the map handed to the video component and in stack dumps.
+constexpr const char* WRAPPING_SLOT_NAMES[] = { "main", "root", "coverage", "popup", "menu", "position", "flexItem",
+    "stepperItem", "stepperDisplay", "stepperScroll", "box", "display", "transform", "touch", "mouse", "click_gesture",
+    "focusable", "pan_gesture", "shared_transition", "gesture", "inspector", "scoring" };
+static_assert(sizeof(WRAPPING_SLOT_NAMES) / sizeof(WRAPPING_SLOT_NAMES[0]) ==
+                  static_cast<size_t>(WrappingSlot::COUNT),
+    "every wrapping slot needs a name");
+
+// Order in which the wrapping components are nested around the main component, outermost first.
+constexpr WrappingSlot WRAPPING_ORDER[] = { WrappingSlot::STEPPER_ITEM, WrappingSlot::STEPPER_DISPLAY,
+    WrappingSlot::FLEX_ITEM, WrappingSlot::DISPLAY, WrappingSlot::TRANSFORM, WrappingSlot::TOUCH,
+    WrappingSlot::PAN_GESTURE, WrappingSlot::CLICK_GESTURE, WrappingSlot::FOCUSABLE, WrappingSlot::COVERAGE,
+    WrappingSlot::BOX, WrappingSlot::SHARED_TRANSITION, WrappingSlot::MOUSE, WrappingSlot::STEPPER_SCROLL };
+
+} // namespace
+
 thread_local std::unique_ptr<ViewStackProcessor> ViewStackProcessor::instance = nullptr;
 thread_local int32_t ViewStackProcessor::composedElementId_ = 1;
 
@@ -70,35 +88,35 @@ std::shared_ptr<JsPageCheckboxGroups> ViewStackProcessor::GetCheckboxGroupCompne
 
 RefPtr<ComposedComponent> ViewStackProcessor::GetRootComponent(const std::string& id, const std::string& name)
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("root") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<ComposedComponent>(wrappingComponentsMap["root"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::ROOT]) {
+        return AceType::DynamicCast<ComposedComponent>(wrappingComponents[WrappingSlot::ROOT]);
     }
 
     RefPtr<ComposedComponent> rootComponent = AceType::MakeRefPtr<OHOS::Ace::ComposedComponent>(id, name);
-    wrappingComponentsMap.emplace("root", rootComponent);
+    wrappingComponents.Emplace(WrappingSlot::ROOT, rootComponent);
     return rootComponent;
 }
 
 RefPtr<CoverageComponent> ViewStackProcessor::GetCoverageComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("coverage") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<CoverageComponent>(wrappingComponentsMap["coverage"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::COVERAGE]) {
+        return AceType::DynamicCast<CoverageComponent>(wrappingComponents[WrappingSlot::COVERAGE]);
     }
 
     std::list<RefPtr<Component>> children;
     RefPtr<CoverageComponent> coverageComponent = AceType::MakeRefPtr<OHOS::Ace::CoverageComponent>(children);
-    wrappingComponentsMap.emplace("coverage", coverageComponent);
+    wrappingComponents.Emplace(WrappingSlot::COVERAGE, coverageComponent);
     return coverageComponent;
 }
 
 #ifndef WEARABLE_PRODUCT
 RefPtr<PopupComponentV2> ViewStackProcessor::GetPopupComponent(bool createNewComponent)
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("popup") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<PopupComponentV2>(wrappingComponentsMap["popup"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::POPUP]) {
+        return AceType::DynamicCast<PopupComponentV2>(wrappingComponents[WrappingSlot::POPUP]);
     }
 
     if (!createNewComponent) {
@@ -106,16 +124,16 @@ RefPtr<PopupComponentV2> ViewStackProcessor::GetPopupComponent(bool createNewCom
     }
 
     RefPtr<PopupComponentV2> popupComponent = AceType::MakeRefPtr<OHOS::Ace::PopupComponentV2>(GenerateId(), "popup");
-    wrappingComponentsMap.emplace("popup", popupComponent);
+    wrappingComponents.Emplace(WrappingSlot::POPUP, popupComponent);
     return popupComponent;
 }
 #endif
 
 RefPtr<MenuComponent> ViewStackProcessor::GetMenuComponent(bool createNewComponent)
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("menu") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<MenuComponent>(wrappingComponentsMap["menu"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::MENU]) {
+        return AceType::DynamicCast<MenuComponent>(wrappingComponents[WrappingSlot::MENU]);
     }
 
     if (!createNewComponent) {
@@ -123,75 +141,75 @@ RefPtr<MenuComponent> ViewStackProcessor::GetMenuComponent(bool createNewCompone
     }
 
     RefPtr<MenuComponent> menuComponent = AceType::MakeRefPtr<OHOS::Ace::MenuComponent>(GenerateId(), "menu");
-    wrappingComponentsMap.emplace("menu", menuComponent);
+    wrappingComponents.Emplace(WrappingSlot::MENU, menuComponent);
     return menuComponent;
 }
 
 RefPtr<PositionedComponent> ViewStackProcessor::GetPositionedComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("position") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<PositionedComponent>(wrappingComponentsMap["position"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::POSITION]) {
+        return AceType::DynamicCast<PositionedComponent>(wrappingComponents[WrappingSlot::POSITION]);
     }
 
     RefPtr<PositionedComponent> positionedComponent = AceType::MakeRefPtr<OHOS::Ace::PositionedComponent>();
-    wrappingComponentsMap.emplace("position", positionedComponent);
+    wrappingComponents.Emplace(WrappingSlot::POSITION, positionedComponent);
     return positionedComponent;
 }
 
 RefPtr<FlexItemComponent> ViewStackProcessor::GetFlexItemComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("flexItem") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<FlexItemComponent>(wrappingComponentsMap["flexItem"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::FLEX_ITEM]) {
+        return AceType::DynamicCast<FlexItemComponent>(wrappingComponents[WrappingSlot::FLEX_ITEM]);
     }
 
     RefPtr<FlexItemComponent> flexItem = AceType::MakeRefPtr<OHOS::Ace::FlexItemComponent>(0.0, 0.0, 0.0);
-    wrappingComponentsMap.emplace("flexItem", flexItem);
+    wrappingComponents.Emplace(WrappingSlot::FLEX_ITEM, flexItem);
     return flexItem;
 }
 
 RefPtr<StepperItemComponent> ViewStackProcessor::GetStepperItemComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("stepperItem") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<StepperItemComponent>(wrappingComponentsMap["stepperItem"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::STEPPER_ITEM]) {
+        return AceType::DynamicCast<StepperItemComponent>(wrappingComponents[WrappingSlot::STEPPER_ITEM]);
     }
 
     RefPtr<StepperItemComponent> stepperItem = AceType::MakeRefPtr<StepperItemComponent>(RefPtr<Component>());
-    wrappingComponentsMap.emplace("stepperItem", stepperItem);
+    wrappingComponents.Emplace(WrappingSlot::STEPPER_ITEM, stepperItem);
     return stepperItem;
 }
 
 RefPtr<DisplayComponent> ViewStackProcessor::GetStepperDisplayComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("stepperDisplay") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<DisplayComponent>(wrappingComponentsMap["stepperDisplay"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::STEPPER_DISPLAY]) {
+        return AceType::DynamicCast<DisplayComponent>(wrappingComponents[WrappingSlot::STEPPER_DISPLAY]);
     }
 
     RefPtr<DisplayComponent> stepperDisplay = AceType::MakeRefPtr<DisplayComponent>();
-    wrappingComponentsMap.emplace("stepperDisplay", stepperDisplay);
+    wrappingComponents.Emplace(WrappingSlot::STEPPER_DISPLAY, stepperDisplay);
     return stepperDisplay;
 }
 
 RefPtr<ScrollComponent> ViewStackProcessor::GetStepperScrollComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("stepperScroll") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<ScrollComponent>(wrappingComponentsMap["stepperScroll"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::STEPPER_SCROLL]) {
+        return AceType::DynamicCast<ScrollComponent>(wrappingComponents[WrappingSlot::STEPPER_SCROLL]);
     }
 
     RefPtr<ScrollComponent> stepperScroll = AceType::MakeRefPtr<ScrollComponent>(RefPtr<Component>());
-    wrappingComponentsMap.emplace("stepperScroll", stepperScroll);
+    wrappingComponents.Emplace(WrappingSlot::STEPPER_SCROLL, stepperScroll);
     return stepperScroll;
 }
 
 RefPtr<BoxComponent> ViewStackProcessor::GetBoxComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("box") != wrappingComponentsMap.end()) {
-        auto boxComponent = AceType::DynamicCast<BoxComponent>(wrappingComponentsMap["box"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::BOX]) {
+        auto boxComponent = AceType::DynamicCast<BoxComponent>(wrappingComponents[WrappingSlot::BOX]);
         if (boxComponent) {
             return boxComponent;
         }
@@ -201,27 +219,22 @@ RefPtr<BoxComponent> ViewStackProcessor::GetBoxComponent()
     if (SystemProperties::GetDebugBoundaryEnabled()) {
         boxComponent->SetEnableDebugBoundary(true);
     }
-    wrappingComponentsMap.emplace("box", boxComponent);
+    wrappingComponents.Emplace(WrappingSlot::BOX, boxComponent);
     return boxComponent;
 }
 
 RefPtr<Component> ViewStackProcessor::GetMainComponent() const
 {
-    if (componentsStack_.empty()) {
+    if (componentsStack_.Empty()) {
         return nullptr;
     }
-    auto& wrappingComponentsMap = componentsStack_.top();
-    auto main = wrappingComponentsMap.find("main");
-    if (main == wrappingComponentsMap.end()) {
-        return nullptr;
-    }
-    return main->second;
+    return TopFrame()[WrappingSlot::MAIN];
 }
 
 bool ViewStackProcessor::HasDisplayComponent() const
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("display") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::DISPLAY]) {
         return true;
     }
     return false;
@@ -229,38 +242,38 @@ bool ViewStackProcessor::HasDisplayComponent() const
 
 RefPtr<DisplayComponent> ViewStackProcessor::GetDisplayComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("display") != wrappingComponentsMap.end()) {
-        auto displayComponent = AceType::DynamicCast<DisplayComponent>(wrappingComponentsMap["display"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::DISPLAY]) {
+        auto displayComponent = AceType::DynamicCast<DisplayComponent>(wrappingComponents[WrappingSlot::DISPLAY]);
         if (displayComponent) {
             return displayComponent;
         }
     }
 
     RefPtr<DisplayComponent> displayComponent = AceType::MakeRefPtr<OHOS::Ace::DisplayComponent>();
-    wrappingComponentsMap.emplace("display", displayComponent);
+    wrappingComponents.Emplace(WrappingSlot::DISPLAY, displayComponent);
     return displayComponent;
 }
 
 RefPtr<TransformComponent> ViewStackProcessor::GetTransformComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("transform") != wrappingComponentsMap.end()) {
-        auto transformComponent = AceType::DynamicCast<TransformComponent>(wrappingComponentsMap["transform"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::TRANSFORM]) {
+        auto transformComponent = AceType::DynamicCast<TransformComponent>(wrappingComponents[WrappingSlot::TRANSFORM]);
         if (transformComponent) {
             return transformComponent;
         }
     }
 
     RefPtr<TransformComponent> transformComponent = AceType::MakeRefPtr<OHOS::Ace::TransformComponent>();
-    wrappingComponentsMap.emplace("transform", transformComponent);
+    wrappingComponents.Emplace(WrappingSlot::TRANSFORM, transformComponent);
     return transformComponent;
 }
 
 bool ViewStackProcessor::HasTouchListenerComponent() const
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("touch") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::TOUCH]) {
         return true;
     }
     return false;
@@ -268,38 +281,40 @@ bool ViewStackProcessor::HasTouchListenerComponent() const
 
 RefPtr<TouchListenerComponent> ViewStackProcessor::GetTouchListenerComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("touch") != wrappingComponentsMap.end()) {
-        auto touchListenerComponent = AceType::DynamicCast<TouchListenerComponent>(wrappingComponentsMap["touch"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::TOUCH]) {
+        auto touchListenerComponent =
+            AceType::DynamicCast<TouchListenerComponent>(wrappingComponents[WrappingSlot::TOUCH]);
         if (touchListenerComponent) {
             return touchListenerComponent;
         }
     }
 
     RefPtr<TouchListenerComponent> touchComponent = AceType::MakeRefPtr<OHOS::Ace::TouchListenerComponent>();
-    wrappingComponentsMap.emplace("touch", touchComponent);
+    wrappingComponents.Emplace(WrappingSlot::TOUCH, touchComponent);
     return touchComponent;
 }
 
 RefPtr<MouseListenerComponent> ViewStackProcessor::GetMouseListenerComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("mouse") != wrappingComponentsMap.end()) {
-        auto mouseListenerComponent = AceType::DynamicCast<MouseListenerComponent>(wrappingComponentsMap["mouse"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::MOUSE]) {
+        auto mouseListenerComponent =
+            AceType::DynamicCast<MouseListenerComponent>(wrappingComponents[WrappingSlot::MOUSE]);
         if (mouseListenerComponent) {
             return mouseListenerComponent;
         }
     }
 
     RefPtr<MouseListenerComponent> mouseComponent = AceType::MakeRefPtr<OHOS::Ace::MouseListenerComponent>();
-    wrappingComponentsMap.emplace("mouse", mouseComponent);
+    wrappingComponents.Emplace(WrappingSlot::MOUSE, mouseComponent);
     return mouseComponent;
 }
 
 bool ViewStackProcessor::HasClickGestureListenerComponent() const
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("click_gesture") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::CLICK_GESTURE]) {
         return true;
     }
     return false;
@@ -307,10 +322,10 @@ bool ViewStackProcessor::HasClickGestureListenerComponent() const
 
 RefPtr<GestureListenerComponent> ViewStackProcessor::GetClickGestureListenerComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("click_gesture") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::CLICK_GESTURE]) {
         auto gestureListenerComponent =
-            AceType::DynamicCast<GestureListenerComponent>(wrappingComponentsMap["click_gesture"]);
+            AceType::DynamicCast<GestureListenerComponent>(wrappingComponents[WrappingSlot::CLICK_GESTURE]);
         if (gestureListenerComponent) {
             return gestureListenerComponent;
         }
@@ -318,19 +333,19 @@ RefPtr<GestureListenerComponent> ViewStackProcessor::GetClickGestureListenerComp
 
     RefPtr<GestureListenerComponent> clickGestureComponent =
         AceType::MakeRefPtr<OHOS::Ace::GestureListenerComponent>();
-    wrappingComponentsMap.emplace("click_gesture", clickGestureComponent);
+    wrappingComponents.Emplace(WrappingSlot::CLICK_GESTURE, clickGestureComponent);
     return clickGestureComponent;
 }
 
 RefPtr<FocusableComponent> ViewStackProcessor::GetFocusableComponent(bool createIfNotExist)
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("focusable") != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<FocusableComponent>(wrappingComponentsMap["focusable"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::FOCUSABLE]) {
+        return AceType::DynamicCast<FocusableComponent>(wrappingComponents[WrappingSlot::FOCUSABLE]);
     }
     if (createIfNotExist) {
         RefPtr<FocusableComponent> focusableComponent = AceType::MakeRefPtr<OHOS::Ace::FocusableComponent>();
-        wrappingComponentsMap.emplace("focusable", focusableComponent);
+        wrappingComponents.Emplace(WrappingSlot::FOCUSABLE, focusableComponent);
         return focusableComponent;
     }
     return nullptr;
@@ -338,26 +353,26 @@ RefPtr<FocusableComponent> ViewStackProcessor::GetFocusableComponent(bool create
 
 RefPtr<GestureListenerComponent> ViewStackProcessor::GetPanGestureListenerComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("pan_gesture") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::PAN_GESTURE]) {
         auto gestureListenerComponent =
-            AceType::DynamicCast<GestureListenerComponent>(wrappingComponentsMap["pan_gesture"]);
+            AceType::DynamicCast<GestureListenerComponent>(wrappingComponents[WrappingSlot::PAN_GESTURE]);
         if (gestureListenerComponent) {
             return gestureListenerComponent;
         }
     }
 
     RefPtr<GestureListenerComponent> panGestureComponent = AceType::MakeRefPtr<OHOS::Ace::GestureListenerComponent>();
-    wrappingComponentsMap.emplace("pan_gesture", panGestureComponent);
+    wrappingComponents.Emplace(WrappingSlot::PAN_GESTURE, panGestureComponent);
     return panGestureComponent;
 }
 
 RefPtr<SharedTransitionComponent> ViewStackProcessor::GetSharedTransitionComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("shared_transition") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::SHARED_TRANSITION]) {
         auto sharedTransitionComponent =
-            AceType::DynamicCast<SharedTransitionComponent>(wrappingComponentsMap["shared_transition"]);
+            AceType::DynamicCast<SharedTransitionComponent>(wrappingComponents[WrappingSlot::SHARED_TRANSITION]);
         if (sharedTransitionComponent) {
             return sharedTransitionComponent;
         }
@@ -365,22 +380,22 @@ RefPtr<SharedTransitionComponent> ViewStackProcessor::GetSharedTransitionCompone
 
     RefPtr<SharedTransitionComponent> sharedTransitionComponent =
         AceType::MakeRefPtr<OHOS::Ace::SharedTransitionComponent>("", "", "");
-    wrappingComponentsMap.emplace("shared_transition", sharedTransitionComponent);
+    wrappingComponents.Emplace(WrappingSlot::SHARED_TRANSITION, sharedTransitionComponent);
     return sharedTransitionComponent;
 }
 
 RefPtr<GestureComponent> ViewStackProcessor::GetGestureComponent()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("gesture") != wrappingComponentsMap.end()) {
-        auto gestureComponent = AceType::DynamicCast<GestureComponent>(wrappingComponentsMap["gesture"]);
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::GESTURE]) {
+        auto gestureComponent = AceType::DynamicCast<GestureComponent>(wrappingComponents[WrappingSlot::GESTURE]);
         if (gestureComponent) {
             return gestureComponent;
         }
     }
 
     RefPtr<GestureComponent> gestureComponent = AceType::MakeRefPtr<OHOS::Ace::GestureComponent>();
-    wrappingComponentsMap.emplace("gesture", gestureComponent);
+    wrappingComponents.Emplace(WrappingSlot::GESTURE, gestureComponent);
     return gestureComponent;
 }
 
@@ -401,12 +416,10 @@ void ViewStackProcessor::ClearPageTransitionComponent()
 
 void ViewStackProcessor::Push(const RefPtr<Component>& component, bool isCustomView)
 {
-    std::unordered_map<std::string, RefPtr<Component>> wrappingComponentsMap;
-    if (componentsStack_.size() > 1 && ShouldPopImmediately()) {
+    if (componentsStack_.Depth() > 1 && ShouldPopImmediately()) {
         Pop();
     }
-    wrappingComponentsMap.emplace("main", component);
-    componentsStack_.push(wrappingComponentsMap);
+    componentsStack_.Push(component);
     std::string name;
     auto composedComponent = AceType::DynamicCast<ComposedComponent>(component);
     if (composedComponent) {
@@ -447,7 +460,7 @@ bool ViewStackProcessor::ShouldPopImmediately()
 
 void ViewStackProcessor::Pop()
 {
-    if (componentsStack_.size() == 1) {
+    if (componentsStack_.Depth() == 1) {
         return;
     }
 
@@ -463,7 +476,7 @@ void ViewStackProcessor::Pop()
 
     UpdateTopComponentProps(component);
 
-    componentsStack_.pop();
+    componentsStack_.Pop();
     auto componentGroup = AceType::DynamicCast<ComponentGroup>(GetMainComponent());
     auto multiComposedComponent = AceType::DynamicCast<MultiComposedComponent>(GetMainComponent());
     if (componentGroup) {
@@ -476,7 +489,7 @@ void ViewStackProcessor::Pop()
             singleChild->SetChild(component);
         }
     }
-    LOGD("ViewStackProcessor Pop size %{public}zu", componentsStack_.size());
+    LOGD("ViewStackProcessor Pop size %{public}zu", componentsStack_.Depth());
 }
 
 RefPtr<Component> ViewStackProcessor::GetNewComponent()
@@ -491,7 +504,7 @@ RefPtr<Component> ViewStackProcessor::GetNewComponent()
         SetIsPercentSize(component);
     }
     UpdateTopComponentProps(component);
-    componentsStack_.pop();
+    componentsStack_.Pop();
     return component;
 }
 
@@ -521,35 +534,27 @@ void ViewStackProcessor::PopContainer()
 #ifdef ACE_DEBUG_LOG
 void ViewStackProcessor::DumpStack()
 {
-    LOGD("| stack size: \033[0;33m %{public}d \033[0m", (int)componentsStack_.size());
-    if (componentsStack_.empty()) {
-        return;
-    }
-    LOGD("| stack top size: \033[0;33m %{public}d \033[0m", (int)componentsStack_.top().size());
-    std::stack<std::unordered_map<std::string, RefPtr<Component>>> tmp;
+    LOGD("| stack size: \033[0;33m %{public}d \033[0m", (int)componentsStack_.Depth());
     int count = 0;
-    while (!componentsStack_.empty()) {
+    for (auto level = componentsStack_.Depth(); level > 0; --level) {
         LOGD("| stack level: \033[0;33m %{public}d \033[0m", count++);
-        auto& wrappingComponentsMap = componentsStack_.top();
-        for (const auto& j : wrappingComponentsMap) {
-            LOGD("|\033[0;36m %{public}s - %{public}s \033[0m", j.first.c_str(), AceType::TypeName(j.second));
+        const auto& wrappingComponents = componentsStack_.At(level - 1);
+        for (size_t slot = 0; slot < wrappingComponents.slots.size(); ++slot) {
+            if (wrappingComponents.slots[slot]) {
+                LOGD("|\033[0;36m %{public}s - %{public}s \033[0m", WRAPPING_SLOT_NAMES[slot],
+                    AceType::TypeName(wrappingComponents.slots[slot]));
+            }
         }
-        tmp.push(componentsStack_.top());
-        componentsStack_.pop();
-    }
-    while (!tmp.empty()) {
-        componentsStack_.push(tmp.top());
-        tmp.pop();
     }
 }
 #endif
 
 RefPtr<Component> ViewStackProcessor::WrapComponents()
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
+    auto& wrappingComponents = TopFrame();
     std::vector<RefPtr<Component>> components;
 
-    auto mainComponent = wrappingComponentsMap["main"];
+    auto mainComponent = wrappingComponents[WrappingSlot::MAIN];
 
     auto videoComponentV2 = AceType::DynamicCast<VideoComponentV2>(mainComponent);
     SaveComponentEvent saveComponentEvent;
@@ -579,25 +584,21 @@ RefPtr<Component> ViewStackProcessor::WrapComponents()
         components.emplace_back(scoringComponent);
     }
 
-    std::string componentNames[] = { "stepperItem", "stepperDisplay", "flexItem", "display", "transform", "touch",
-        "pan_gesture", "click_gesture", "focusable", "coverage", "box", "shared_transition", "mouse",
-        "stepperScroll" };
-    for (auto& name : componentNames) {
-        auto iter = wrappingComponentsMap.find(name);
-        if (iter != wrappingComponentsMap.end()) {
-            iter->second->OnWrap();
-            components.emplace_back(iter->second);
+    for (auto slot : WRAPPING_ORDER) {
+        const auto& wrappingComponent = wrappingComponents[slot];
+        if (wrappingComponent) {
+            wrappingComponent->OnWrap();
+            components.emplace_back(wrappingComponent);
             if (videoComponentV2 && saveComponentEvent) {
-                videoMap.emplace(std::make_pair(name, iter->second));
+                videoMap.emplace(WRAPPING_SLOT_NAMES[static_cast<size_t>(slot)], wrappingComponent);
             }
         }
     }
 
-    if (wrappingComponentsMap.find("shared_transition") != wrappingComponentsMap.end() &&
-        wrappingComponentsMap.find("display") != wrappingComponentsMap.end()) {
+    if (wrappingComponents[WrappingSlot::SHARED_TRANSITION] && wrappingComponents[WrappingSlot::DISPLAY]) {
         auto sharedTransitionComponent =
-            AceType::DynamicCast<SharedTransitionComponent>(wrappingComponentsMap["shared_transition"]);
-        auto displayComponent = AceType::DynamicCast<DisplayComponent>(wrappingComponentsMap["display"]);
+            AceType::DynamicCast<SharedTransitionComponent>(wrappingComponents[WrappingSlot::SHARED_TRANSITION]);
+        auto displayComponent = AceType::DynamicCast<DisplayComponent>(wrappingComponents[WrappingSlot::DISPLAY]);
         if (sharedTransitionComponent && displayComponent) {
             sharedTransitionComponent->SetOpacity(displayComponent->GetOpacity());
         }
@@ -670,9 +671,9 @@ RefPtr<Component> ViewStackProcessor::WrapComponents()
     }
 
     auto component = components.front();
-    auto iter = wrappingComponentsMap.find("box");
-    if (iter != wrappingComponentsMap.end() && (iter->second->GetTextDirection() != component->GetTextDirection())) {
-        component->SetTextDirection(iter->second->GetTextDirection());
+    const auto& boxComponent = wrappingComponents[WrappingSlot::BOX];
+    if (boxComponent && (boxComponent->GetTextDirection() != component->GetTextDirection())) {
+        component->SetTextDirection(boxComponent->GetTextDirection());
     }
 
     for (auto&& component : components) {
@@ -684,8 +685,8 @@ RefPtr<Component> ViewStackProcessor::WrapComponents()
 
 void ViewStackProcessor::UpdateTopComponentProps(const RefPtr<Component>& component)
 {
-    auto& wrappingComponentsMap = componentsStack_.top();
-    if (wrappingComponentsMap.find("position") != wrappingComponentsMap.end()) {
+    auto& wrappingComponents = TopFrame();
+    if (wrappingComponents[WrappingSlot::POSITION]) {
         auto renderComponent = AceType::DynamicCast<RenderComponent>(component);
         if (renderComponent) {
             auto positionedComponent = GetPositionedComponent();
@@ -704,7 +705,7 @@ void ViewStackProcessor::UpdateTopComponentProps(const RefPtr<Component>& compon
         }
     }
 
-    if (wrappingComponentsMap.find("root") != wrappingComponentsMap.end()) {
+    if (wrappingComponents[WrappingSlot::ROOT]) {
         auto rootComponent = GetRootComponent();
         component->SetDisabledStatus(rootComponent->IsDisabledStatus());
     }
@@ -712,7 +713,7 @@ void ViewStackProcessor::UpdateTopComponentProps(const RefPtr<Component>& compon
 
 RefPtr<Component> ViewStackProcessor::Finish()
 {
-    if (componentsStack_.empty()) {
+    if (componentsStack_.Empty()) {
         LOGE("ViewStackProcessor Finish failed, input empty render or invalid root component");
         return nullptr;
     }
@@ -723,9 +724,9 @@ RefPtr<Component> ViewStackProcessor::Finish()
     } else {
         SetZIndex(component);
     }
-    componentsStack_.pop();
+    componentsStack_.Pop();
 
-    LOGD("ViewStackProcessor Finish size %{public}zu", componentsStack_.size());
+    LOGD("ViewStackProcessor Finish size %{public}zu", componentsStack_.Depth());
     return component;
 }
 
@@ -791,36 +792,26 @@ std::string ViewStackProcessor::GenerateId()
 
 RefPtr<V2::InspectorComposedComponent> ViewStackProcessor::GetInspectorComposedComponent() const
 {
-    if (componentsStack_.empty()) {
+    if (componentsStack_.Empty()) {
         return nullptr;
     }
-    auto& wrappingComponentsMap = componentsStack_.top();
-    auto iter = wrappingComponentsMap.find("inspector");
-    if (iter != wrappingComponentsMap.end()) {
-        return AceType::DynamicCast<V2::InspectorComposedComponent>(iter->second);
-    }
-    return nullptr;
+    return AceType::DynamicCast<V2::InspectorComposedComponent>(TopFrame()[WrappingSlot::INSPECTOR]);
 }
 
 RefPtr<Component> ViewStackProcessor::GetScoringComponent() const
 {
-    if (componentsStack_.empty()) {
+    if (componentsStack_.Empty()) {
         return nullptr;
     }
-    auto& wrappingComponentsMap = componentsStack_.top();
-    auto iter = wrappingComponentsMap.find("scoring");
-    if (iter != wrappingComponentsMap.end()) {
-        return iter->second;
-    }
-    return nullptr;
+    return TopFrame()[WrappingSlot::SCORING];
 }
 
 void ViewStackProcessor::CreateInspectorComposedComponent(const std::string& inspectorTag)
 {
     if (V2::InspectorComposedComponent::HasInspectorFinished(inspectorTag)) {
         auto composedComponent = AceType::MakeRefPtr<V2::InspectorComposedComponent>(GenerateId(), inspectorTag);
-        auto& wrappingComponentsMap = componentsStack_.top();
-        wrappingComponentsMap.emplace("inspector", composedComponent);
+        auto& wrappingComponents = TopFrame();
+        wrappingComponents.Emplace(WrappingSlot::INSPECTOR, composedComponent);
     }
 }
 
@@ -837,8 +828,8 @@ void ViewStackProcessor::CreateScoringComponent(const std::string& tag)
     if (isScoringEnable_ && V2::InspectorComposedComponent::HasInspectorFinished(tag)) {
         auto component =
             AceType::MakeRefPtr<ScoringComponent>(V2::InspectorComposedComponent::GetEtsTag(tag), viewKey_);
-        auto& wrappingComponentsMap = componentsStack_.top();
-        wrappingComponentsMap.emplace("scoring", component);
+        auto& wrappingComponents = TopFrame();
+        wrappingComponents.Emplace(WrappingSlot::SCORING, component);
     }
 }
 
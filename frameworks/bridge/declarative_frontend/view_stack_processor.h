@@ -24,6 +24,7 @@
 #include "core/accessibility/accessibility_node.h"
 #include "core/components/common/properties/animation_option.h"
 #include "core/pipeline/base/component.h"
+#include "frameworks/bridge/declarative_frontend/wrapping_components.h"
 #include "frameworks/core/components/box/box_component.h"
 #include "frameworks/core/components/checkable/radio_group_component.h"
 #include "frameworks/core/components/coverage/coverage_component.h"
@@ -171,8 +172,9 @@ public:
 
     void ClearStack()
     {
-        auto emptyStack = std::stack<std::unordered_map<std::string, RefPtr<Component>>>();
-        componentsStack_.swap(emptyStack);
+        while (!componentsStack_.Empty()) {
+            componentsStack_.Pop();
+        }
     }
 
 private:
@@ -180,6 +182,16 @@ private:
 
     bool ShouldPopImmediately();
 
+    WrappingComponents& TopFrame()
+    {
+        return componentsStack_.Top();
+    }
+
+    const WrappingComponents& TopFrame() const
+    {
+        return componentsStack_.Top();
+    }
+
 #ifdef ACE_DEBUG_LOG
     // Dump view stack comtent
     void DumpStack();
@@ -199,8 +211,7 @@ private:
     // Singleton instance
     static thread_local std::unique_ptr<ViewStackProcessor> instance;
 
-    // stack
-    std::stack<std::unordered_map<std::string, RefPtr<Component>>> componentsStack_;
+    WrappingComponentsStack componentsStack_;
     std::shared_ptr<JsPageRadioGroups> radioGroups_;
     std::shared_ptr<JsPageCheckboxGroups> checkboxGroups_;
     // stack for tabs component.
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMEWORKS_BRIDGE_DECLARATIVE_FRONTEND_WRAPPING_COMPONENTS_H
+#define FRAMEWORKS_BRIDGE_DECLARATIVE_FRONTEND_WRAPPING_COMPONENTS_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+
+#include "core/pipeline/base/component.h"
+
+namespace OHOS::Ace::Framework {
+
+// Components that may wrap the main component of a view, each one owns a slot of the stack frame.
+enum class WrappingSlot : uint8_t {
+    MAIN = 0,
+    ROOT,
+    COVERAGE,
+    POPUP,
+    MENU,
+    POSITION,
+    FLEX_ITEM,
+    STEPPER_ITEM,
+    STEPPER_DISPLAY,
+    STEPPER_SCROLL,
+    BOX,
+    DISPLAY,
+    TRANSFORM,
+    TOUCH,
+    MOUSE,
+    CLICK_GESTURE,
+    FOCUSABLE,
+    PAN_GESTURE,
+    SHARED_TRANSITION,
+    GESTURE,
+    INSPECTOR,
+    SCORING,
+    COUNT,
+};
+
+// One frame of the view stack: the main component of a view and the components wrapping it.
+struct WrappingComponents {
+    std::array<RefPtr<Component>, static_cast<size_t>(WrappingSlot::COUNT)> slots;
+
+    RefPtr<Component>& operator[](WrappingSlot slot)
+    {
+        return slots[static_cast<size_t>(slot)];
+    }
+
+    const RefPtr<Component>& operator[](WrappingSlot slot) const
+    {
+        return slots[static_cast<size_t>(slot)];
+    }
+
+    // Same as emplace of a map, the component already in the slot is kept.
+    void Emplace(WrappingSlot slot, const RefPtr<Component>& component)
+    {
+        auto& current = slots[static_cast<size_t>(slot)];
+        if (!current) {
+            current = component;
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& component : slots) {
+            component.Reset();
+        }
+    }
+};
+
+// Stack of wrapping components. Popped frames are cleared and kept for reuse by later pushes. Frames are held in a
+// deque, so a frame returned by Top() stays valid while other frames are pushed, until it is popped itself.
+class WrappingComponentsStack final {
+public:
+    void Push(const RefPtr<Component>& mainComponent)
+    {
+        if (depth_ == frames_.size()) {
+            frames_.emplace_back();
+        }
+        frames_[depth_++][WrappingSlot::MAIN] = mainComponent;
+    }
+
+    void Pop()
+    {
+        if (depth_ == 0) {
+            return;
+        }
+        // Keep the frame for the next push, only drop the components it holds.
+        frames_[--depth_].Clear();
+    }
+
+    // Must not be called on an empty stack.
+    WrappingComponents& Top()
+    {
+        return frames_[depth_ - 1];
+    }
+
+    const WrappingComponents& Top() const
+    {
+        return frames_[depth_ - 1];
+    }
+
+    // Frame at the given level, from 0 at the bottom up to Depth() - 1 at the top.
+    const WrappingComponents& At(size_t level) const
+    {
+        return frames_[level];
+    }
+
+    size_t Depth() const
+    {
+        return depth_;
+    }
+
+    bool Empty() const
+    {
+        return depth_ == 0;
+    }
+
+    // Frames allocated so far, in use or kept for reuse.
+    size_t Capacity() const
+    {
+        return frames_.size();
+    }
+
+private:
+    std::deque<WrappingComponents> frames_;
+    size_t depth_ = 0;
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FRAMEWORKS_BRIDGE_DECLARATIVE_FRONTEND_WRAPPING_COMPONENTS_H
@@ -1804,17 +1804,15 @@ shared_ptr<JsValue>  JsiCanvasBridge::JsGetPixelMap(const shared_ptr<JsRuntime>&
     delegate->PostSyncTaskToPage(task);
 
     // 1 Get data from canvas
+    if (!imageData || !imageData->HasPixels()) {
+        LOGE("image data is empty.");
+        return runtime->NewUndefined();
+    }
     uint32_t final_height = static_cast<uint32_t>(imageData->dirtyHeight);
     uint32_t final_width = static_cast<uint32_t>(imageData->dirtyWidth);
     uint32_t length = final_height * final_width;
-    uint32_t* data = new uint32_t[length];
-    for (uint32_t i = 0; i < final_height; i++) {
-        for (uint32_t j = 0; j < final_width; j++) {
-            uint32_t idx = i * final_width + j;
-            Color pixel = imageData->data[idx];
-            data[idx] = pixel.GetValue();
-        }
-    }
+    // The colors of the image data are packed 32-bit values, hand them to the pixel map without a copy.
+    const uint32_t* data = imageData->GetPixels();
 
     // 2 Create pixelmap
     OHOS::Media::InitializationOptions options;
@@ -1825,7 +1823,6 @@ shared_ptr<JsValue>  JsiCanvasBridge::JsGetPixelMap(const shared_ptr<JsRuntime>&
     options.size.height = static_cast<int32_t>(final_height);
     options.editable = true;
     std::unique_ptr<OHOS::Media::PixelMap> pixelmap = OHOS::Media::PixelMap::Create(data, length, options);
-    delete[] data;
     if (pixelmap == nullptr) {
         LOGE(" pixelmap is null.");
         return runtime->NewUndefined();
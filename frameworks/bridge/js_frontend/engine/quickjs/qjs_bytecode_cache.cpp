@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "base/log/ace_trace.h"
+#include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
+#include "base/utils/file_utils.h"
+#include "base/utils/utils.h"
+#include "core/image/image_cache.h"
+
+// Given by qjs_version_config, an entry written by another engine must never be taken for the current one.
+#ifndef ACE_QUICKJS_VERSION
+#error "ACE_QUICKJS_VERSION is not defined, add qjs_version_config to the configs of the target"
+#endif
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+// The cache is kept in the image cache directory, names starting with a dot are not taken as images by ImageCache.
+constexpr char CACHE_DIR_NAME[] = ".qjs_bytecode";
+// Directory of older versions, which was taken as an image and is removed.
+constexpr char LEGACY_CACHE_DIR_NAME[] = "qjs_bytecode";
+constexpr char CACHE_FILE_SUFFIX[] = ".qbc";
+constexpr char TMP_TEMPLATE[] = ".tmp.XXXXXX";
+constexpr char ENGINE_VERSION[] = "quickjs-" ACE_QUICKJS_VERSION;
+constexpr uint32_t CACHE_FILE_MAGIC = 0x43425141; // "AQBC"
+constexpr uint32_t CACHE_FILE_VERSION = 1;
+// Small scripts compile faster than their bytecode is looked up.
+constexpr size_t MIN_SOURCE_SIZE = 1024;
+constexpr size_t MAX_MEMORY_SIZE = 8 * 1024 * 1024;
+constexpr size_t MAX_BYTECODE_SIZE = 64 * 1024 * 1024;
+#ifndef WINDOWS_PLATFORM
+constexpr mode_t CACHE_DIR_MODE = S_IRWXU;
+#endif
+
+struct CacheFileHeader {
+    uint32_t magic = CACHE_FILE_MAGIC;
+    uint32_t version = CACHE_FILE_VERSION;
+    uint64_t engineVersion = 0;
+    uint64_t sourceHash = 0;
+    uint64_t sourceSize = 0;
+    uint64_t bytecodeHash = 0;
+    uint64_t bytecodeSize = 0;
+};
+
+uint64_t GetEngineVersion()
+{
+    // Bytecode depends on the pointer size as well as the engine.
+    static const uint64_t engineVersion = [] {
+        uint32_t pointerSize = sizeof(void*);
+        return HashBytes(&pointerSize, sizeof(pointerSize), HashBytes(ENGINE_VERSION, strlen(ENGINE_VERSION)));
+    }();
+    return engineVersion;
+}
+
+std::string GetCacheDir()
+{
+    auto cacheDir = ImageCache::GetImageCacheFilePath();
+    if (cacheDir.empty()) {
+        return cacheDir;
+    }
+    return cacheDir.append("/").append(CACHE_DIR_NAME);
+}
+
+void RemoveLegacyCacheDir()
+{
+    auto imageCacheDir = ImageCache::GetImageCacheFilePath();
+    if (imageCacheDir.empty()) {
+        return;
+    }
+    auto legacyDir = imageCacheDir.append("/").append(LEGACY_CACHE_DIR_NAME);
+    std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(legacyDir.c_str()), closedir);
+    if (!dir) {
+        return;
+    }
+    for (dirent* filePtr = readdir(dir.get()); filePtr != nullptr; filePtr = readdir(dir.get())) {
+        if (filePtr->d_name[0] != '.') {
+            remove((legacyDir + "/" + filePtr->d_name).c_str());
+        }
+    }
+    dir.reset();
+    rmdir(legacyDir.c_str());
+}
+
+} // namespace
+
+QJSBytecodeCache& QJSBytecodeCache::GetInstance()
+{
+    static QJSBytecodeCache instance;
+    return instance;
+}
+
+JSValue QJSBytecodeCache::Eval(JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int32_t evalFlags)
+{
+    if ((evalFlags & JS_EVAL_FLAG_COMPILE_ONLY) != 0) {
+        return Compile(ctx, buf, bufLen, filename, evalFlags);
+    }
+    JSValue func = Compile(ctx, buf, bufLen, filename, evalFlags | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(func)) {
+        return func;
+    }
+    return JS_EvalFunction(ctx, func);
+}
+
+void QJSBytecodeCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    entryMap_.clear();
+    memorySize_ = 0;
+}
+
+JSValue QJSBytecodeCache::Compile(
+    JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int32_t evalFlags)
+{
+    int32_t evalType = evalFlags & JS_EVAL_TYPE_MASK;
+    if (bufLen < MIN_SOURCE_SIZE || (evalType != JS_EVAL_TYPE_GLOBAL && evalType != JS_EVAL_TYPE_MODULE)) {
+        return JS_Eval(ctx, buf, bufLen, filename, evalFlags);
+    }
+
+    // The file name is kept in the bytecode for stack traces, so it is a part of the key.
+    uint64_t nameKey = HashBytes(&evalFlags, sizeof(evalFlags));
+    if (filename != nullptr) {
+        nameKey = HashBytes(filename, strlen(filename), nameKey);
+    }
+    uint64_t sourceHash = HashBytes(buf, bufLen);
+    uint64_t key = HashBytes(&sourceHash, sizeof(sourceHash), nameKey);
+    auto cacheDir = GetCacheDir();
+    std::string filePath;
+    if (!cacheDir.empty()) {
+        filePath = cacheDir + "/" + std::to_string(nameKey) + CACHE_FILE_SUFFIX;
+    }
+
+    bool fromDisk = false;
+    auto bytecode = GetFromMemory(key);
+    if (!bytecode && !filePath.empty()) {
+        bytecode = GetFromDisk(filePath, sourceHash, bufLen);
+        fromDisk = (bytecode != nullptr);
+    }
+    if (bytecode) {
+        ACE_SCOPED_TRACE("QJSBytecodeCache::ReadBytecode");
+        bool broken = false;
+        JSValue func = ReadBytecode(ctx, *bytecode, evalType, broken);
+        if (!broken) {
+            // Imports that fail to resolve are an error of the script, not of the entry, the same error is thrown as
+            // by compiling the source.
+            if (fromDisk) {
+                PutToMemory(key, bytecode);
+            }
+            return func;
+        }
+        LOGW("cached bytecode of %{public}s is broken, compile it again", filename != nullptr ? filename : "");
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        RemoveFromMemory(key);
+        if (!filePath.empty()) {
+            remove(filePath.c_str());
+        }
+    }
+
+    ACE_SCOPED_TRACE("QJSBytecodeCache::Compile");
+    JSValue func = JS_Eval(ctx, buf, bufLen, filename, evalFlags);
+    if (JS_IsException(func)) {
+        return func;
+    }
+    size_t size = 0;
+    uint8_t* data = JS_WriteObject(ctx, &size, func, JS_WRITE_OBJ_BYTECODE);
+    if (data == nullptr) {
+        LOGW("write bytecode of %{public}s failed", filename != nullptr ? filename : "");
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return func;
+    }
+    if (size > MAX_BYTECODE_SIZE) {
+        js_free(ctx, data);
+        return func;
+    }
+    std::shared_ptr<const Bytecode> newBytecode = std::make_shared<Bytecode>(data, data + size);
+    js_free(ctx, data);
+    PutToMemory(key, newBytecode);
+    if (!filePath.empty()) {
+        BackgroundTaskExecutor::GetInstance().PostTask(
+            [this, filePath, sourceHash, bufLen, newBytecode]() {
+                PutToDisk(filePath, sourceHash, bufLen, newBytecode);
+            },
+            BgTaskPriority::LOW);
+    }
+    return func;
+}
+
+JSValue QJSBytecodeCache::ReadBytecode(JSContext* ctx, const Bytecode& bytecode, int32_t evalType, bool& broken)
+{
+    JSValue func = JS_ReadObject(ctx, bytecode.data(), bytecode.size(), JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(func)) {
+        broken = true;
+        return func;
+    }
+    int32_t tag = JS_VALUE_GET_TAG(func);
+    bool isModule = (tag == JS_TAG_MODULE);
+    if (isModule != (evalType == JS_EVAL_TYPE_MODULE) || (!isModule && tag != JS_TAG_FUNCTION_BYTECODE)) {
+        JS_FreeValue(ctx, func);
+        broken = true;
+        return JS_ThrowTypeError(ctx, "unexpected cached bytecode");
+    }
+    // Imports of a module read from bytecode are not resolved yet.
+    if (isModule && JS_ResolveModule(ctx, func) < 0) {
+        JS_FreeValue(ctx, func);
+        return JS_EXCEPTION;
+    }
+    return func;
+}
+
+std::shared_ptr<const QJSBytecodeCache::Bytecode> QJSBytecodeCache::GetFromMemory(uint64_t key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entryMap_.find(key);
+    if (iter == entryMap_.end()) {
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return iter->second->bytecode;
+}
+
+void QJSBytecodeCache::PutToMemory(uint64_t key, const std::shared_ptr<const Bytecode>& bytecode)
+{
+    if (bytecode->size() > MAX_MEMORY_SIZE) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entryMap_.find(key);
+    if (iter != entryMap_.end()) {
+        memorySize_ -= iter->second->bytecode->size();
+        entries_.erase(iter->second);
+    }
+    entries_.push_front({ key, bytecode });
+    entryMap_[key] = entries_.begin();
+    memorySize_ += bytecode->size();
+    while (memorySize_ > MAX_MEMORY_SIZE) {
+        const auto& entry = entries_.back();
+        memorySize_ -= entry.bytecode->size();
+        entryMap_.erase(entry.key);
+        entries_.pop_back();
+    }
+}
+
+void QJSBytecodeCache::RemoveFromMemory(uint64_t key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entryMap_.find(key);
+    if (iter == entryMap_.end()) {
+        return;
+    }
+    memorySize_ -= iter->second->bytecode->size();
+    entries_.erase(iter->second);
+    entryMap_.erase(iter);
+}
+
+std::shared_ptr<const QJSBytecodeCache::Bytecode> QJSBytecodeCache::GetFromDisk(
+    const std::string& filePath, uint64_t sourceHash, size_t sourceSize)
+{
+    std::unique_ptr<FILE, decltype(&fclose)> fp(fopen(filePath.c_str(), "rb"), fclose);
+    if (!fp) {
+        return nullptr;
+    }
+    CacheFileHeader header;
+    if (fread(&header, sizeof(header), 1, fp.get()) != 1) {
+        return nullptr;
+    }
+    // An entry of another source or engine is not an error, it is replaced after the source is compiled.
+    if (header.magic != CACHE_FILE_MAGIC || header.version != CACHE_FILE_VERSION ||
+        header.engineVersion != GetEngineVersion() || header.sourceHash != sourceHash ||
+        header.sourceSize != sourceSize || header.bytecodeSize == 0 || header.bytecodeSize > MAX_BYTECODE_SIZE) {
+        return nullptr;
+    }
+    auto bytecode = std::make_shared<Bytecode>(header.bytecodeSize);
+    if (fread(bytecode->data(), 1, bytecode->size(), fp.get()) != bytecode->size() ||
+        HashBytes(bytecode->data(), bytecode->size()) != header.bytecodeHash) {
+        LOGW("cached bytecode file %{private}s is broken", filePath.c_str());
+        return nullptr;
+    }
+    return bytecode;
+}
+
+void QJSBytecodeCache::PutToDisk(const std::string& filePath, uint64_t sourceHash, size_t sourceSize,
+    const std::shared_ptr<const Bytecode>& bytecode)
+{
+    auto cacheDir = GetCacheDir();
+    if (cacheDir.empty()) {
+        return;
+    }
+    static std::once_flag removeLegacyFlag;
+    std::call_once(removeLegacyFlag, RemoveLegacyCacheDir);
+#ifdef WINDOWS_PLATFORM
+    mkdir(cacheDir.c_str());
+#else
+    mkdir(cacheDir.c_str(), CACHE_DIR_MODE);
+#endif
+    CacheFileHeader header;
+    header.engineVersion = GetEngineVersion();
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.bytecodeHash = HashBytes(bytecode->data(), bytecode->size());
+    header.bytecodeSize = bytecode->size();
+
+    // Write to a temporary file of its own and rename it, readers never see a partly written file and writers of
+    // the same entry never write into each other.
+    std::string tmpPath = filePath + TMP_TEMPLATE;
+    std::unique_ptr<FILE, decltype(&fclose)> fp(FileUtils::CreateTmpFile(tmpPath), fclose);
+    if (!fp) {
+        LOGW("open bytecode cache file failed, fail reason: %{public}s", strerror(errno));
+        return;
+    }
+    bool written = fwrite(&header, sizeof(header), 1, fp.get()) == 1 &&
+                   fwrite(bytecode->data(), 1, bytecode->size(), fp.get()) == bytecode->size();
+    written = (fclose(fp.release()) == 0) && written;
+    if (!written || !FileUtils::RenameFile(tmpPath, filePath)) {
+        LOGW("write bytecode cache file failed, fail reason: %{public}s", strerror(errno));
+        remove(tmpPath.c_str());
+    }
+}
+
+} // namespace OHOS::Ace::Framework
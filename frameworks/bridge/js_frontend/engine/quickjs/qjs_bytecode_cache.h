@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_QUICKJS_QJS_BYTECODE_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_QUICKJS_QJS_BYTECODE_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+#include "third_party/quickjs/quickjs.h"
+
+namespace OHOS::Ace::Framework {
+
+// Bytecode of scripts compiled by QuickJS, shared by all contexts of the process and kept on disk between launches,
+// so a script is compiled only once. Entries are found by the hash of the source, file name and eval flags, and are
+// used only if they were written by the same engine version for the same source. A disk entry is kept per file name
+// and eval flags, a changed source replaces it. Entries that fail to load are dropped and the source is compiled.
+class QJSBytecodeCache final {
+public:
+    static QJSBytecodeCache& GetInstance();
+
+    // Same as JS_Eval, the bytecode is read from the cache if the source was compiled before.
+    // With JS_EVAL_FLAG_COMPILE_ONLY, the compiled function or module is returned to be run by JS_EvalFunction.
+    JSValue Eval(JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int32_t evalFlags);
+
+    // Drops the entries in memory, entries on disk are kept.
+    void Clear();
+
+private:
+    using Bytecode = std::vector<uint8_t>;
+
+    struct Entry {
+        uint64_t key = 0;
+        std::shared_ptr<const Bytecode> bytecode;
+    };
+
+    QJSBytecodeCache() = default;
+    ~QJSBytecodeCache() = default;
+
+    JSValue Compile(JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int32_t evalFlags);
+    // Sets broken if the bytecode can't be read, an error resolving the imports of a module doesn't.
+    JSValue ReadBytecode(JSContext* ctx, const Bytecode& bytecode, int32_t evalType, bool& broken);
+    std::shared_ptr<const Bytecode> GetFromMemory(uint64_t key);
+    void PutToMemory(uint64_t key, const std::shared_ptr<const Bytecode>& bytecode);
+    void RemoveFromMemory(uint64_t key);
+    std::shared_ptr<const Bytecode> GetFromDisk(const std::string& filePath, uint64_t sourceHash, size_t sourceSize);
+    void PutToDisk(const std::string& filePath, uint64_t sourceHash, size_t sourceSize,
+        const std::shared_ptr<const Bytecode>& bytecode);
+
+    std::mutex mutex_;
+    // Most recently used first.
+    std::list<Entry> entries_;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> entryMap_;
+    size_t memorySize_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(QJSBytecodeCache);
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_JS_FRONTEND_ENGINE_QUICKJS_QJS_BYTECODE_CACHE_H
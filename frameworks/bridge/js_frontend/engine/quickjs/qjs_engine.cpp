@@ -54,6 +54,7 @@
 #include "frameworks/bridge/js_frontend/engine/quickjs/intl/intl_support.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/list_bridge.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/offscreen_canvas_bridge.h"
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_group_js_bridge.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_utils.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_xcomponent_bridge.h"
@@ -84,7 +85,7 @@ std::map<const std::string, std::string> dataMap_;
 int32_t CallEvalBuf(
     JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int32_t evalFlags, int32_t instanceId)
 {
-    JSValue val = JS_Eval(ctx, buf, bufLen, filename, evalFlags);
+    JSValue val = QJSBytecodeCache::GetInstance().Eval(ctx, buf, bufLen, filename, evalFlags);
     int32_t ret = JS_CALL_SUCCESS;
     if (JS_IsException(val)) {
         LOGE("[Qjs Native] EvalBuf failed!");
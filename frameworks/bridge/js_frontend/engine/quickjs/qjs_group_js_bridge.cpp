@@ -27,6 +27,7 @@
 #include "frameworks/bridge/codec/function_call.h"
 #include "frameworks/bridge/codec/standard_function_codec.h"
 #include "frameworks/bridge/js_frontend/engine/common/js_constants.h"
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
 #include "frameworks/bridge/js_frontend/engine/quickjs/qjs_engine.h"
 
 namespace OHOS::Ace::Framework {
@@ -705,7 +706,7 @@ int32_t QuickJsGroupJsBridge::CallEvalBuf(
     JSContext* ctx, const char* buf, size_t bufLen, const char* filename, int32_t evalFlags)
 {
     int32_t ret = JS_CALL_SUCCESS;
-    JSValue val = JS_Eval(ctx, buf, bufLen, filename, evalFlags);
+    JSValue val = QJSBytecodeCache::GetInstance().Eval(ctx, buf, bufLen, filename, evalFlags);
     if (QUICK_JS_CHECK_EXCEPTION(ctx, val)) {
         LOGE("EvalBuf failed!");
         ret = JS_CALL_FAIL;
@@ -25,6 +25,9 @@ namespace OHOS::Ace::Framework {
 namespace {
 
 constexpr int32_t COMMAND_SIZE = 1;
+// attr and style commands are pushed for every updated node.
+constexpr size_t NODE_COMMAND_SIZE = 2;
+constexpr size_t NODE_NUMBER = 3;
 
 } // namespace
 
@@ -1421,4 +1424,132 @@ HWTEST_F(CardFrontendTest, CardFrontendDataBindingTest016, TestSize.Level1)
     ASSERT_EQ(value, "true");
 }
 
+/**
+ * @tc.name: CardFrontendDataBindingTest017
+ * @tc.desc: Test only nodes bound to the changed data are updated.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardFrontendDataBindingTest017, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. construct json string, a div with two texts bound to different data.
+     */
+    const std::string rootJson = "{\n"
+                                 "\t\"template\": {\n"
+                                 "\t\t\"type\": \"div\",\n"
+                                 "\t\t\"children\": [\n"
+                                 "\t\t\t{\n"
+                                 "\t\t\t\t\"attr\": {\n"
+                                 "\t\t\t\t\t\"value\": \"{{title}}\"\n"
+                                 "\t\t\t\t},\n"
+                                 "\t\t\t\t\"type\": \"text\"\n"
+                                 "\t\t\t},\n"
+                                 "\t\t\t{\n"
+                                 "\t\t\t\t\"attr\": {\n"
+                                 "\t\t\t\t\t\"value\": \"{{flag ? count : title}}\"\n"
+                                 "\t\t\t\t},\n"
+                                 "\t\t\t\t\"type\": \"text\"\n"
+                                 "\t\t\t}\n"
+                                 "\t\t]\n"
+                                 "\t},\n"
+                                 "\t\"styles\": {},\n"
+                                 "\t\"actions\": {},\n"
+                                 "\t\"data\": {\n"
+                                 "\t\t\"flag\": true,\n"
+                                 "\t\t\"count\": 1,\n"
+                                 "\t\t\"title\": \"hello\"\n"
+                                 "\t}\n"
+                                 "}";
+    auto rootBody = JsonUtil::ParseJsonString(rootJson);
+    auto jsCardParser = AceType::MakeRefPtr<JsCardParser>(nullptr, nullptr, std::move(rootBody));
+    jsCardParser->Initialize();
+    auto document = AceType::MakeRefPtr<DOMDocument>(0);
+    auto page = AceType::MakeRefPtr<JsAcePage>(0, document, "");
+
+    /**
+     * @tc.steps: step2. update the data only read by the second text.
+     * @tc.expected: step2. only the second text is updated.
+     */
+    jsCardParser->UpdatePageData("{\"count\": 2}", page);
+    ASSERT_EQ(page->GetCommandSize(), NODE_COMMAND_SIZE);
+
+    /**
+     * @tc.steps: step3. update the data with the same value.
+     * @tc.expected: step3. no node is updated.
+     */
+    jsCardParser->UpdatePageData("{\"count\": 2}", page);
+    ASSERT_EQ(page->GetCommandSize(), NODE_COMMAND_SIZE);
+
+    /**
+     * @tc.steps: step4. update the data read by both texts, then update the style.
+     * @tc.expected: step4. both texts are updated, then all nodes are updated.
+     */
+    jsCardParser->UpdatePageData("{\"title\": \"world\"}", page);
+    ASSERT_EQ(page->GetCommandSize(), NODE_COMMAND_SIZE * 3);
+    jsCardParser->UpdateStyle(page);
+    ASSERT_EQ(page->GetCommandSize(), NODE_COMMAND_SIZE * (3 + NODE_NUMBER));
+}
+
+/**
+ * @tc.name: CardFrontendDataBindingTest018
+ * @tc.desc: Test items of a repeat are updated only when the list changes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CardFrontendTest, CardFrontendDataBindingTest018, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. construct json string, a div with texts repeated for a list and a text bound to other data.
+     */
+    const std::string rootJson = "{\n"
+                                 "\t\"template\": {\n"
+                                 "\t\t\"type\": \"div\",\n"
+                                 "\t\t\"children\": [\n"
+                                 "\t\t\t{\n"
+                                 "\t\t\t\t\"attr\": {\n"
+                                 "\t\t\t\t\t\"value\": \"{{$item.name}}\"\n"
+                                 "\t\t\t\t},\n"
+                                 "\t\t\t\t\"type\": \"text\",\n"
+                                 "\t\t\t\t\"repeat\": \"{{list}}\"\n"
+                                 "\t\t\t},\n"
+                                 "\t\t\t{\n"
+                                 "\t\t\t\t\"attr\": {\n"
+                                 "\t\t\t\t\t\"value\": \"{{title}}\"\n"
+                                 "\t\t\t\t},\n"
+                                 "\t\t\t\t\"type\": \"text\"\n"
+                                 "\t\t\t}\n"
+                                 "\t\t]\n"
+                                 "\t},\n"
+                                 "\t\"styles\": {},\n"
+                                 "\t\"actions\": {},\n"
+                                 "\t\"data\": {\n"
+                                 "\t\t\"list\": [{\"name\": \"a\"}, {\"name\": \"b\"}],\n"
+                                 "\t\t\"title\": \"hello\"\n"
+                                 "\t}\n"
+                                 "}";
+    auto templateBody = JsonUtil::ParseJsonString(rootJson);
+    auto rootTemplate = templateBody->GetValue("template");
+    auto rootBody = JsonUtil::ParseJsonString(rootJson);
+    auto jsCardParser = AceType::MakeRefPtr<JsCardParser>(nullptr, nullptr, std::move(rootBody));
+    jsCardParser->Initialize();
+    auto document = AceType::MakeRefPtr<DOMDocument>(0);
+    auto page = AceType::MakeRefPtr<JsAcePage>(0, document, "");
+    jsCardParser->CreateDomNode(page, rootTemplate, -1);
+    jsCardParser->ResetNodeId();
+    auto createdSize = page->GetCommandSize();
+
+    /**
+     * @tc.steps: step2. update the data not read by the repeat, the list is the same.
+     * @tc.expected: step2. only the text bound to the data is updated, items of the repeat are not.
+     */
+    jsCardParser->UpdatePageData("{\"list\": [{\"name\": \"a\"}, {\"name\": \"b\"}], \"title\": \"world\"}", page);
+    ASSERT_EQ(page->GetCommandSize(), createdSize + NODE_COMMAND_SIZE);
+
+    /**
+     * @tc.steps: step3. update the list with the same number of items.
+     * @tc.expected: step3. both items of the repeat are updated.
+     */
+    jsCardParser->UpdatePageData("{\"list\": [{\"name\": \"c\"}, {\"name\": \"d\"}]}", page);
+    ASSERT_EQ(page->GetCommandSize(), createdSize + NODE_COMMAND_SIZE * 3);
+}
+
 } // namespace OHOS::Ace::Framework
\ No newline at end of file
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "frameworks/bridge/declarative_frontend/wrapping_components.h"
+#include "frameworks/core/pipeline/base/element.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+// Deep enough for the deque to allocate several blocks of frames.
+constexpr size_t TEST_STACK_DEPTH = 64;
+
+class MockComponent : public Component {
+    DECLARE_ACE_TYPE(MockComponent, Component);
+
+public:
+    MockComponent() = default;
+    ~MockComponent() override = default;
+
+    RefPtr<Element> CreateElement() override
+    {
+        return nullptr;
+    }
+};
+
+} // namespace
+
+class WrappingComponentsTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: WrappingComponents001
+ * @tc.desc: A popped frame is cleared and reused by the next push.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WrappingComponentsTest, WrappingComponents001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. push a view, wrap it in a box, then emplace another box.
+     * @tc.expected: step1. the first box is kept.
+     */
+    WrappingComponentsStack stack;
+    RefPtr<Component> mainComponent = AceType::MakeRefPtr<MockComponent>();
+    RefPtr<Component> box = AceType::MakeRefPtr<MockComponent>();
+    stack.Push(mainComponent);
+    stack.Top().Emplace(WrappingSlot::BOX, box);
+    stack.Top().Emplace(WrappingSlot::BOX, AceType::MakeRefPtr<MockComponent>());
+    EXPECT_EQ(stack.Top()[WrappingSlot::MAIN], mainComponent);
+    EXPECT_EQ(stack.Top()[WrappingSlot::BOX], box);
+    const auto* frame = &stack.Top();
+    WeakPtr<Component> weakBox = box;
+    box.Reset();
+
+    /**
+     * @tc.steps: step2. pop the view and push another one.
+     * @tc.expected: step2. the components of the popped view are released, the frame is reused without the box.
+     */
+    stack.Pop();
+    EXPECT_TRUE(stack.Empty());
+    EXPECT_FALSE(weakBox.Upgrade());
+    RefPtr<Component> otherComponent = AceType::MakeRefPtr<MockComponent>();
+    stack.Push(otherComponent);
+    EXPECT_EQ(&stack.Top(), frame);
+    EXPECT_EQ(stack.Capacity(), 1u);
+    EXPECT_EQ(stack.Top()[WrappingSlot::MAIN], otherComponent);
+    EXPECT_FALSE(stack.Top()[WrappingSlot::BOX]);
+
+    /**
+     * @tc.steps: step3. pop more than pushed.
+     * @tc.expected: step3. the stack stays empty.
+     */
+    stack.Pop();
+    stack.Pop();
+    EXPECT_EQ(stack.Depth(), 0u);
+}
+
+/**
+ * @tc.name: WrappingComponents002
+ * @tc.desc: A frame stays valid while views are pushed above it, and reused frames come back in order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WrappingComponentsTest, WrappingComponents002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. hold the bottom frame and push views above it.
+     * @tc.expected: step1. the held frame is still the bottom one and keeps its components.
+     */
+    WrappingComponentsStack stack;
+    RefPtr<Component> mainComponent = AceType::MakeRefPtr<MockComponent>();
+    stack.Push(mainComponent);
+    auto& bottom = stack.Top();
+    std::vector<const WrappingComponents*> frames;
+    for (size_t i = 0; i < TEST_STACK_DEPTH; ++i) {
+        stack.Push(AceType::MakeRefPtr<MockComponent>());
+        frames.emplace_back(&stack.Top());
+    }
+    EXPECT_EQ(stack.Depth(), TEST_STACK_DEPTH + 1);
+    EXPECT_EQ(&stack.At(0), &bottom);
+    EXPECT_EQ(bottom[WrappingSlot::MAIN], mainComponent);
+
+    /**
+     * @tc.steps: step2. pop all views above the bottom one, then push them again.
+     * @tc.expected: step2. no frame is allocated, each level gets the frame it had before.
+     */
+    while (stack.Depth() > 1) {
+        stack.Pop();
+    }
+    EXPECT_EQ(&stack.Top(), &bottom);
+    for (size_t i = 0; i < TEST_STACK_DEPTH; ++i) {
+        stack.Push(AceType::MakeRefPtr<MockComponent>());
+        EXPECT_EQ(&stack.Top(), frames[i]);
+    }
+    EXPECT_EQ(stack.Capacity(), TEST_STACK_DEPTH + 1);
+}
+
+} // namespace OHOS::Ace::Framework
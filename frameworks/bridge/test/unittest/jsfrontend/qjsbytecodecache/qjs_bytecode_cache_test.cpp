@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <dirent.h>
+#include <memory>
+#include <sys/stat.h>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "frameworks/bridge/js_frontend/engine/quickjs/qjs_bytecode_cache.h"
+#undef private
+#include "base/utils/utils.h"
+#include "core/image/image_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+const std::string TEST_DIR = "/data/test/resource/qjsbytecodecache";
+const std::string CACHE_DIR = TEST_DIR + "/.qjs_bytecode";
+const std::string LEGACY_CACHE_DIR = TEST_DIR + "/qjs_bytecode";
+const std::string LEGACY_CACHE_FILE = LEGACY_CACHE_DIR + "/123456.qbc";
+const std::string CACHE_FILE_SUFFIX = ".qbc";
+const char TEST_FILE_NAME[] = "app.js";
+// Sources shorter than this are compiled without the cache.
+constexpr size_t CACHED_SOURCE_SIZE = 1024;
+// Offsets in the cache file header of the engine version and of the bytecode.
+constexpr long ENGINE_VERSION_OFFSET = 8;
+constexpr long BYTECODE_OFFSET = 48;
+constexpr int32_t WAIT_COUNT = 100;
+constexpr int32_t WAIT_INTERVAL_MS = 10;
+constexpr int32_t FIRST_RESULT = 1;
+constexpr int32_t SECOND_RESULT = 2;
+
+// A script long enough to be cached, which results in the value.
+std::string MakeSource(int32_t value)
+{
+    return std::string("/*").append(CACHED_SOURCE_SIZE, '*').append("*/\n").append(std::to_string(value));
+}
+
+std::string FindCacheFile()
+{
+    std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(CACHE_DIR.c_str()), closedir);
+    if (!dir) {
+        return std::string();
+    }
+    for (dirent* filePtr = readdir(dir.get()); filePtr != nullptr; filePtr = readdir(dir.get())) {
+        std::string name(filePtr->d_name);
+        if (name.size() > CACHE_FILE_SUFFIX.size() &&
+            name.compare(name.size() - CACHE_FILE_SUFFIX.size(), CACHE_FILE_SUFFIX.size(), CACHE_FILE_SUFFIX) == 0) {
+            return CACHE_DIR + "/" + name;
+        }
+    }
+    return std::string();
+}
+
+// The cache file is written in background.
+std::string WaitForCacheFile()
+{
+    for (int32_t i = 0; i < WAIT_COUNT; ++i) {
+        auto filePath = FindCacheFile();
+        if (!filePath.empty()) {
+            return filePath;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INTERVAL_MS));
+    }
+    return std::string();
+}
+
+void FlipByte(const std::string& filePath, long offset)
+{
+    FILE* file = fopen(filePath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    fseek(file, offset, SEEK_SET);
+    int value = fgetc(file);
+    ASSERT_NE(value, EOF);
+    fseek(file, offset, SEEK_SET);
+    fputc(value ^ 0xff, file);
+    fclose(file);
+}
+
+} // namespace
+
+class QJSBytecodeCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    // Evaluates the source through the cache, and returns its result.
+    int32_t Eval(const std::string& source);
+    // Whether the entry on disk is taken for the source.
+    bool IsOnDisk(const std::string& filePath, const std::string& source);
+
+    JSRuntime* runtime_ = nullptr;
+    JSContext* context_ = nullptr;
+};
+
+void QJSBytecodeCacheTest::SetUpTestCase()
+{
+    mkdir(TEST_DIR.c_str(), S_IRWXU);
+    ImageCache::SetImageCacheFilePath(TEST_DIR);
+}
+
+void QJSBytecodeCacheTest::SetUp()
+{
+    runtime_ = JS_NewRuntime();
+    context_ = JS_NewContext(runtime_);
+}
+
+void QJSBytecodeCacheTest::TearDown()
+{
+    QJSBytecodeCache::GetInstance().Clear();
+    remove(FindCacheFile().c_str());
+    JS_FreeContext(context_);
+    JS_FreeRuntime(runtime_);
+}
+
+int32_t QJSBytecodeCacheTest::Eval(const std::string& source)
+{
+    JSValue result = QJSBytecodeCache::GetInstance().Eval(
+        context_, source.c_str(), source.size(), TEST_FILE_NAME, JS_EVAL_TYPE_GLOBAL);
+    int32_t value = -1;
+    if (JS_IsException(result)) {
+        JS_FreeValue(context_, JS_GetException(context_));
+        return value;
+    }
+    JS_ToInt32(context_, &value, result);
+    JS_FreeValue(context_, result);
+    return value;
+}
+
+bool QJSBytecodeCacheTest::IsOnDisk(const std::string& filePath, const std::string& source)
+{
+    return QJSBytecodeCache::GetInstance().GetFromDisk(
+        filePath, HashBytes(source.data(), source.size()), source.size()) != nullptr;
+}
+
+/**
+ * @tc.name: QJSBytecodeCache001
+ * @tc.desc: A compiled script is found in memory and on disk.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QJSBytecodeCacheTest, QJSBytecodeCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. leave a file of an older version, then evaluate a script.
+     * @tc.expected: step1. the script is kept in memory and on disk, the older file is removed.
+     */
+    mkdir(LEGACY_CACHE_DIR.c_str(), S_IRWXU);
+    FILE* file = fopen(LEGACY_CACHE_FILE.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fclose(file);
+    auto source = MakeSource(FIRST_RESULT);
+    EXPECT_EQ(Eval(source), FIRST_RESULT);
+    auto& cache = QJSBytecodeCache::GetInstance();
+    EXPECT_EQ(cache.entryMap_.size(), 1UL);
+    auto filePath = WaitForCacheFile();
+    ASSERT_FALSE(filePath.empty());
+    EXPECT_TRUE(IsOnDisk(filePath, source));
+    struct stat fileStatus;
+    EXPECT_NE(stat(LEGACY_CACHE_DIR.c_str(), &fileStatus), 0);
+
+    /**
+     * @tc.steps: step2. drop the memory entries and evaluate the script again.
+     * @tc.expected: step2. the script is read from disk into memory, the result is the same.
+     */
+    cache.Clear();
+    EXPECT_EQ(Eval(source), FIRST_RESULT);
+    EXPECT_EQ(cache.entryMap_.size(), 1UL);
+
+    /**
+     * @tc.steps: step3. evaluate a short script.
+     * @tc.expected: step3. it is not cached.
+     */
+    cache.Clear();
+    EXPECT_EQ(Eval(std::to_string(SECOND_RESULT)), SECOND_RESULT);
+    EXPECT_TRUE(cache.entryMap_.empty());
+}
+
+/**
+ * @tc.name: QJSBytecodeCache002
+ * @tc.desc: A changed script is compiled again and replaces the entry on disk.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QJSBytecodeCacheTest, QJSBytecodeCache002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. evaluate a script, then a changed script of the same file name.
+     * @tc.expected: step1. the entry on disk is not taken for the changed script, which gives its own result.
+     */
+    auto source = MakeSource(FIRST_RESULT);
+    EXPECT_EQ(Eval(source), FIRST_RESULT);
+    auto filePath = WaitForCacheFile();
+    ASSERT_FALSE(filePath.empty());
+    auto changedSource = MakeSource(SECOND_RESULT);
+    EXPECT_FALSE(IsOnDisk(filePath, changedSource));
+    EXPECT_EQ(Eval(changedSource), SECOND_RESULT);
+
+    /**
+     * @tc.steps: step2. wait until the changed script is written.
+     * @tc.expected: step2. the entry on disk is replaced by the changed script.
+     */
+    for (int32_t i = 0; i < WAIT_COUNT && !IsOnDisk(filePath, changedSource); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INTERVAL_MS));
+    }
+    EXPECT_TRUE(IsOnDisk(filePath, changedSource));
+    EXPECT_FALSE(IsOnDisk(filePath, source));
+}
+
+/**
+ * @tc.name: QJSBytecodeCache003
+ * @tc.desc: Broken entries and entries of another engine version are not used.
+ * @tc.type: FUNC
+ */
+HWTEST_F(QJSBytecodeCacheTest, QJSBytecodeCache003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. evaluate a script, then break the bytecode in its file.
+     * @tc.expected: step1. the file is not used, the script is compiled again.
+     */
+    auto source = MakeSource(FIRST_RESULT);
+    EXPECT_EQ(Eval(source), FIRST_RESULT);
+    auto filePath = WaitForCacheFile();
+    ASSERT_FALSE(filePath.empty());
+    ASSERT_TRUE(IsOnDisk(filePath, source));
+    FlipByte(filePath, BYTECODE_OFFSET);
+    EXPECT_FALSE(IsOnDisk(filePath, source));
+    QJSBytecodeCache::GetInstance().Clear();
+    EXPECT_EQ(Eval(source), FIRST_RESULT);
+
+    /**
+     * @tc.steps: step2. wait until the file is written again, then change its engine version.
+     * @tc.expected: step2. the file is not used.
+     */
+    for (int32_t i = 0; i < WAIT_COUNT && !IsOnDisk(filePath, source); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_INTERVAL_MS));
+    }
+    ASSERT_TRUE(IsOnDisk(filePath, source));
+    FlipByte(filePath, ENGINE_VERSION_OFFSET);
+    EXPECT_FALSE(IsOnDisk(filePath, source));
+    QJSBytecodeCache::GetInstance().Clear();
+    EXPECT_EQ(Eval(source), FIRST_RESULT);
+}
+
+} // namespace OHOS::Ace::Framework
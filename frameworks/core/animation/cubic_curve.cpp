@@ -16,30 +16,87 @@
 #include "core/animation/cubic_curve.h"
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr float SAMPLE_STEP = 1.0f / 10.0f; // 10 intervals between the 11 samples
+constexpr int32_t NEWTON_ITERATIONS = 4;
+constexpr float NEWTON_MIN_SLOPE = 0.001f;
+// Error of Bx(m) against the time which a solved parameter must be within, for Newton-Raphson and bisection alike.
+constexpr float SOLVE_PRECISION = 0.000001f;
+constexpr int32_t BISECTION_MAX_ITERATIONS = 20;
+
+} // namespace
 
 CubicCurve::CubicCurve(float x0, float y0, float x1, float y1)
     : x0_(x0), y0_(y0), x1_(x1), y1_(y1)
-{}
+{
+    isLinear_ = NearEqual(x0_, y0_) && NearEqual(x1_, y1_);
+    for (int32_t i = 0; i < SAMPLE_TABLE_SIZE; ++i) {
+        sampleValues_[i] = CalculateCubic(x0_, x1_, i * SAMPLE_STEP);
+    }
+}
 
 float CubicCurve::MoveInternal(float time)
 {
+    if (isLinear_) {
+        return time;
+    }
     // let P0 = (0,0), P3 = (1,1)
-    float start = 0.0f;
-    float end = 1.0f;
-    while (true) {
-        float midpoint = (start + end) / 2;
-        float estimate = CalculateCubic(x0_, x1_, midpoint);
+    return CalculateCubic(y0_, y1_, GetParameter(time));
+}
+
+float CubicCurve::GetParameter(float time) const
+{
+    if (time <= 0.0f) {
+        return 0.0f;
+    }
+    if (time >= 1.0f) {
+        return 1.0f;
+    }
+    int32_t index = 1;
+    float intervalStart = 0.0f;
+    for (; index < SAMPLE_TABLE_SIZE - 1 && sampleValues_[index] <= time; ++index) {
+        intervalStart += SAMPLE_STEP;
+    }
+    --index;
 
-        if (NearEqual(time, estimate, cubicErrorBound_)) {
-            return CalculateCubic(y0_, y1_, midpoint);
+    float sampleDistance = sampleValues_[index + 1] - sampleValues_[index];
+    float guess = intervalStart;
+    if (!NearZero(sampleDistance)) {
+        guess += (time - sampleValues_[index]) / sampleDistance * SAMPLE_STEP;
+    }
+    if (CalculateCubicSlope(x0_, x1_, guess) < NEWTON_MIN_SLOPE) {
+        return BisectParameter(time, intervalStart, intervalStart + SAMPLE_STEP);
+    }
+    for (int32_t i = 0; i < NEWTON_ITERATIONS; ++i) {
+        float slope = CalculateCubicSlope(x0_, x1_, guess);
+        if (NearZero(slope)) {
+            break;
         }
+        guess -= (CalculateCubic(x0_, x1_, guess) - time) / slope;
+    }
+    if (guess < 0.0f || guess > 1.0f || !NearEqual(CalculateCubic(x0_, x1_, guess), time, SOLVE_PRECISION)) {
+        return BisectParameter(time, intervalStart, intervalStart + SAMPLE_STEP);
+    }
+    return guess;
+}
 
+float CubicCurve::BisectParameter(float time, float start, float end) const
+{
+    float midpoint = (start + end) / 2;
+    for (int32_t i = 0; i < BISECTION_MAX_ITERATIONS; ++i) {
+        float estimate = CalculateCubic(x0_, x1_, midpoint);
+        if (NearEqual(time, estimate, SOLVE_PRECISION)) {
+            break;
+        }
         if (estimate < time) {
             start = midpoint;
         } else {
             end = midpoint;
         }
+        midpoint = (start + end) / 2;
     }
+    return midpoint;
 }
 
 const std::string CubicCurve::ToString()
@@ -56,4 +113,9 @@ float CubicCurve::CalculateCubic(float a, float b, float m)
     return 3.0f * a * (1.0f - m) * (1.0f - m) * m + 3.0f * b * (1.0f - m) * m * m + m * m * m;
 }
 
+float CubicCurve::CalculateCubicSlope(float a, float b, float m)
+{
+    return 3.0f * a * (1.0f - m) * (1.0f - m) + 6.0f * (b - a) * (1.0f - m) * m + 3.0f * (1.0f - b) * m * m;
+}
+
 } // namespace OHOS::Ace
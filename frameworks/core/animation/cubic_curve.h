@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_CUBIC_CURVE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_CUBIC_CURVE_H
 
+#include <array>
+
 #include "core/animation/curve.h"
 
 namespace OHOS::Ace {
@@ -27,6 +29,8 @@ class NativeCurveHelper;
 // so Bx(m) = 3m(1-m)^2*x0_ + 3m^2*x1_ + m^3
 //    By(m) = 3m(1-m)^2*y0_ + 3m^2*y1_ + m^3
 // in function MoveInternal, assume time as Bx(m), we let Bx(m) approaching time, and we can get m and the output By(m)
+// Bx(m) is sampled when the curve is created, the sample interval containing time gives a first guess of m, which is
+// refined by a few Newton-Raphson iterations, or by a bounded bisection inside the interval where the curve is flat.
 class ACE_EXPORT CubicCurve : public Curve {
     DECLARE_ACE_TYPE(CubicCurve, Curve);
 
@@ -38,10 +42,19 @@ public:
     const std::string ToString() override;
 
 private:
+    static constexpr int32_t SAMPLE_TABLE_SIZE = 11;
+
+    // Returns m where Bx(m) = time.
+    float GetParameter(float time) const;
+    float BisectParameter(float time, float start, float end) const;
+
     // Bx(m) or By(m) = 3m(1-m)^2*a + 3m^2*b + m^3, where a = x0_ ,b = x1_ or a = y0_ ,b = y1_
     static float CalculateCubic(float a, float b, float m);
+    // dBx(m)/dm or dBy(m)/dm
+    static float CalculateCubicSlope(float a, float b, float m);
 
-    float cubicErrorBound_ = 0.001f; // Control curve accuracy
+    bool isLinear_ = false;
+    std::array<float, SAMPLE_TABLE_SIZE> sampleValues_ {}; // Bx(m) at evenly spaced m
     float x0_;                       // X-axis of the first point (P1)
     float y0_;                       // Y-axis of the first point (P1)
     float x1_;                       // X-axis of the second point (P2)
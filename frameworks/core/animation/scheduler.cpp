@@ -63,22 +63,11 @@ void Scheduler::OnFrame(uint64_t nanoTimestamp)
     uint64_t elapsedTimeMs = (nanoTimestamp - startupTimestamp_) / 1000000;
     startupTimestamp_ += elapsedTimeMs * 1000000;
 
-    // Consume previous schedule as default.
-    scheduleId_ = 0;
+    // The task stays scheduled until it is stopped, so the pipeline does not reschedule it every frame.
     if (callback_) {
         // Need to convert nanoseconds to milliseconds
         callback_(elapsedTimeMs);
     }
-
-    // Schedule next frame task.
-    auto context = context_.Upgrade();
-    if (!context) {
-        LOGE("Schedule next frame task failed, context is null.");
-        return;
-    }
-    if (IsActive()) {
-        scheduleId_ = static_cast<int32_t>(context->AddScheduleTask(AceType::Claim(this)));
-    }
 }
 
 bool Scheduler::Animate(const AnimationOption& option, const RefPtr<Curve>& curve,
@@ -26,6 +26,34 @@ constexpr int32_t DEFAULT_ESTIMATE_STEPS = 100;
 
 } // namespace
 
+std::mutex SpringCurve::durationMutex_;
+std::map<SpringCurve::SpringKey, float> SpringCurve::estimateDurations_;
+std::deque<SpringCurve::SpringKey> SpringCurve::cachedKeys_;
+
+bool SpringCurve::GetCachedDuration(const SpringKey& key, float& duration)
+{
+    std::lock_guard<std::mutex> lock(durationMutex_);
+    auto iter = estimateDurations_.find(key);
+    if (iter == estimateDurations_.end()) {
+        return false;
+    }
+    duration = iter->second;
+    return true;
+}
+
+void SpringCurve::CacheDuration(const SpringKey& key, float duration)
+{
+    std::lock_guard<std::mutex> lock(durationMutex_);
+    if (!estimateDurations_.emplace(key, duration).second) {
+        return;
+    }
+    cachedKeys_.push_back(key);
+    if (cachedKeys_.size() > MAX_CACHED_DURATION_COUNT) {
+        estimateDurations_.erase(cachedKeys_.front());
+        cachedKeys_.pop_front();
+    }
+}
+
 SpringCurve::SpringCurve(float velocity, float mass, float stiffness, float damping)
     : velocity_(velocity), mass_(mass), stiffness_(stiffness), damping_(damping)
 {
@@ -47,6 +75,10 @@ void SpringCurve::SetEndPosition(float endPosition, float startVelocity)
 
 void SpringCurve::InitEstimateDuration()
 {
+    SpringKey key(endPosition_, currentVelocity_, mass_, stiffness_, damping_);
+    if (GetCachedDuration(key, estimateDuration_)) {
+        return;
+    }
     float position = 0.0f;
     float velocity = 0.0f;
     float time = 1.0f / DEFAULT_ESTIMATE_STEPS;
@@ -55,7 +87,10 @@ void SpringCurve::InitEstimateDuration()
         velocity = solution_->Velocity(time * i);
         if (NearEqual(position, endPosition_, valueThreshold_) && NearZero(velocity, velocityThreshold_)) {
             estimateDuration_ = time * i;
-            break;
+            // Only a settled spring has a duration of its own, otherwise the duration is left from the curve's
+            // previous end position.
+            CacheDuration(key, estimateDuration_);
+            return;
         }
     }
 }
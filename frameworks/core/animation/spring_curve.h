@@ -16,6 +16,11 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_SPRING_CURVE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_SPRING_CURVE_H
 
+#include <deque>
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include "core/animation/curve.h"
 #include "core/animation/spring_motion.h"
 
@@ -32,9 +37,17 @@ public:
     const std::string ToString() override;
 
 private:
+    // End position, start velocity, mass, stiffness and damping of a spring.
+    using SpringKey = std::tuple<float, float, float, float, float>;
+    static constexpr size_t MAX_CACHED_DURATION_COUNT = 64;
+
     void SetEndPosition(float endPosition, float startVelocity);
     void InitEstimateDuration();
 
+    static bool GetCachedDuration(const SpringKey& key, float& duration);
+    // Evicts the oldest duration when the cache is full.
+    static void CacheDuration(const SpringKey& key, float duration);
+
     float estimateDuration_ = 1.0f;
     float startPosition_ = 0.0f;
     float endPosition_ = 0.0f;
@@ -49,6 +62,13 @@ private:
     RefPtr<SpringProperty> property_; // Contain: mass & stiffness & damping
     RefPtr<SpringModel> solution_; // Maybe: CriticalDamped or Overdamped or Underdamped
 
+    // Apps create a curve of the same spring for every animation, each estimation evaluates the spring up to 100
+    // times, so estimated durations are shared by all curves.
+    static std::mutex durationMutex_;
+    static std::map<SpringKey, float> estimateDurations_;
+    // Keys of the cached durations, oldest first.
+    static std::deque<SpringKey> cachedKeys_;
+
     friend class NativeCurveHelper;
 };
 
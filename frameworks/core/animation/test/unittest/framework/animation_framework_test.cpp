@@ -15,6 +15,9 @@
 
 #include "gtest/gtest.h"
 
+#define private public
+#include "core/animation/spring_curve.h"
+#undef private
 #include "adapter/aosp/entrance/java/jni/jni_environment.h"
 #include "base/log/log.h"
 #include "core/animation/card_transition_controller.h"
@@ -69,6 +72,11 @@ constexpr uint32_t PICTURE_ANIMATION_DURATION_MULTIPLE = 2;
 constexpr uint32_t KEYFRAME_ANIMATION_DURATION_MULTIPLE = 2;
 constexpr uint64_t NANO_FRAME_TIME = static_cast<const uint64_t>(1e9 / 60);
 constexpr float CUBIC_ERROR_BOUND = 0.01f;
+// Critically damped spring, it settles well within the estimation time.
+constexpr float TEST_SPRING_MASS = 1.0f;
+constexpr float TEST_SPRING_STIFFNESS = 400.0f;
+constexpr float TEST_SPRING_DAMPING = 40.0f;
+constexpr float TEST_SPRING_VELOCITY_STEP = 0.01f;
 
 } // namespace
 
@@ -823,6 +831,71 @@ HWTEST_F(AnimationFrameworkTest, AnimationCurveTest009, TestSize.Level1)
     EXPECT_NEAR(0.0f, complementaryCurve.MoveInternal(testValueSecond), FLT_EPSILON);
 }
 
+/**
+ * @tc.name: AnimationCurveTest010
+ * @tc.desc: Verify the Cubic Curve with times in and out of range
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimationFrameworkTest, AnimationCurveTest010, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. evaluate the curve at several times, including times out of range.
+     */
+    const float times[] = { -0.5f, 0.2f, 0.5f, 0.8f, 1.5f };
+    float values[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for (size_t i = 0; i < sizeof(times) / sizeof(times[0]); ++i) {
+        values[i] = Curves::EASE_OUT->Move(times[i]);
+    }
+
+    /**
+     * @tc.steps: step2. verify the result of evaluation.
+     * @tc.expected: step2. the result is right and clamped out of range.
+     */
+    EXPECT_NEAR(0.0f, values[0], CUBIC_ERROR_BOUND);
+    EXPECT_NEAR(0.30836f, values[1], CUBIC_ERROR_BOUND);
+    EXPECT_NEAR(0.68465f, values[2], CUBIC_ERROR_BOUND);
+    EXPECT_NEAR(0.93772f, values[3], CUBIC_ERROR_BOUND);
+    EXPECT_NEAR(1.0f, values[4], CUBIC_ERROR_BOUND);
+}
+
+/**
+ * @tc.name: AnimationCurveTest011
+ * @tc.desc: Verify the estimated durations of Spring Curves are cached, and the oldest one is evicted when full
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimationFrameworkTest, AnimationCurveTest011, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create two curves of the same spring.
+     * @tc.expected: step1. the duration is estimated once and shared.
+     */
+    auto firstCurve =
+        AceType::MakeRefPtr<SpringCurve>(0.0f, TEST_SPRING_MASS, TEST_SPRING_STIFFNESS, TEST_SPRING_DAMPING);
+    SpringCurve::SpringKey firstKey(1.0f, 0.0f, TEST_SPRING_MASS, TEST_SPRING_STIFFNESS, TEST_SPRING_DAMPING);
+    ASSERT_EQ(SpringCurve::estimateDurations_.count(firstKey), 1u);
+    auto cachedCount = SpringCurve::estimateDurations_.size();
+    auto secondCurve =
+        AceType::MakeRefPtr<SpringCurve>(0.0f, TEST_SPRING_MASS, TEST_SPRING_STIFFNESS, TEST_SPRING_DAMPING);
+    EXPECT_EQ(SpringCurve::estimateDurations_.size(), cachedCount);
+    EXPECT_FLOAT_EQ(secondCurve->estimateDuration_, firstCurve->estimateDuration_);
+    EXPECT_LT(firstCurve->estimateDuration_, 1.0f);
+
+    /**
+     * @tc.steps: step2. create curves of as many other springs as the cache holds.
+     * @tc.expected: step2. the cache stays full, only the first spring is evicted.
+     */
+    SpringCurve::SpringKey lastKey;
+    for (size_t i = 1; i <= SpringCurve::MAX_CACHED_DURATION_COUNT; ++i) {
+        float velocity = TEST_SPRING_VELOCITY_STEP * i;
+        AceType::MakeRefPtr<SpringCurve>(velocity, TEST_SPRING_MASS, TEST_SPRING_STIFFNESS, TEST_SPRING_DAMPING);
+        lastKey = SpringCurve::SpringKey(1.0f, velocity, TEST_SPRING_MASS, TEST_SPRING_STIFFNESS, TEST_SPRING_DAMPING);
+    }
+    EXPECT_EQ(SpringCurve::estimateDurations_.size(), SpringCurve::MAX_CACHED_DURATION_COUNT);
+    EXPECT_EQ(SpringCurve::cachedKeys_.size(), SpringCurve::MAX_CACHED_DURATION_COUNT);
+    EXPECT_EQ(SpringCurve::estimateDurations_.count(firstKey), 0u);
+    EXPECT_EQ(SpringCurve::estimateDurations_.count(lastKey), 1u);
+}
+
 /**
  * @tc.name: AnimationListenableTest001
  * @tc.desc: Verify the whether listen the value of animation
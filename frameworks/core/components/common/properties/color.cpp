@@ -15,8 +15,10 @@
 
 #include "core/components/common/properties/color.h"
 
+#include <cctype>
 #include <cmath>
-#include <regex>
+#include <cstdlib>
+#include <string_view>
 
 #include "base/utils/linear_map.h"
 #include "base/utils/string_utils.h"
@@ -26,19 +28,147 @@ namespace OHOS::Ace {
 namespace {
 
 constexpr uint32_t COLOR_STRING_SIZE_STANDARD = 8;
-constexpr uint32_t COLOR_STRING_BASE = 16;
-constexpr uint32_t RGB_SUB_MATCH_SIZE = 4;
-constexpr uint32_t RGBA_SUB_MATCH_SIZE = 5;
-
-const std::regex COLOR_WITH_MAGIC("#[0-9A-Fa-f]{6,8}");
-const std::regex COLOR_WITH_MAGIC_MINI("#[0-9A-Fa-f]{3,4}");
-const std::regex COLOR_WITH_RGB(R"(rgb\(([0-9]{1,3})\,([0-9]{1,3})\,([0-9]{1,3})\))", std::regex::icase);
-const std::regex COLOR_WITH_RGBA(R"(rgba\(([0-9]{1,3})\,([0-9]{1,3})\,([0-9]{1,3})\,(\d+\.?\d*)\))", std::regex::icase);
+constexpr uint32_t DECIMAL_BASE = 10;
+constexpr uint32_t HEX_DIGIT_BITS = 4;
+constexpr size_t HEX_COLOR_MIN_LENGTH = 6;
+constexpr size_t HEX_COLOR_MAX_LENGTH = 8;
+constexpr size_t HEX_COLOR_MINI_MIN_LENGTH = 3;
+constexpr size_t HEX_COLOR_MINI_MAX_LENGTH = 4;
+constexpr size_t RGB_CHANNEL_MAX_DIGITS = 3;
+constexpr size_t RGB_CHANNEL_COUNT = 3;
+constexpr std::string_view RGB_PREFIX = "rgb(";
+constexpr std::string_view RGBA_PREFIX = "rgba(";
 constexpr double GAMMA_FACTOR = 2.2;
 constexpr float MAX_ALPHA = 255.0f;
 constexpr char HEX[] = "0123456789ABCDEF";
 constexpr uint8_t BIT_LENGTH_INT32 = 8;
 
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool HexDigitValue(char c, uint32_t& value)
+{
+    if (IsDigit(c)) {
+        value = static_cast<uint32_t>(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+        value = static_cast<uint32_t>(c - 'a') + DECIMAL_BASE;
+    } else if (c >= 'A' && c <= 'F') {
+        value = static_cast<uint32_t>(c - 'A') + DECIMAL_BASE;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Parses #rrggbb, #rrggbbaa (also 7 digits) and the short forms #rgb, #rgba whose digits are doubled.
+bool ParseHexColor(std::string_view colorStr, uint32_t maskAlpha, Color& color)
+{
+    if (colorStr.empty() || colorStr[0] != '#') {
+        return false;
+    }
+    auto digits = colorStr.substr(1);
+    bool isMini = digits.size() >= HEX_COLOR_MINI_MIN_LENGTH && digits.size() <= HEX_COLOR_MINI_MAX_LENGTH;
+    if (!isMini && (digits.size() < HEX_COLOR_MIN_LENGTH || digits.size() > HEX_COLOR_MAX_LENGTH)) {
+        return false;
+    }
+    uint32_t value = 0;
+    for (auto c : digits) {
+        uint32_t digit = 0;
+        if (!HexDigitValue(c, digit)) {
+            return false;
+        }
+        value = (value << HEX_DIGIT_BITS) | digit;
+        if (isMini) {
+            value = (value << HEX_DIGIT_BITS) | digit;
+        }
+    }
+    size_t length = isMini ? digits.size() * 2 : digits.size();
+    if (length < COLOR_STRING_SIZE_STANDARD) {
+        // no alpha specified, set alpha to 0xff
+        value |= maskAlpha;
+    }
+    color = Color(value);
+    return true;
+}
+
+bool StartsWithIgnoreCase(std::string_view str, std::string_view prefix)
+{
+    if (str.size() < prefix.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < prefix.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(str[i])) != prefix[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads one to three decimal digits followed by the separator.
+bool ParseRgbChannel(std::string_view str, size_t& pos, char separator, uint8_t& channel)
+{
+    uint32_t value = 0;
+    size_t start = pos;
+    while (pos < str.size() && IsDigit(str[pos]) && pos - start < RGB_CHANNEL_MAX_DIGITS) {
+        value = value * DECIMAL_BASE + static_cast<uint32_t>(str[pos] - '0');
+        ++pos;
+    }
+    if (pos == start || pos >= str.size() || str[pos] != separator) {
+        return false;
+    }
+    ++pos;
+    channel = static_cast<uint8_t>(value);
+    return true;
+}
+
+// Parses rgb(90,254,180) and rgba(90,254,180,0.5), the function name is case insensitive.
+bool ParseRgbColor(const std::string& colorStr, Color& color)
+{
+    std::string_view str(colorStr);
+    bool hasAlpha = StartsWithIgnoreCase(str, RGBA_PREFIX);
+    if (!hasAlpha && !StartsWithIgnoreCase(str, RGB_PREFIX)) {
+        return false;
+    }
+    size_t pos = hasAlpha ? RGBA_PREFIX.size() : RGB_PREFIX.size();
+    uint8_t channels[RGB_CHANNEL_COUNT] = { 0 };
+    for (size_t i = 0; i < RGB_CHANNEL_COUNT; ++i) {
+        char separator = (i + 1 < RGB_CHANNEL_COUNT || hasAlpha) ? ',' : ')';
+        if (!ParseRgbChannel(str, pos, separator, channels[i])) {
+            return false;
+        }
+    }
+    if (!hasAlpha) {
+        if (pos != str.size()) {
+            return false;
+        }
+        color = Color::FromRGB(channels[0], channels[1], channels[2]);
+        return true;
+    }
+    // Opacity is digits with an optional fraction, e.g. 1, 0.5 or 1.
+    size_t start = pos;
+    while (pos < str.size() && IsDigit(str[pos])) {
+        ++pos;
+    }
+    if (pos == start) {
+        return false;
+    }
+    if (pos < str.size() && str[pos] == '.') {
+        ++pos;
+        while (pos < str.size() && IsDigit(str[pos])) {
+            ++pos;
+        }
+    }
+    if (pos + 1 != str.size() || str[pos] != ')') {
+        return false;
+    }
+    // The opacity is followed by ')', strtod stops right there.
+    double opacity = std::strtod(colorStr.c_str() + start, nullptr);
+    color = Color::FromRGBO(channels[0], channels[1], channels[2], opacity);
+    return true;
+}
+
 } // namespace
 
 const Color Color::TRANSPARENT = Color(0x00000000);
@@ -57,53 +187,18 @@ Color Color::FromString(std::string colorStr, uint32_t maskAlpha)
     }
 
     // Remove all " ".
-    colorStr.erase(std::remove(colorStr.begin(), colorStr.end(), ' '), colorStr.end());
-
-    std::smatch matches;
-    // Regex match for #909090 or #90909090.
-    if (std::regex_match(colorStr, matches, COLOR_WITH_MAGIC)) {
-        colorStr.erase(0, 1);
-        auto value = stoul(colorStr, nullptr, COLOR_STRING_BASE);
-        if (colorStr.length() < COLOR_STRING_SIZE_STANDARD) {
-            // no alpha specified, set alpha to 0xff
-            value |= maskAlpha;
-        }
-        return Color(value);
+    if (colorStr.find(' ') != std::string::npos) {
+        colorStr.erase(std::remove(colorStr.begin(), colorStr.end(), ' '), colorStr.end());
     }
-    // Regex match for #rgb or #rgba.
-    if (std::regex_match(colorStr, matches, COLOR_WITH_MAGIC_MINI)) {
-        colorStr.erase(0, 1);
-        std::string newColorStr;
-        // translate #rgb or #rgba to #rrggbb or #rrggbbaa
-        for (auto& c : colorStr) {
-            newColorStr += c;
-            newColorStr += c;
-        }
-        auto value = stoul(newColorStr, nullptr, COLOR_STRING_BASE);
-        if (newColorStr.length() < COLOR_STRING_SIZE_STANDARD) {
-            // no alpha specified, set alpha to 0xff
-            value |= maskAlpha;
-        }
-        return Color(value);
-    }
-    // Regex match for rgb(90,254,180).
-    if (std::regex_match(colorStr, matches, COLOR_WITH_RGB)) {
-        if (matches.size() == RGB_SUB_MATCH_SIZE) {
-            auto red = static_cast<uint8_t>(std::stoi(matches[1]));   // red value.
-            auto green = static_cast<uint8_t>(std::stoi(matches[2])); // green value.
-            auto blue = static_cast<uint8_t>(std::stoi(matches[3]));  // blue value.
-            return FromRGB(red, green, blue);
-        }
+
+    Color color;
+    // Match for #909090, #90909090, #rgb or #rgba.
+    if (ParseHexColor(colorStr, maskAlpha, color)) {
+        return color;
     }
-    // Regex match for rgba(90,254,180,0.5).
-    if (std::regex_match(colorStr, matches, COLOR_WITH_RGBA)) {
-        if (matches.size() == RGBA_SUB_MATCH_SIZE) {
-            auto red = static_cast<uint8_t>(std::stoi(matches[1]));
-            auto green = static_cast<uint8_t>(std::stoi(matches[2]));
-            auto blue = static_cast<uint8_t>(std::stoi(matches[3]));
-            auto opacity = static_cast<double>(std::stod(matches[4]));
-            return FromRGBO(red, green, blue, opacity);
-        }
+    // Match for rgb(90,254,180) or rgba(90,254,180,0.5).
+    if (ParseRgbColor(colorStr, color)) {
+        return color;
     }
     // match for special string
     static const LinearMapNode<Color> colorTable[] = {
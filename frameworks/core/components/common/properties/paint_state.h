@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_BASE_PROPERTIES_PAINT_STATE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_BASE_PROPERTIES_PAINT_STATE_H
 
+#include <type_traits>
+
 #include "base/memory/ace_type.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components/common/properties/color.h"
@@ -95,6 +97,10 @@ struct CanvasImage {
     std::string src;
 };
 
+static_assert(sizeof(Color) == sizeof(uint32_t), "Color must be a packed 32-bit ARGB value");
+static_assert(std::is_standard_layout_v<Color> && std::is_trivially_copyable_v<Color>,
+    "Color must be copyable as raw bytes");
+
 struct ImageData {
     int32_t x = 0;
     int32_t y = 0;
@@ -103,6 +109,24 @@ struct ImageData {
     int32_t dirtyWidth = 0;
     int32_t dirtyHeight = 0;
     std::vector<Color> data;
+
+    // Pixels of data are packed 32-bit ARGB values, which is the memory layout of BGRA_8888 on little endian,
+    // so they are read and drawn by the graphics library in place.
+    const uint32_t* GetPixels() const
+    {
+        return reinterpret_cast<const uint32_t*>(data.data());
+    }
+
+    uint32_t* GetPixels()
+    {
+        return reinterpret_cast<uint32_t*>(data.data());
+    }
+
+    bool HasPixels() const
+    {
+        return dirtyWidth > 0 && dirtyHeight > 0 &&
+               data.size() >= static_cast<size_t>(dirtyWidth) * static_cast<size_t>(dirtyHeight);
+    }
 };
 
 enum class ContextType {
@@ -1407,26 +1407,16 @@ void RosenRenderCustomPaint::UpdatePaintShader(const Pattern& pattern, SkPaint&
 
 void RosenRenderCustomPaint::PutImageData(const Offset& offset, const ImageData& imageData)
 {
-    if (imageData.data.empty()) {
+    if (!imageData.HasPixels()) {
         LOGE("PutImageData failed, image data is empty.");
         return;
     }
-    uint32_t* data = new (std::nothrow) uint32_t[imageData.data.size()];
-    if (data == nullptr) {
-        LOGE("PutImageData failed, new data is null.");
-        return;
-    }
-
-    for (uint32_t i = 0; i < imageData.data.size(); ++i) {
-        data[i] = imageData.data[i].GetValue();
-    }
     SkBitmap skBitmap;
     auto imageInfo = SkImageInfo::Make(imageData.dirtyWidth, imageData.dirtyHeight, SkColorType::kBGRA_8888_SkColorType,
         SkAlphaType::kOpaque_SkAlphaType);
-    skBitmap.allocPixels(imageInfo);
-    skBitmap.setPixels(data);
+    // The pixels are already in the layout of BGRA_8888, draw them in place.
+    skBitmap.installPixels(imageInfo, const_cast<uint32_t*>(imageData.GetPixels()), imageInfo.minRowBytes());
     skCanvas_->drawBitmap(skBitmap, imageData.x, imageData.y);
-    delete[] data;
 }
 
 std::unique_ptr<ImageData> RosenRenderCustomPaint::GetImageData(double left, double top, double width, double height)
@@ -1450,20 +1440,12 @@ std::unique_ptr<ImageData> RosenRenderCustomPaint::GetImageData(double left, dou
     auto dstRect = SkRect::MakeXYWH(0.0, 0.0, dirtyWidth, dirtyHeight);
     tempCanvas.drawBitmapRect(canvasCache_, srcRect, dstRect, nullptr);
     int32_t size = dirtyWidth * dirtyHeight;
-    // write color
-    std::unique_ptr<uint8_t[]> pixels = std::make_unique<uint8_t[]>(size * 4);
-    tempCache.readPixels(imageInfo, pixels.get(), dirtyWidth * imageInfo.bytesPerPixel(), 0, 0);
     std::unique_ptr<ImageData> imageData = std::make_unique<ImageData>();
     imageData->dirtyWidth = dirtyWidth;
     imageData->dirtyHeight = dirtyHeight;
-    // a pixel include 4 data(blue, green, red, alpha)
-    for (int i = 0; i < size * 4; i += 4) {
-        auto blue = pixels[i];
-        auto green = pixels[i + 1];
-        auto red = pixels[i + 2];
-        auto alpha = pixels[i + 3];
-        imageData->data.emplace_back(Color::FromARGB(alpha, red, green, blue));
-    }
+    // Read the pixels straight into the image data, its colors are in the layout of BGRA_8888.
+    imageData->data.resize(size, Color::TRANSPARENT);
+    tempCache.readPixels(imageInfo, imageData->GetPixels(), dirtyWidth * imageInfo.bytesPerPixel(), 0, 0);
     return imageData;
 }
 
@@ -1514,31 +1496,21 @@ void RosenRenderCustomPaint::DrawBitmapMesh(const RefPtr<OffscreenCanvas>& offsc
     std::unique_ptr<ImageData> imageData = offscreenCanvas->GetImageData(0, 0,
         offscreenCanvas->GetWidth(), offscreenCanvas->GetHeight());
     if (imageData != nullptr) {
-        if (imageData->data.empty()) {
+        if (!imageData->HasPixels()) {
             LOGE("PutImageData failed, image data is empty.");
             return;
         }
-        uint32_t* data = new (std::nothrow)uint32_t[imageData->data.size()];
-        if (data == nullptr) {
-            LOGE("PutImageData failed, new data is null.");
-            return;
-        }
-
-        for (uint32_t i = 0; i < imageData->data.size(); ++i) {
-            data[i] = imageData->data[i].GetValue();
-        }
         SkBitmap skBitmap;
         auto imageInfo = SkImageInfo::Make(imageData->dirtyWidth, imageData->dirtyHeight,
             SkColorType::kBGRA_8888_SkColorType, SkAlphaType::kOpaque_SkAlphaType);
-        skBitmap.allocPixels(imageInfo);
-        skBitmap.setPixels(data);
+        // The pixels are already in the layout of BGRA_8888, draw them in place.
+        skBitmap.installPixels(imageInfo, const_cast<uint32_t*>(imageData->GetPixels()), imageInfo.minRowBytes());
         uint32_t size = mesh.size();
         float verts[size];
         for (uint32_t i = 0; i < size; i++) {
             verts[i] = mesh[i];
         }
         Mesh(skBitmap, column, row, verts, 0, nullptr);
-        delete[] data;
     }
     LOGD("RosenRenderCustomPaint::DrawBitmapMesh");
 }
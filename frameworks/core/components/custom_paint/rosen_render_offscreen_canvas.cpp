@@ -198,24 +198,15 @@ void RosenRenderOffscreenCanvas::FillRect(Rect rect)
 
 void RosenRenderOffscreenCanvas::PutImageData(const ImageData& imageData)
 {
-    if (imageData.data.empty()) {
+    if (!imageData.HasPixels()) {
         return;
     }
-    uint32_t* data = new (std::nothrow)uint32_t[imageData.data.size()];
-    if (data == nullptr) {
-        return;
-    }
-
-    for (uint32_t i = 0; i < imageData.data.size(); ++i) {
-        data[i] = imageData.data[i].GetValue();
-    }
     SkBitmap skBitmap;
     auto imageInfo = SkImageInfo::Make(imageData.dirtyWidth, imageData.dirtyHeight, SkColorType::kBGRA_8888_SkColorType,
         SkAlphaType::kOpaque_SkAlphaType);
-    skBitmap.allocPixels(imageInfo);
-    skBitmap.setPixels(data);
+    // The pixels are already in the layout of BGRA_8888, draw them in place.
+    skBitmap.installPixels(imageInfo, const_cast<uint32_t*>(imageData.GetPixels()), imageInfo.minRowBytes());
     skCanvas_->drawBitmap(skBitmap, imageData.x, imageData.y);
-    delete[] data;
 }
 
 void RosenRenderOffscreenCanvas::SetPaintImage()
@@ -479,20 +470,14 @@ std::unique_ptr<ImageData> RosenRenderOffscreenCanvas::GetImageData(double left,
     double dirtyWidth = width >= 0 ? width : 0;
     double dirtyHeight = height >= 0 ? height : 0;
     int32_t size = dirtyWidth * dirtyHeight;
-    // write color
-    std::unique_ptr<uint8_t[]> pixels = std::make_unique<uint8_t[]>(size * 4);
-    skCanvas_->readPixels(imageInfo, pixels.get(), dirtyWidth * imageInfo.bytesPerPixel(), 0, 0);
     std::unique_ptr<ImageData> imageData = std::make_unique<ImageData>();
     imageData->dirtyWidth = dirtyWidth;
     imageData->dirtyHeight = dirtyHeight;
-    // a pixel include 4 data blue, green, red, alpha
-    for (int i = 0; i < size * 4; i += 4) {
-        auto blue = pixels[i];
-        auto green = pixels[i + 1];
-        auto red = pixels[i + 2];
-        auto alpha = pixels[i + 3];
-        imageData->data.emplace_back(Color::FromARGB(alpha, red, green, blue));
-    }
+    // Read the pixels straight into the image data, its colors are in the layout of BGRA_8888. Pixels out of the
+    // canvas are not read and stay transparent.
+    imageData->data.resize(size, Color::TRANSPARENT);
+    skCanvas_->readPixels(imageInfo, imageData->GetPixels(), dirtyWidth * imageInfo.bytesPerPixel(),
+        static_cast<int32_t>(left), static_cast<int32_t>(top));
     return imageData;
 }
 
@@ -1615,10 +1615,12 @@ void Declaration::SetCurrentStyle(const std::pair<std::string, std::string>& sty
         styleSetter[operatorIter].value(style.second, *this);
     }
 
+    if (!AceApplicationInfo::GetInstance().GetIsCardType()) {
+        return;
+    }
     auto& renderAttr = static_cast<CommonRenderAttribute&>(GetAttribute(AttributeTag::COMMON_RENDER_ATTR));
     static const std::unordered_set<std::string> displayStyleSet = { DOM_OPACITY, DOM_DISPLAY, DOM_VISIBILITY };
-    if (displayStyleSet.find(style.first) != displayStyleSet.end() &&
-        AceApplicationInfo::GetInstance().GetIsCardType() && renderAttr.show == "false") {
+    if (renderAttr.show == "false" && displayStyleSet.find(style.first) != displayStyleSet.end()) {
         SetShowAttr(renderAttr.show);
     }
 }
@@ -3225,25 +3227,23 @@ RefPtr<ThemeConstants> Declaration::GetThemeConstants() const
 
 Color Declaration::ParseColor(const std::string& value, uint32_t maskAlpha) const
 {
-    auto themeConstants = GetThemeConstants();
+    // Theme constants are only looked up for references, literals don't need them.
     auto&& noRefFunc = [&value, maskAlpha = maskAlpha]() { return Color::FromString(value, maskAlpha); };
-    auto&& idRefFunc = [constants = themeConstants](uint32_t refId) { return constants->GetColor(refId); };
+    auto&& idRefFunc = [this](uint32_t refId) { return GetThemeConstants()->GetColor(refId); };
     return ParseThemeReference<Color>(value, noRefFunc, idRefFunc, Color::TRANSPARENT);
 }
 
 double Declaration::ParseDouble(const std::string& value) const
 {
-    auto themeConstants = GetThemeConstants();
     auto&& noRefFunc = [&value]() { return StringUtils::StringToDouble(value); };
-    auto&& idRefFunc = [constants = themeConstants](uint32_t refId) { return constants->GetDouble(refId); };
+    auto&& idRefFunc = [this](uint32_t refId) { return GetThemeConstants()->GetDouble(refId); };
     return ParseThemeReference<double>(value, noRefFunc, idRefFunc, 0.0);
 }
 
 Dimension Declaration::ParseDimension(const std::string& value, bool useVp) const
 {
-    auto themeConstants = GetThemeConstants();
     auto&& noRefFunc = [&value, useVp]() { return StringUtils::StringToDimension(value, useVp); };
-    auto&& idRefFunc = [constants = themeConstants](uint32_t refId) { return constants->GetDimension(refId); };
+    auto&& idRefFunc = [this](uint32_t refId) { return GetThemeConstants()->GetDimension(refId); };
     return ParseThemeReference<Dimension>(value, noRefFunc, idRefFunc, Dimension());
 }
 
@@ -723,6 +723,7 @@ void RenderFlex::PlaceChildren(double frontSpace, double betweenSpace, const Bas
             case FlexAlign::BASELINE:
                 childCrossPos = 0.0;
                 if (direction_ == FlexDirection::ROW || direction_ == FlexDirection::ROW_REVERSE) {
+                    item->EnsureLayoutCommitted();
                     double distance = item->GetBaselineDistance(textBaseline_);
                     childCrossPos = baselineProperties.maxBaselineDistance - distance;
                 }
@@ -797,6 +798,7 @@ void RenderFlex::RelayoutFlexItem(const RefPtr<RenderFlexItem>& flexItem, double
         return;
     }
     auto mainFlexExtent = flexSize + GetMainSize(flexItem);
+    flexItem->EnsureLayoutCommitted();
     auto childMainContent = GetMainAxisValue(flexItem->GetContentSize(), direction_);
     if (childMainContent > mainFlexExtent) {
         mainFlexExtent = childMainContent;
@@ -856,6 +858,8 @@ void RenderFlex::CheckBaselineProperties(const RefPtr<RenderNode>& item, Baselin
     auto flexItem = AceType::DynamicCast<RenderFlexItem>(item);
     bool isChildBaselineAlign = flexItem ? flexItem->GetAlignSelf() == FlexAlign::BASELINE : false;
     if (crossAxisAlign_ == FlexAlign::BASELINE || isChildBaselineAlign) {
+        // Baseline depends on the laid out subtree, not only on the measured size.
+        item->EnsureLayoutCommitted();
         double distance = item->GetBaselineDistance(textBaseline_);
         baselineProperties.maxBaselineDistance = std::max(baselineProperties.maxBaselineDistance, distance);
         baselineProperties.maxDistanceAboveBaseline = std::max(baselineProperties.maxDistanceAboveBaseline, distance);
@@ -101,6 +101,12 @@ public:
 
     Size GetChildViewPort() override;
 
+    // Flex measures children several times with different constraints, only their sizes are read meanwhile.
+    bool AllowChildMeasureCache() const override
+    {
+        return true;
+    }
+
     void OnChildRemoved(const RefPtr<RenderNode>& child) override;
 
     void Dump() override;
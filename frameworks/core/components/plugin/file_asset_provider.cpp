@@ -48,41 +48,15 @@ std::unique_ptr<fml::Mapping> FileAssetProvider::GetAsMapping(const std::string&
 
     for (const auto& basePath : assetBasePaths_) {
         std::string fileName = packagePath_ + basePath + assetName;
-        std::FILE* fp = std::fopen(fileName.c_str(), "r");
-        if (fp == nullptr) {
+        auto file = MappedFile::Open(fileName, static_cast<size_t>(FOO_MAX_LEN));
+        if (!file) {
             continue;
         }
-
-        if (std::fseek(fp, 0, SEEK_END) != 0) {
-            LOGE("seek file tail error");
-            std::fclose(fp);
+        if (file->GetSize() == 0) {
+            LOGE("file is empty");
             continue;
         }
-
-        int64_t size = std::ftell(fp);
-        if (size == -1L || size == 0L || size > FOO_MAX_LEN) {
-            LOGE("tell file error");
-            std::fclose(fp);
-            continue;
-        }
-        uint8_t* dataArray = new (std::nothrow) uint8_t[size];
-        if (dataArray == nullptr) {
-            LOGE("new uint8_t array failed");
-            std::fclose(fp);
-            continue;
-        }
-
-        rewind(fp);
-        std::unique_ptr<uint8_t[]> data(dataArray);
-        size_t result = std::fread(data.get(), 1, size, fp);
-        if (result != (size_t)size) {
-            LOGE("read file failed");
-            std::fclose(fp);
-            continue;
-        }
-
-        std::fclose(fp);
-        return std::make_unique<FileAssetMapping>(std::move(data), size);
+        return std::make_unique<FileAssetMapping>(file);
     }
     return nullptr;
 }
@@ -25,6 +25,7 @@
 #include "flutter/fml/mapping.h"
 
 #include "base/resource/asset_manager.h"
+#include "base/resource/mapped_file.h"
 #include "base/utils/macros.h"
 #include "core/common/flutter/flutter_asset_manager.h"
 
@@ -49,23 +50,22 @@ public:
 private:
     class FileAssetMapping : public fml::Mapping {
     public:
-        FileAssetMapping(std::unique_ptr<uint8_t[]> data, size_t size) : data_(std::move(data)), size_(size) {}
+        explicit FileAssetMapping(const RefPtr<MappedFile>& file) : file_(file) {}
 
         ~FileAssetMapping() override {}
 
         size_t GetSize() const override
         {
-            return size_;
+            return file_->GetSize();
         }
 
         const uint8_t* GetMapping() const override
         {
-            return data_.get();
+            return file_->GetData();
         }
 
     private:
-        std::unique_ptr<uint8_t[]> data_ = nullptr;
-        size_t size_ = 0;
+        RefPtr<MappedFile> file_;
     };
 
     mutable std::mutex mutex_;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/components/custom_paint/flutter_render_offscreen_canvas.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t CANVAS_WIDTH = 10;
+constexpr int32_t CANVAS_HEIGHT = 10;
+constexpr int32_t BLOCK_X = 2;
+constexpr int32_t BLOCK_Y = 3;
+constexpr int32_t BLOCK_WIDTH = 4;
+constexpr int32_t BLOCK_HEIGHT = 3;
+constexpr int32_t EDGE_SIZE = 4;
+// Part of an edge block inside the canvas, when the block is moved half out of it.
+constexpr int32_t EDGE_INSIDE_SIZE = 2;
+constexpr uint8_t OPAQUE_ALPHA = 255;
+constexpr uint8_t COLOR_STEP = 10;
+// The canvas draws without a pipeline context.
+const WeakPtr<PipelineContext> TEST_CONTEXT;
+
+// Opaque colors which are all different, opaque pixels are stored unchanged by the canvas.
+ImageData CreateImageData(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    ImageData imageData;
+    imageData.x = x;
+    imageData.y = y;
+    imageData.dirtyWidth = width;
+    imageData.dirtyHeight = height;
+    for (int32_t i = 0; i < width * height; ++i) {
+        auto value = static_cast<uint8_t>(i * COLOR_STEP);
+        imageData.data.emplace_back(Color::FromARGB(OPAQUE_ALPHA, value, OPAQUE_ALPHA - value, i));
+    }
+    return imageData;
+}
+
+Color GetPixel(const ImageData& imageData, int32_t x, int32_t y)
+{
+    return imageData.data[y * imageData.dirtyWidth + x];
+}
+
+} // namespace
+
+class RenderOffscreenCanvasTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: RenderOffscreenCanvasImageData001
+ * @tc.desc: Image data put into the canvas is read back unchanged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderOffscreenCanvasTest, RenderOffscreenCanvasImageData001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put image data into the canvas and read the same rect.
+     * @tc.expected: step1. the pixels read are the pixels put.
+     */
+    auto canvas = AceType::MakeRefPtr<FlutterRenderOffscreenCanvas>(TEST_CONTEXT, CANVAS_WIDTH, CANVAS_HEIGHT);
+    auto block = CreateImageData(BLOCK_X, BLOCK_Y, BLOCK_WIDTH, BLOCK_HEIGHT);
+    canvas->PutImageData(block);
+    auto readBlock = canvas->GetImageData(BLOCK_X, BLOCK_Y, BLOCK_WIDTH, BLOCK_HEIGHT);
+    ASSERT_TRUE(readBlock);
+    EXPECT_EQ(readBlock->dirtyWidth, BLOCK_WIDTH);
+    EXPECT_EQ(readBlock->dirtyHeight, BLOCK_HEIGHT);
+    EXPECT_EQ(readBlock->data, block.data);
+
+    /**
+     * @tc.steps: step2. put image data with fewer pixels than its rect, then read the rect.
+     * @tc.expected: step2. nothing is drawn.
+     */
+    auto shortBlock = CreateImageData(BLOCK_X, BLOCK_Y, BLOCK_WIDTH, BLOCK_HEIGHT);
+    shortBlock.data.assign(BLOCK_WIDTH, Color::BLACK);
+    EXPECT_FALSE(shortBlock.HasPixels());
+    canvas->PutImageData(shortBlock);
+    readBlock = canvas->GetImageData(BLOCK_X, BLOCK_Y, BLOCK_WIDTH, BLOCK_HEIGHT);
+    ASSERT_TRUE(readBlock);
+    EXPECT_EQ(readBlock->data, block.data);
+}
+
+/**
+ * @tc.name: RenderOffscreenCanvasImageData002
+ * @tc.desc: Image data partially out of the canvas is drawn and read for the part inside of it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderOffscreenCanvasTest, RenderOffscreenCanvasImageData002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put image data over the bottom right corner, then read the same rect.
+     * @tc.expected: step1. pixels inside the canvas are read back, pixels out of it are transparent.
+     */
+    auto canvas = AceType::MakeRefPtr<FlutterRenderOffscreenCanvas>(TEST_CONTEXT, CANVAS_WIDTH, CANVAS_HEIGHT);
+    int32_t edgeX = CANVAS_WIDTH - EDGE_INSIDE_SIZE;
+    int32_t edgeY = CANVAS_HEIGHT - EDGE_INSIDE_SIZE;
+    auto block = CreateImageData(edgeX, edgeY, EDGE_SIZE, EDGE_SIZE);
+    canvas->PutImageData(block);
+    auto readBlock = canvas->GetImageData(edgeX, edgeY, EDGE_SIZE, EDGE_SIZE);
+    ASSERT_TRUE(readBlock);
+    ASSERT_EQ(readBlock->data.size(), block.data.size());
+    for (int32_t y = 0; y < EDGE_SIZE; ++y) {
+        for (int32_t x = 0; x < EDGE_SIZE; ++x) {
+            bool isInside = x < EDGE_INSIDE_SIZE && y < EDGE_INSIDE_SIZE;
+            EXPECT_EQ(GetPixel(*readBlock, x, y), isInside ? GetPixel(block, x, y) : Color::TRANSPARENT);
+        }
+    }
+
+    /**
+     * @tc.steps: step2. put image data at the top left corner, then read a rect over the corner.
+     * @tc.expected: step2. the pixels of the corner are read at their offset, pixels out of the canvas are
+     *                   transparent.
+     */
+    auto cornerBlock = CreateImageData(0, 0, EDGE_INSIDE_SIZE, EDGE_INSIDE_SIZE);
+    canvas->PutImageData(cornerBlock);
+    int32_t outside = EDGE_SIZE - EDGE_INSIDE_SIZE;
+    readBlock = canvas->GetImageData(-outside, -outside, EDGE_SIZE, EDGE_SIZE);
+    ASSERT_TRUE(readBlock);
+    for (int32_t y = 0; y < EDGE_SIZE; ++y) {
+        for (int32_t x = 0; x < EDGE_SIZE; ++x) {
+            bool isInside = x >= outside && y >= outside;
+            EXPECT_EQ(GetPixel(*readBlock, x, y),
+                isInside ? GetPixel(cornerBlock, x - outside, y - outside) : Color::TRANSPARENT);
+        }
+    }
+}
+
+} // namespace OHOS::Ace
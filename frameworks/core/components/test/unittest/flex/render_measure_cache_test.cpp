@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "core/pipeline/base/render_node.h"
+#undef private
+#undef protected
+#include "core/components/test/unittest/mock/mock_render_common.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr double NODE_WIDTH = 100.0;
+constexpr double NODE_HEIGHT = 50.0;
+constexpr double WIDE_WIDTH = 200.0;
+constexpr double NARROW_WIDTH = 60.0;
+constexpr double OTHER_WIDTH = 80.0;
+constexpr double MAX_HEIGHT = 1000.0;
+
+// Takes the constrained size of a fixed size, and counts its layouts.
+class MeasureCountNode final : public RenderNode {
+    DECLARE_ACE_TYPE(MeasureCountNode, RenderNode);
+
+public:
+    void Update(const RefPtr<Component>& component) override {}
+
+    void PerformLayout() override
+    {
+        ++layoutCount_;
+        SetLayoutSize(GetLayoutParam().Constrain(Size(NODE_WIDTH, NODE_HEIGHT)));
+        for (const auto& child : GetChildren()) {
+            child->Layout(GetLayoutParam());
+        }
+    }
+
+    int32_t layoutCount_ = 0;
+};
+
+// Parent which lets its children reuse measured sizes, like RenderFlex.
+class MeasureCacheParent final : public RenderNode {
+    DECLARE_ACE_TYPE(MeasureCacheParent, RenderNode);
+
+public:
+    void Update(const RefPtr<Component>& component) override {}
+    void PerformLayout() override {}
+
+    bool AllowChildMeasureCache() const override
+    {
+        return true;
+    }
+};
+
+LayoutParam MakeLayoutParam(double maxWidth)
+{
+    return LayoutParam(Size(maxWidth, MAX_HEIGHT), Size());
+}
+
+} // namespace
+
+class RenderMeasureCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override {}
+
+protected:
+    RefPtr<PipelineContext> context_;
+    RefPtr<MeasureCacheParent> parent_;
+    RefPtr<MeasureCountNode> node_;
+    RefPtr<MeasureCountNode> child_;
+};
+
+void RenderMeasureCacheTest::SetUp()
+{
+    context_ = MockRenderCommon::GetMockContext();
+    parent_ = AceType::MakeRefPtr<MeasureCacheParent>();
+    parent_->Attach(context_);
+    node_ = AceType::MakeRefPtr<MeasureCountNode>();
+    node_->Attach(context_);
+    parent_->AddChild(node_);
+    child_ = AceType::MakeRefPtr<MeasureCountNode>();
+    child_->Attach(context_);
+    node_->AddChild(child_);
+
+    // Measure the node with a wide and a narrow param, it is laid out for the narrow one.
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    node_->Layout(MakeLayoutParam(NARROW_WIDTH));
+}
+
+/**
+ * @tc.name: RenderMeasureCache001
+ * @tc.desc: A clean node takes a measured size without layout, and is laid out after its parent.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderMeasureCacheTest, RenderMeasureCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. lay out the node with the wide param again.
+     * @tc.expected: step1. the measured size is taken without layout, the subtree is still laid out for the narrow
+     *                      param.
+     */
+    ASSERT_EQ(node_->layoutCount_, 2);
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 2);
+    EXPECT_EQ(node_->GetLayoutSize(), Size(NODE_WIDTH, NODE_HEIGHT));
+    EXPECT_EQ(child_->GetLayoutSize(), Size(NARROW_WIDTH, NODE_HEIGHT));
+    EXPECT_TRUE(node_->IsLayoutParamChanged());
+
+    /**
+     * @tc.steps: step2. finish the layout of the parent.
+     * @tc.expected: step2. the node is laid out for the wide param.
+     */
+    parent_->OnLayout();
+    EXPECT_EQ(node_->layoutCount_, 3);
+    EXPECT_EQ(child_->GetLayoutSize(), Size(NODE_WIDTH, NODE_HEIGHT));
+    EXPECT_FALSE(node_->IsLayoutParamChanged());
+}
+
+/**
+ * @tc.name: RenderMeasureCache002
+ * @tc.desc: A measured size taken for the param the node is laid out with needs no layout and leaves no change.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderMeasureCacheTest, RenderMeasureCache002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. measure with the wide param, then with the narrow one the node is laid out with.
+     * @tc.expected: step1. both sizes are taken without layout, the layout param is not changed at last.
+     */
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    node_->Layout(MakeLayoutParam(NARROW_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 2);
+    EXPECT_EQ(node_->GetLayoutSize(), Size(NARROW_WIDTH, NODE_HEIGHT));
+    EXPECT_FALSE(node_->IsLayoutParamChanged());
+
+    /**
+     * @tc.steps: step2. finish the layout of the parent, then lay out the node with an unknown param.
+     * @tc.expected: step2. nothing is laid out after the parent, the unknown param is laid out.
+     */
+    parent_->OnLayout();
+    EXPECT_EQ(node_->layoutCount_, 2);
+    node_->Layout(MakeLayoutParam(OTHER_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 3);
+    EXPECT_EQ(node_->GetLayoutSize(), Size(OTHER_WIDTH, NODE_HEIGHT));
+}
+
+/**
+ * @tc.name: RenderMeasureCache003
+ * @tc.desc: Measured sizes are dropped when the node or a child needs layout.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderMeasureCacheTest, RenderMeasureCache003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. mark the node itself as needing layout, as a property change does.
+     * @tc.expected: step1. the wide param is laid out again.
+     */
+    node_->MarkNeedLayout();
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 3);
+
+    /**
+     * @tc.steps: step2. measure the narrow param, then mark the child as needing layout.
+     * @tc.expected: step2. the narrow param is taken from the cache first, and laid out again after the child
+     *                      changed.
+     */
+    node_->Layout(MakeLayoutParam(NARROW_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 4);
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 4);
+    parent_->OnLayout();
+    EXPECT_EQ(node_->layoutCount_, 5);
+    child_->MarkNeedLayout();
+    EXPECT_TRUE(node_->NeedLayout());
+    node_->Layout(MakeLayoutParam(NARROW_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 6);
+}
+
+/**
+ * @tc.name: RenderMeasureCache004
+ * @tc.desc: Measured sizes of ancestors are dropped when a relayout of a descendant stops below them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderMeasureCacheTest, RenderMeasureCache004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. mark the child alone as needing layout.
+     * @tc.expected: step1. the node is not marked, but the wide param is laid out again.
+     */
+    child_->MarkNeedLayout(true);
+    EXPECT_TRUE(child_->NeedLayout());
+    EXPECT_FALSE(node_->NeedLayout());
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 3);
+
+    /**
+     * @tc.steps: step2. measure the narrow param, then mark the child as needing layout while it is a layout
+     *                   boundary.
+     * @tc.expected: step2. the node is not marked, but the narrow param is laid out again.
+     */
+    node_->Layout(MakeLayoutParam(NARROW_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 4);
+    child_->TakeBoundary();
+    child_->MarkNeedLayout();
+    EXPECT_TRUE(child_->NeedLayout());
+    EXPECT_FALSE(node_->NeedLayout());
+    EXPECT_TRUE(node_->measureCache_.empty());
+    node_->Layout(MakeLayoutParam(WIDE_WIDTH));
+    node_->Layout(MakeLayoutParam(NARROW_WIDTH));
+    EXPECT_EQ(node_->layoutCount_, 6);
+}
+
+} // namespace OHOS::Ace
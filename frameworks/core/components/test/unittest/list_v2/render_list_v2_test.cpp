@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/components/scroll/scrollable.h"
+#include "core/components/test/unittest/mock/mock_render_common.h"
+
+#define private public
+#define protected public
+#include "core/components_v2/list/render_list.h"
+#include "core/components_v2/list/render_list_item.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::V2 {
+namespace {
+
+constexpr size_t TOTAL_COUNT = 100;
+constexpr size_t START_INDEX = 10;
+constexpr size_t ITEM_COUNT = 5;
+constexpr double ITEM_SIZE = 100.0;
+// Remaining idle time in microseconds, long enough to build an item, or too short to build any.
+constexpr int64_t LONG_DEADLINE = 16000;
+constexpr int64_t SHORT_DEADLINE = 0;
+
+class MockListItemGenerator final : public ListItemGenerator {
+public:
+    RefPtr<RenderListItem> RequestListItem(size_t index) override
+    {
+        requested.emplace_back(index);
+        return AceType::DynamicCast<RenderListItem>(RenderListItem::Create());
+    }
+
+    void RecycleListItem(size_t index) override
+    {
+        recycled.emplace_back(index);
+    }
+
+    size_t TotalCount() override
+    {
+        return TOTAL_COUNT;
+    }
+
+    size_t FindPreviousStickyListItem(size_t index) override
+    {
+        return INVALID_INDEX;
+    }
+
+    std::vector<size_t> requested;
+    std::vector<size_t> recycled;
+};
+
+} // namespace
+
+class RenderListV2Test : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override;
+
+    RefPtr<PipelineContext> mockContext_;
+    RefPtr<RenderList> renderList_;
+    RefPtr<MockListItemGenerator> generator_;
+};
+
+void RenderListV2Test::SetUp()
+{
+    mockContext_ = MockRenderCommon::GetMockContext();
+    renderList_ = AceType::MakeRefPtr<RenderList>();
+    renderList_->Attach(mockContext_);
+    generator_ = AceType::MakeRefPtr<MockListItemGenerator>();
+    renderList_->RegisterItemGenerator(generator_);
+
+    // Items START_INDEX to START_INDEX + ITEM_COUNT are in the layout range.
+    renderList_->startIndex_ = START_INDEX;
+    for (size_t i = 0; i < ITEM_COUNT; ++i) {
+        renderList_->items_.emplace_back(AceType::DynamicCast<RenderListItem>(RenderListItem::Create()));
+    }
+    renderList_->realMainSize_ = ITEM_SIZE * ITEM_COUNT;
+    renderList_->currentStickyIndex_ = RenderList::INVALID_CHILD_INDEX;
+    renderList_->selectedItemIndex_ = RenderList::INVALID_CHILD_INDEX;
+    renderList_->reachStart_ = false;
+    renderList_->reachEnd_ = false;
+}
+
+void RenderListV2Test::TearDown()
+{
+    mockContext_ = nullptr;
+    renderList_ = nullptr;
+    generator_ = nullptr;
+}
+
+/**
+ * @tc.name: RenderListPredictLayout001
+ * @tc.desc: Items ahead of the scrolling direction are built in idle time.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderListV2Test, RenderListPredictLayout001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. predict without enough idle time.
+     * @tc.expected: step1. no item is built.
+     */
+    renderList_->OnPredictLayout(SHORT_DEADLINE);
+    EXPECT_TRUE(generator_->requested.empty());
+
+    /**
+     * @tc.steps: step2. predict when scrolling forward, twice.
+     * @tc.expected: step2. the item after the layout range is built once.
+     */
+    renderList_->OnPredictLayout(LONG_DEADLINE);
+    renderList_->OnPredictLayout(LONG_DEADLINE);
+    EXPECT_EQ(generator_->requested, std::vector<size_t>({ START_INDEX + ITEM_COUNT }));
+    EXPECT_EQ(renderList_->predictedItems_.count(START_INDEX + ITEM_COUNT), 1u);
+
+    /**
+     * @tc.steps: step3. scroll by zero offset, then predict.
+     * @tc.expected: step3. the direction is kept and no more item is built.
+     */
+    renderList_->UpdateScrollPosition(0.0, SCROLL_FROM_NONE);
+    EXPECT_TRUE(renderList_->scrollForward_);
+    renderList_->OnPredictLayout(LONG_DEADLINE);
+    EXPECT_EQ(generator_->requested.size(), 1u);
+
+    /**
+     * @tc.steps: step4. scroll backward, then predict.
+     * @tc.expected: step4. the item built ahead is recycled and the item before the layout range is built.
+     */
+    renderList_->UpdateScrollPosition(ITEM_SIZE, SCROLL_FROM_NONE);
+    EXPECT_FALSE(renderList_->scrollForward_);
+    renderList_->OnPredictLayout(LONG_DEADLINE);
+    EXPECT_EQ(generator_->recycled, std::vector<size_t>({ START_INDEX + ITEM_COUNT }));
+    EXPECT_EQ(generator_->requested.back(), START_INDEX - 1);
+    EXPECT_EQ(renderList_->predictedItems_.size(), 1u);
+}
+
+/**
+ * @tc.name: RenderListPredictLayout002
+ * @tc.desc: Predicted items are recycled or taken by the layout when items are removed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderListV2Test, RenderListPredictLayout002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. predict an item, then lay it out.
+     * @tc.expected: step1. the item is no longer a prediction and it is not recycled.
+     */
+    renderList_->OnPredictLayout(LONG_DEADLINE);
+    ASSERT_EQ(renderList_->predictedItems_.size(), 1u);
+    renderList_->RequestAndLayoutNewItem(START_INDEX + ITEM_COUNT, LayoutParam());
+    EXPECT_TRUE(renderList_->predictedItems_.empty());
+    EXPECT_TRUE(generator_->recycled.empty());
+
+    /**
+     * @tc.steps: step2. predict the next item, then remove all items.
+     * @tc.expected: step2. the predicted item is recycled.
+     */
+    renderList_->OnPredictLayout(LONG_DEADLINE);
+    ASSERT_EQ(renderList_->predictedItems_.count(START_INDEX + ITEM_COUNT + 1), 1u);
+    renderList_->RemoveAllItems();
+    EXPECT_TRUE(renderList_->predictedItems_.empty());
+    EXPECT_EQ(generator_->recycled, std::vector<size_t>({ START_INDEX + ITEM_COUNT + 1 }));
+}
+
+} // namespace OHOS::Ace::V2
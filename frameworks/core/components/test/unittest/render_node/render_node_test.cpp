@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "core/pipeline/base/render_node.h"
+#undef private
+#undef protected
+#include "core/components/test/unittest/mock/mock_render_common.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t PARENT_ID = 0;
+constexpr double PARENT_SIZE = 100.0;
+// Cells of a 4 x 4 grid, enough children for the parent to index them.
+constexpr int32_t CELL_COUNT = 16;
+constexpr int32_t CELL_COLUMNS = 4;
+constexpr double CELL_PITCH = 25.0;
+constexpr double CELL_SIZE = 20.0;
+// Two children overlapping the first cell, the high one is above the low one.
+constexpr int32_t OVERLAP_LOW_ID = CELL_COUNT + 1;
+constexpr int32_t OVERLAP_HIGH_ID = CELL_COUNT + 2;
+const Rect OVERLAP_LOW_RECT = Rect(10.0, 10.0, 40.0, 40.0);
+const Rect OVERLAP_HIGH_RECT = Rect(15.0, 15.0, 20.0, 20.0);
+// Child reaching out of the bottom right corner of the parent.
+constexpr int32_t OUT_OF_BOUNDS_ID = CELL_COUNT + 3;
+const Rect OUT_OF_BOUNDS_RECT = Rect(90.0, 90.0, 40.0, 40.0);
+const Rect MOVED_RECT = Rect(60.0, 60.0, 20.0, 20.0);
+constexpr int32_t ADDED_ID = CELL_COUNT + 4;
+constexpr int32_t TOP_Z_INDEX = 3;
+
+// Records the nodes hit by each kind of hit test in the order they are hit.
+struct HitRecord {
+    std::vector<int32_t> touchHits;
+    std::vector<int32_t> mouseHits;
+};
+
+class MockRenderNode : public RenderNode {
+    DECLARE_ACE_TYPE(MockRenderNode, RenderNode);
+
+public:
+    MockRenderNode(int32_t id, HitRecord& record) : id_(id), record_(record) {}
+    ~MockRenderNode() override = default;
+
+    void Update(const RefPtr<Component>& component) override {}
+    void PerformLayout() override {}
+
+    void OnTouchTestHit(
+        const Offset& coordinateOffset, const TouchRestrict& touchRestrict, TouchTestResult& result) override
+    {
+        record_.touchHits.emplace_back(id_);
+    }
+
+    void OnMouseTestHit(const Offset& coordinateOffset, MouseTestResult& result) override
+    {
+        record_.mouseHits.emplace_back(id_);
+    }
+
+    int32_t GetId() const
+    {
+        return id_;
+    }
+
+private:
+    int32_t id_ = 0;
+    HitRecord& record_;
+};
+
+} // namespace
+
+class RenderNodeTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override;
+    void TearDown() override {}
+
+protected:
+    RefPtr<MockRenderNode> CreateNode(int32_t id, const Rect& rect);
+    // Returns the ids of the nodes hit by TouchTest, MouseTest and MouseDetect, which must all be the same.
+    std::vector<int32_t> HitTest(const Point& point);
+    static std::vector<int32_t> GetIds(const RenderNode::ChildrenSnapshot& children);
+
+    RefPtr<PipelineContext> context_;
+    HitRecord record_;
+    RefPtr<MockRenderNode> parent_;
+    std::vector<RefPtr<MockRenderNode>> children_;
+};
+
+void RenderNodeTest::SetUp()
+{
+    context_ = MockRenderCommon::GetMockContext();
+    record_ = HitRecord();
+    children_.clear();
+    parent_ = CreateNode(PARENT_ID, Rect(0.0, 0.0, PARENT_SIZE, PARENT_SIZE));
+    for (int32_t i = 0; i < CELL_COUNT; ++i) {
+        Rect cellRect((i % CELL_COLUMNS) * CELL_PITCH, (i / CELL_COLUMNS) * CELL_PITCH, CELL_SIZE, CELL_SIZE);
+        children_.emplace_back(CreateNode(i + 1, cellRect));
+    }
+    children_.emplace_back(CreateNode(OVERLAP_LOW_ID, OVERLAP_LOW_RECT));
+    children_.emplace_back(CreateNode(OVERLAP_HIGH_ID, OVERLAP_HIGH_RECT));
+    children_.emplace_back(CreateNode(OUT_OF_BOUNDS_ID, OUT_OF_BOUNDS_RECT));
+    for (const auto& child : children_) {
+        parent_->AddChild(child);
+    }
+    // The overlapping children are added after the first cell, z-index puts the high one above the low one.
+    children_[OVERLAP_HIGH_ID - 1]->SetZIndex(2);
+    children_[OVERLAP_LOW_ID - 1]->SetZIndex(1);
+    // Touch rects of the parent take in the children reaching out of it.
+    parent_->MarkNeedUpdateTouchRect(true);
+}
+
+RefPtr<MockRenderNode> RenderNodeTest::CreateNode(int32_t id, const Rect& rect)
+{
+    auto node = AceType::MakeRefPtr<MockRenderNode>(id, record_);
+    node->Attach(context_);
+    node->SetPaintRect(rect);
+    return node;
+}
+
+std::vector<int32_t> RenderNodeTest::HitTest(const Point& point)
+{
+    record_ = HitRecord();
+    TouchTestResult touchResult;
+    parent_->TouchTest(point, point, TouchRestrict(), touchResult);
+    MouseTestResult mouseResult;
+    parent_->MouseTest(point, point, mouseResult);
+    EXPECT_EQ(record_.mouseHits, record_.touchHits);
+
+    MouseHoverTestList hoverList;
+    WeakPtr<RenderNode> hoverNode;
+    parent_->MouseDetect(point, point, hoverList, hoverNode);
+    std::vector<int32_t> hoverHits;
+    for (const auto& weakNode : hoverList) {
+        auto node = AceType::DynamicCast<MockRenderNode>(weakNode.Upgrade());
+        hoverHits.emplace_back(node ? node->GetId() : -1);
+    }
+    EXPECT_EQ(hoverHits, record_.touchHits);
+    return record_.touchHits;
+}
+
+std::vector<int32_t> RenderNodeTest::GetIds(const RenderNode::ChildrenSnapshot& children)
+{
+    std::vector<int32_t> ids;
+    for (const auto& child : *children) {
+        auto node = AceType::DynamicCast<MockRenderNode>(child);
+        ids.emplace_back(node ? node->GetId() : -1);
+    }
+    return ids;
+}
+
+/**
+ * @tc.name: RenderNodeHitTestGrid001
+ * @tc.desc: Children indexed by the hit test grid are hit in z-order, also when they overlap or reach out of the
+ *           parent.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderNodeTest, RenderNodeHitTestGrid001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. hit a point in the first cell under both overlapping children.
+     * @tc.expected: step1. the children are hit from the top one down, then the parent, the grid is built.
+     */
+    EXPECT_EQ(HitTest(Point(16.0, 16.0)), std::vector<int32_t>({ OVERLAP_HIGH_ID, OVERLAP_LOW_ID, 1, PARENT_ID }));
+    ASSERT_TRUE(parent_->hitTestGrid_);
+    EXPECT_FALSE(parent_->hitTestGridDirty_);
+    EXPECT_EQ(parent_->hitTestGridNodes_.size(), children_.size());
+
+    /**
+     * @tc.steps: step2. hit a point between cells, and a point in a cell only.
+     * @tc.expected: step2. only the children containing the point are hit.
+     */
+    EXPECT_EQ(HitTest(Point(22.0, 22.0)), std::vector<int32_t>({ OVERLAP_HIGH_ID, OVERLAP_LOW_ID, PARENT_ID }));
+    EXPECT_EQ(HitTest(Point(60.0, 60.0)), std::vector<int32_t>({ 11, PARENT_ID }));
+    EXPECT_EQ(HitTest(Point(95.0, 95.0)), std::vector<int32_t>({ OUT_OF_BOUNDS_ID, PARENT_ID }));
+
+    /**
+     * @tc.steps: step3. hit a point out of the parent, in the child reaching out of it, and a point in no child.
+     * @tc.expected: step3. the child is hit, nothing is hit out of all children.
+     */
+    EXPECT_EQ(HitTest(Point(120.0, 120.0)), std::vector<int32_t>({ OUT_OF_BOUNDS_ID, PARENT_ID }));
+    EXPECT_TRUE(HitTest(Point(140.0, 140.0)).empty());
+    EXPECT_FALSE(parent_->hitTestGridDirty_);
+}
+
+/**
+ * @tc.name: RenderNodeHitTestGrid002
+ * @tc.desc: The hit test grid is rebuilt only when the children or their geometry change.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderNodeTest, RenderNodeHitTestGrid002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. hit test twice without changes.
+     * @tc.expected: step1. the grid stays valid.
+     */
+    HitTest(Point(16.0, 16.0));
+    HitTest(Point(16.0, 16.0));
+    EXPECT_FALSE(parent_->hitTestGridDirty_);
+
+    /**
+     * @tc.steps: step2. move the high overlapping child onto another cell.
+     * @tc.expected: step2. the grid is invalidated, the child is hit at its new place only.
+     */
+    auto highChild = children_[OVERLAP_HIGH_ID - 1];
+    highChild->SetPaintRect(MOVED_RECT);
+    EXPECT_TRUE(parent_->hitTestGridDirty_);
+    EXPECT_EQ(HitTest(Point(16.0, 16.0)), std::vector<int32_t>({ OVERLAP_LOW_ID, 1, PARENT_ID }));
+    EXPECT_EQ(HitTest(Point(65.0, 65.0)), std::vector<int32_t>({ OVERLAP_HIGH_ID, 11, PARENT_ID }));
+
+    /**
+     * @tc.steps: step3. put the moved child below the other children.
+     * @tc.expected: step3. the grid is invalidated, the cell is hit first.
+     */
+    highChild->SetZIndex(-1);
+    EXPECT_TRUE(parent_->hitTestGridDirty_);
+    EXPECT_EQ(HitTest(Point(65.0, 65.0)), std::vector<int32_t>({ 11, OVERLAP_HIGH_ID, PARENT_ID }));
+
+    /**
+     * @tc.steps: step4. lay out a child, then remove it.
+     * @tc.expected: step4. the grid is invalidated each time, the removed child is not hit.
+     */
+    auto cell = children_[10];
+    cell->Layout(LayoutParam(Size(CELL_SIZE, CELL_SIZE), Size()));
+    EXPECT_TRUE(parent_->hitTestGridDirty_);
+    HitTest(Point(65.0, 65.0));
+    parent_->RemoveChild(cell);
+    EXPECT_TRUE(parent_->hitTestGridDirty_);
+    EXPECT_EQ(HitTest(Point(65.0, 65.0)), std::vector<int32_t>({ OVERLAP_HIGH_ID, PARENT_ID }));
+}
+
+/**
+ * @tc.name: RenderNodeZIndex001
+ * @tc.desc: Children sorted by zIndex are cached until the children or their zIndex change, lists returned before
+ *           are kept unchanged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderNodeTest, RenderNodeZIndex001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. sort the children twice.
+     * @tc.expected: step1. children with a zIndex come last, the same list is returned.
+     */
+    auto sortedChildren = parent_->GetChildrenSortedByZIndex();
+    ASSERT_TRUE(sortedChildren);
+    auto ids = GetIds(sortedChildren);
+    EXPECT_EQ(ids.front(), 1);
+    ASSERT_EQ(ids.size(), children_.size());
+    EXPECT_EQ(ids[ids.size() - 2], OVERLAP_LOW_ID);
+    EXPECT_EQ(ids.back(), OVERLAP_HIGH_ID);
+    EXPECT_EQ(parent_->GetChildrenSortedByZIndex(), sortedChildren);
+
+    /**
+     * @tc.steps: step2. put the first cell above all other children.
+     * @tc.expected: step2. it comes last in a new list, the former list is unchanged.
+     */
+    children_[0]->SetZIndex(TOP_Z_INDEX);
+    auto raisedChildren = parent_->GetChildrenSortedByZIndex();
+    EXPECT_NE(raisedChildren, sortedChildren);
+    EXPECT_EQ(GetIds(raisedChildren).back(), 1);
+    EXPECT_EQ(GetIds(sortedChildren), ids);
+
+    /**
+     * @tc.steps: step3. add a child without zIndex.
+     * @tc.expected: step3. it comes after the other children without zIndex.
+     */
+    auto added = CreateNode(ADDED_ID, MOVED_RECT);
+    parent_->AddChild(added);
+    auto addedIds = GetIds(parent_->GetChildrenSortedByZIndex());
+    ASSERT_EQ(addedIds.size(), children_.size() + 1);
+    EXPECT_EQ(addedIds[children_.size() - 3], ADDED_ID);
+
+    /**
+     * @tc.steps: step4. move the second cell to the front, then remove it.
+     * @tc.expected: step4. it comes first, then it is gone.
+     */
+    children_[1]->MovePosition(0);
+    EXPECT_EQ(GetIds(parent_->GetChildrenSortedByZIndex()).front(), 2);
+    parent_->RemoveChild(children_[1]);
+    auto removedIds = GetIds(parent_->GetChildrenSortedByZIndex());
+    EXPECT_EQ(removedIds.size(), children_.size());
+    EXPECT_EQ(std::count(removedIds.begin(), removedIds.end(), 2), 0);
+
+    /**
+     * @tc.steps: step5. remove all children while holding a sorted list.
+     * @tc.expected: step5. the list still holds the children, a new list is empty.
+     */
+    auto heldChildren = parent_->GetChildrenSortedByZIndex();
+    parent_->ClearChildren();
+    EXPECT_EQ(GetIds(heldChildren), removedIds);
+    EXPECT_TRUE(parent_->GetChildrenSortedByZIndex()->empty());
+}
+
+} // namespace OHOS::Ace
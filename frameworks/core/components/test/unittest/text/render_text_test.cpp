@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/utils/utils.h"
+#define protected public
+#include "core/components/text/render_text.h"
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr double TEST_MAX_FONT_SIZE = 40.0;
+constexpr double TEST_MIN_FONT_SIZE = 10.0;
+constexpr double TEST_STEP_SIZE = 2.0;
+constexpr double TEST_FINE_STEP_SIZE = 0.1;
+constexpr double TEST_FINE_MIN_FONT_SIZE = 39.7;
+// Bisecting 16 candidates lays out the largest one, at most 4 middle ones and the result.
+constexpr size_t TEST_MAX_LAYOUT_COUNT = 6;
+
+// Lays out by recording the font size, the text fits at font sizes up to fitFontSize.
+class FakeTextLayout {
+public:
+    explicit FakeTextLayout(double fitFontSize) : fitFontSize_(fitFontSize) {}
+    ~FakeTextLayout() = default;
+
+    bool Adapt(double maxFontSize, double minFontSize, double stepSize)
+    {
+        fontSizes_.clear();
+        return RenderText::AdaptFontSizeByStep(
+            maxFontSize, minFontSize, stepSize, [this](double fontSize, bool& isFit) {
+                fontSizes_.emplace_back(fontSize);
+                isFit = LessOrEqual(fontSize, fitFontSize_);
+                return true;
+            });
+    }
+
+    double GetFontSize() const
+    {
+        return fontSizes_.empty() ? 0.0 : fontSizes_.back();
+    }
+
+    size_t GetLayoutCount() const
+    {
+        return fontSizes_.size();
+    }
+
+private:
+    double fitFontSize_ = 0.0;
+    std::vector<double> fontSizes_;
+};
+
+} // namespace
+
+class RenderTextTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: RenderTextAdaptFontSize001
+ * @tc.desc: The text is laid out at the largest font size step at which it fits.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderTextTest, RenderTextAdaptFontSize001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. adapt text which fits at the max font size.
+     * @tc.expected: step1. it is laid out once at the max font size.
+     */
+    FakeTextLayout fitAtMax(TEST_MAX_FONT_SIZE);
+    EXPECT_TRUE(fitAtMax.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, TEST_STEP_SIZE));
+    EXPECT_EQ(fitAtMax.GetLayoutCount(), 1u);
+    EXPECT_DOUBLE_EQ(fitAtMax.GetFontSize(), TEST_MAX_FONT_SIZE);
+
+    /**
+     * @tc.steps: step2. adapt text which fits exactly at a step, and text which fits between two steps.
+     * @tc.expected: step2. it is left laid out at that step, and at the step below, with few layouts.
+     */
+    for (double fitFontSize = TEST_MAX_FONT_SIZE; GreatOrEqual(fitFontSize, TEST_MIN_FONT_SIZE);
+         fitFontSize -= TEST_STEP_SIZE) {
+        FakeTextLayout fitAtStep(fitFontSize);
+        EXPECT_TRUE(fitAtStep.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, TEST_STEP_SIZE));
+        EXPECT_DOUBLE_EQ(fitAtStep.GetFontSize(), fitFontSize);
+        EXPECT_LE(fitAtStep.GetLayoutCount(), TEST_MAX_LAYOUT_COUNT);
+
+        FakeTextLayout fitBetweenSteps(fitFontSize + TEST_STEP_SIZE / 2);
+        EXPECT_TRUE(fitBetweenSteps.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, TEST_STEP_SIZE));
+        EXPECT_DOUBLE_EQ(fitBetweenSteps.GetFontSize(), fitFontSize);
+    }
+}
+
+/**
+ * @tc.name: RenderTextAdaptFontSize002
+ * @tc.desc: The smallest font size step is used when the text never fits, steps stop at the min font size.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderTextTest, RenderTextAdaptFontSize002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. adapt text which fits at no font size.
+     * @tc.expected: step1. it is laid out at the min font size.
+     */
+    FakeTextLayout neverFit(0.0);
+    EXPECT_TRUE(neverFit.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, TEST_STEP_SIZE));
+    EXPECT_DOUBLE_EQ(neverFit.GetFontSize(), TEST_MIN_FONT_SIZE);
+
+    /**
+     * @tc.steps: step2. adapt with a min font size between two steps.
+     * @tc.expected: step2. the smallest step above the min font size is used.
+     */
+    EXPECT_TRUE(neverFit.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE + TEST_STEP_SIZE / 2, TEST_STEP_SIZE));
+    EXPECT_DOUBLE_EQ(neverFit.GetFontSize(), TEST_MIN_FONT_SIZE + TEST_STEP_SIZE);
+
+    /**
+     * @tc.steps: step3. adapt with steps which do not add up exactly to the min font size.
+     * @tc.expected: step3. rounding errors do not drop the min font size.
+     */
+    EXPECT_TRUE(neverFit.Adapt(TEST_MAX_FONT_SIZE, TEST_FINE_MIN_FONT_SIZE, TEST_FINE_STEP_SIZE));
+    EXPECT_NEAR(neverFit.GetFontSize(), TEST_FINE_MIN_FONT_SIZE, TEST_FINE_STEP_SIZE / 2);
+
+    /**
+     * @tc.steps: step4. adapt with a zero step, a negative step, and a max font size less than the min font size.
+     * @tc.expected: step4. the text is only laid out at the min font size.
+     */
+    EXPECT_TRUE(neverFit.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, 0.0));
+    EXPECT_EQ(neverFit.GetLayoutCount(), 1u);
+    EXPECT_DOUBLE_EQ(neverFit.GetFontSize(), TEST_MIN_FONT_SIZE);
+    EXPECT_TRUE(neverFit.Adapt(TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, -TEST_STEP_SIZE));
+    EXPECT_EQ(neverFit.GetLayoutCount(), 1u);
+    EXPECT_DOUBLE_EQ(neverFit.GetFontSize(), TEST_MIN_FONT_SIZE);
+    FakeTextLayout fitAtMax(TEST_MAX_FONT_SIZE);
+    EXPECT_TRUE(fitAtMax.Adapt(TEST_MIN_FONT_SIZE, TEST_MAX_FONT_SIZE, TEST_STEP_SIZE));
+    EXPECT_EQ(fitAtMax.GetLayoutCount(), 1u);
+    EXPECT_DOUBLE_EQ(fitAtMax.GetFontSize(), TEST_MAX_FONT_SIZE);
+
+    /**
+     * @tc.steps: step5. adapt with equal max and min font sizes.
+     * @tc.expected: step5. the text is only laid out at that font size.
+     */
+    EXPECT_TRUE(neverFit.Adapt(TEST_MAX_FONT_SIZE, TEST_MAX_FONT_SIZE, TEST_STEP_SIZE));
+    EXPECT_EQ(neverFit.GetLayoutCount(), 1u);
+    EXPECT_DOUBLE_EQ(neverFit.GetFontSize(), TEST_MAX_FONT_SIZE);
+
+    /**
+     * @tc.steps: step6. fail the layout, within a valid range and with a max font size less than the min font size.
+     * @tc.expected: step6. adapting fails.
+     */
+    EXPECT_FALSE(RenderText::AdaptFontSizeByStep(
+        TEST_MAX_FONT_SIZE, TEST_MIN_FONT_SIZE, TEST_STEP_SIZE, [](double fontSize, bool& isFit) { return false; }));
+    EXPECT_FALSE(RenderText::AdaptFontSizeByStep(
+        TEST_MIN_FONT_SIZE, TEST_MAX_FONT_SIZE, TEST_STEP_SIZE, [](double fontSize, bool& isFit) { return false; }));
+}
+
+} // namespace OHOS::Ace
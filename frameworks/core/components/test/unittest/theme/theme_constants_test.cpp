@@ -608,4 +608,67 @@ HWTEST_F(ThemeConstantsTest, ParseIdStyle001, TestSize.Level1)
     EXPECT_EQ(correctColor.GetValue(), parseColor.GetValue());
 }
 
+
+/**
+ * @tc.name: ParseIdStyle002
+ * @tc.desc: Literal style values are not parsed as theme references.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ParseIdStyle002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Parse literal values and malformed references.
+     * @tc.expected: step1. None of them is a reference.
+     */
+    const std::vector<std::string> values = { "", "100px", "#ff0000", "rgba(0, 0, 0, 0.5)", "id001", "theme:attr",
+        "@", "@id001", "\"@id\"", "\"@id12a\"", "\"@id001", "?theme:", "?THEME:attr", "?theme:attr-color",
+        "@ohos_id_", "@ohos_id_12a", "@ohos_id_99999999999", "@sys.color", "@sys.color.", "@sys.color.abc",
+        "@sys..001", "@app.color.", "@app.color.a-b" };
+    for (const auto& value : values) {
+        auto parseResult = ThemeUtils::ParseThemeIdReference(value, g_themeConstants);
+        EXPECT_FALSE(parseResult.parseSuccess) << value;
+    }
+    EXPECT_FALSE(ThemeUtils::MayBeThemeReference("100px"));
+    EXPECT_FALSE(ThemeUtils::MayBeThemeReference("#ff0000"));
+    EXPECT_TRUE(ThemeUtils::MayBeThemeReference("@ohos_id_500"));
+}
+
+/**
+ * @tc.name: ParseIdStyle003
+ * @tc.desc: Each theme reference format is parsed to its id or attribute.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ParseIdStyle003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Parse id references, prefixes are case insensitive.
+     * @tc.expected: step1. Ids are parsed, system resource ids are offset.
+     */
+    const std::vector<std::pair<std::string, uint32_t>> idValues = { { "\"@id001\"", 1 }, { "\"@ID42\"", 42 },
+        { "@ohos_id_500", 500 + 0x7000000 }, { "@OHOS_ID_500", 500 + 0x7000000 },
+        { "@sys.color.12", 12 + 0x7000000 }, { "@Sys.float.0", 0x7000000 } };
+    for (const auto& [value, id] : idValues) {
+        auto parseResult = ThemeUtils::ParseThemeIdReference(value);
+        EXPECT_TRUE(parseResult.parseSuccess) << value;
+        EXPECT_TRUE(parseResult.isIdRef) << value;
+        EXPECT_EQ(parseResult.id, id) << value;
+    }
+
+    /**
+     * @tc.steps: step2. Parse attribute references.
+     * @tc.expected: step2. Attribute name is parsed.
+     */
+    auto parseResult = ThemeUtils::ParseThemeIdReference(TEXT_SIZE_VALUE);
+    EXPECT_TRUE(parseResult.parseSuccess);
+    EXPECT_FALSE(parseResult.isIdRef);
+    EXPECT_EQ(parseResult.refAttr, "textSizeButton1");
+
+    /**
+     * @tc.steps: step3. Parse application resource references without theme constants.
+     * @tc.expected: step3. They can't be resolved.
+     */
+    parseResult = ThemeUtils::ParseThemeIdReference("@app.color.name");
+    EXPECT_FALSE(parseResult.parseSuccess);
+}
+
 } // namespace OHOS::Ace
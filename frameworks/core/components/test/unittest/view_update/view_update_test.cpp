@@ -24,6 +24,7 @@
 #include "core/components/text/text_component.h"
 #include "core/pipeline/base/composed_component.h"
 #include "core/pipeline/base/composed_element.h"
+#include "core/pipeline/base/multi_composed_component.h"
 
 #include "core/components/test/json/json_frontend.h"
 
@@ -71,6 +72,12 @@ public:
     static void DumpRenderTree(const RefPtr<RenderNode>& renderNode, int32_t depth, vector<NodeInfo>& treeInfo);
     static void PrintTreeInfo(const vector<NodeInfo>& treeInfo);
     static bool IsTreeEqual(const vector<NodeInfo>& treeInfoA, const vector<NodeInfo>& treeInfoB);
+    static RefPtr<Component> CreateKeyedText(const string& text);
+    static RefPtr<Component> CreateKeyedRow(const list<RefPtr<Component>>& children);
+
+    void UpdateKeyedRow(const list<RefPtr<Component>>& children);
+    vector<string> GetRowTextData() const;
+    vector<string> GetRowChildIds() const;
 
 private:
     RefPtr<ComposedElement> composedElement_;
@@ -174,6 +181,56 @@ bool ViewUpdateTest::IsTreeEqual(const vector<NodeInfo>& treeInfoA, const vector
     return true;
 }
 
+RefPtr<Component> ViewUpdateTest::CreateKeyedText(const string& text)
+{
+    return AceType::MakeRefPtr<ComposedComponent>(text, text, AceType::MakeRefPtr<TextComponent>(text));
+}
+
+RefPtr<Component> ViewUpdateTest::CreateKeyedRow(const list<RefPtr<Component>>& children)
+{
+    return AceType::MakeRefPtr<RowComponent>(FlexAlign::CENTER, FlexAlign::CENTER, children);
+}
+
+void ViewUpdateTest::UpdateKeyedRow(const list<RefPtr<Component>>& children)
+{
+    newComposedComponent_ =
+        AceType::MakeRefPtr<ComposedComponent>(ROOT_COMPOSE_ID, ROOT_COMPOSE_NAME, CreateKeyedRow(children));
+    composedElement_->SetNewComponent(newComposedComponent_);
+    composedElement_->Rebuild();
+}
+
+vector<string> ViewUpdateTest::GetRowTextData() const
+{
+    vector<string> textData;
+    if (rootRender_->GetChildren().empty()) {
+        return textData;
+    }
+    for (const auto& child : rootRender_->GetChildren().front()->GetChildren()) {
+        auto renderText = AceType::DynamicCast<RenderText>(child);
+        textData.emplace_back(renderText ? renderText->GetTextData() : "");
+    }
+    return textData;
+}
+
+vector<string> ViewUpdateTest::GetRowChildIds() const
+{
+    vector<string> ids;
+    if (composedElement_->GetChildren().empty()) {
+        return ids;
+    }
+    int32_t slot = 0;
+    int32_t renderSlot = 0;
+    for (const auto& child : composedElement_->GetChildren().front()->GetChildren()) {
+        // Slots recorded on the children must follow their order.
+        EXPECT_EQ(child->GetSlot(), slot++);
+        EXPECT_EQ(child->GetRenderSlot(), renderSlot);
+        renderSlot += child->CountRenderNode();
+        auto composed = AceType::DynamicCast<ComposedElement>(child);
+        ids.emplace_back(composed ? composed->GetId() : "");
+    }
+    return ids;
+}
+
 void ViewUpdateTest::BuildEmptyTrees()
 {
     newElementTree_.clear();
@@ -774,4 +831,101 @@ HWTEST_F(ViewUpdateTest, ViewUpdateTest013, TestSize.Level1)
     UpdateAndValidate();
 }
 
+
+/**
+ * @tc.name: ViewUpdateTest014
+ * @tc.desc: Keyed children moving forward are reused and moved in place.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewUpdateTest, ViewUpdateTest014, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a Row with keyed children a | b | c | d.
+     * @tc.expected: step1. Texts are in the order of the children.
+     */
+    UpdateKeyedRow({ CreateKeyedText("a"), CreateKeyedText("b"), CreateKeyedText("c"), CreateKeyedText("d") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "a", "b", "c", "d" }));
+    EXPECT_EQ(GetRowChildIds(), vector<string>({ "a", "b", "c", "d" }));
+    auto renderA = rootRender_->GetChildren().front()->GetChildren().front();
+
+    /**
+     * @tc.steps: step2. Move a in front of d.
+     * @tc.expected: step2. Elements, slots and render nodes follow the new order, the render node of a is reused.
+     */
+    UpdateKeyedRow({ CreateKeyedText("b"), CreateKeyedText("c"), CreateKeyedText("a"), CreateKeyedText("d") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "b", "c", "a", "d" }));
+    EXPECT_EQ(GetRowChildIds(), vector<string>({ "b", "c", "a", "d" }));
+    auto rowChildren = rootRender_->GetChildren().front()->GetChildren();
+    EXPECT_EQ(*std::next(rowChildren.begin(), 2), renderA);
+}
+
+/**
+ * @tc.name: ViewUpdateTest015
+ * @tc.desc: Keyed children moving backward are reused and moved in place.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewUpdateTest, ViewUpdateTest015, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a Row with keyed children a | b | c.
+     * @tc.expected: step1. Texts are in the order of the children.
+     */
+    UpdateKeyedRow({ CreateKeyedText("a"), CreateKeyedText("b"), CreateKeyedText("c") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "a", "b", "c" }));
+    auto renderC = rootRender_->GetChildren().front()->GetChildren().back();
+
+    /**
+     * @tc.steps: step2. Move c to the front.
+     * @tc.expected: step2. Elements, slots and render nodes follow the new order, the render node of c is reused.
+     */
+    UpdateKeyedRow({ CreateKeyedText("c"), CreateKeyedText("a"), CreateKeyedText("b") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "c", "a", "b" }));
+    EXPECT_EQ(GetRowChildIds(), vector<string>({ "c", "a", "b" }));
+    EXPECT_EQ(rootRender_->GetChildren().front()->GetChildren().front(), renderC);
+
+    /**
+     * @tc.steps: step3. Remove a and insert e at the back.
+     * @tc.expected: step3. Elements, slots and render nodes follow the new order.
+     */
+    UpdateKeyedRow({ CreateKeyedText("b"), CreateKeyedText("c"), CreateKeyedText("e") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "b", "c", "e" }));
+    EXPECT_EQ(GetRowChildIds(), vector<string>({ "b", "c", "e" }));
+}
+
+/**
+ * @tc.name: ViewUpdateTest016
+ * @tc.desc: A keyed child with several render nodes keeps their order when moved.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ViewUpdateTest, ViewUpdateTest016, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a Row with keyed children a | b | c | d, a has two texts a1 and a2.
+     * @tc.expected: step1. Texts are in the order of the children.
+     */
+    auto createMultiText = []() -> RefPtr<Component> {
+        list<RefPtr<Component>> texts { AceType::MakeRefPtr<TextComponent>("a1"),
+            AceType::MakeRefPtr<TextComponent>("a2") };
+        return AceType::MakeRefPtr<MultiComposedComponent>("a", "a", texts);
+    };
+    UpdateKeyedRow({ createMultiText(), CreateKeyedText("b"), CreateKeyedText("c"), CreateKeyedText("d") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "a1", "a2", "b", "c", "d" }));
+
+    /**
+     * @tc.steps: step2. Move a in front of d.
+     * @tc.expected: step2. Render nodes of a are moved as one block.
+     */
+    UpdateKeyedRow({ CreateKeyedText("b"), CreateKeyedText("c"), createMultiText(), CreateKeyedText("d") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "b", "c", "a1", "a2", "d" }));
+    EXPECT_EQ(GetRowChildIds(), vector<string>({ "b", "c", "a", "d" }));
+
+    /**
+     * @tc.steps: step3. Move a back to the front.
+     * @tc.expected: step3. Render nodes of a are moved as one block.
+     */
+    UpdateKeyedRow({ createMultiText(), CreateKeyedText("b"), CreateKeyedText("c"), CreateKeyedText("d") });
+    EXPECT_EQ(GetRowTextData(), vector<string>({ "a1", "a2", "b", "c", "d" }));
+    EXPECT_EQ(GetRowChildIds(), vector<string>({ "a", "b", "c", "d" }));
+}
+
 } // namespace OHOS::Ace
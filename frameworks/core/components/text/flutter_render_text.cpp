@@ -289,18 +289,15 @@ bool FlutterRenderText::AdaptMinTextSize(double paragraphMaxWidth)
     if (GreatNotEqual(textStyle_.GetAdaptFontSizeStep().Value(), 0.0)) {
         step = textStyle_.GetAdaptFontSizeStep();
     }
-    double stepSize = NormalizeToPx(step);
-    while (GreatOrEqual(maxFontSize, minFontSize)) {
-        textStyle_.SetFontSize(Dimension(maxFontSize));
-        if (!UpdateParagraphAndLayout(paragraphMaxWidth)) {
-            return false;
-        }
-        if (!DidExceedMaxLines(paragraphMaxWidth)) {
-            break;
-        }
-        maxFontSize -= stepSize;
-    }
-    return true;
+    return AdaptFontSizeByStep(maxFontSize, minFontSize, NormalizeToPx(step),
+        [this, paragraphMaxWidth](double fontSize, bool& isFit) {
+            textStyle_.SetFontSize(Dimension(fontSize));
+            if (!UpdateParagraphAndLayout(paragraphMaxWidth)) {
+                return false;
+            }
+            isFit = !DidExceedMaxLines(paragraphMaxWidth);
+            return true;
+        });
 }
 
 bool FlutterRenderText::AdaptPreferTextSize(double paragraphMaxWidth)
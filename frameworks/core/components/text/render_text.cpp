@@ -15,6 +15,8 @@
 
 #include "core/components/text/render_text.h"
 
+#include <cmath>
+
 #include "base/geometry/size.h"
 #include "base/log/dump_log.h"
 #include "core/common/font_manager.h"
@@ -23,6 +25,12 @@
 #include "core/event/ace_event_helper.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// Tolerance of rounding when counting font size steps between the max and min font size.
+constexpr double ADAPT_STEP_TOLERANCE = 0.001;
+
+} // namespace
 
 RenderText::~RenderText()
 {
@@ -473,6 +481,45 @@ void RenderText::SetTextData(const std::string& textData)
     }
 }
 
+bool RenderText::AdaptFontSizeByStep(double maxFontSize, double minFontSize, double stepSize,
+    const std::function<bool(double fontSize, bool& isFit)>& layoutFunc)
+{
+    bool isFit = false;
+    if (LessNotEqual(maxFontSize, minFontSize) || LessOrEqual(stepSize, 0.0)) {
+        // No range to adapt in, lay out at the min font size as the caller does for an invalid range.
+        return layoutFunc(minFontSize, isFit);
+    }
+    // Candidates are maxFontSize - index * stepSize for index in [0, lastIndex]. A smaller font never needs more
+    // lines, so bisect for the largest candidate which fits, instead of laying out every candidate from the largest.
+    auto lastIndex = static_cast<int32_t>(std::floor((maxFontSize - minFontSize) / stepSize + ADAPT_STEP_TOLERANCE));
+    auto layoutWithIndex = [maxFontSize, stepSize, &layoutFunc, &isFit](int32_t index) {
+        return layoutFunc(maxFontSize - index * stepSize, isFit);
+    };
+    if (!layoutWithIndex(0)) {
+        return false;
+    }
+    if (isFit || lastIndex == 0) {
+        return true;
+    }
+    // Candidate at low does not fit, candidate at high fits or is the smallest one.
+    int32_t low = 0;
+    int32_t high = lastIndex;
+    int32_t laidOutIndex = 0;
+    while (high - low > 1) {
+        int32_t middle = low + (high - low) / 2;
+        if (!layoutWithIndex(middle)) {
+            return false;
+        }
+        laidOutIndex = middle;
+        if (isFit) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+    return laidOutIndex == high || layoutWithIndex(high);
+}
+
 void RenderText::ClearRenderObject()
 {
     RenderNode::ClearRenderObject();
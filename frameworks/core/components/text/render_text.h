@@ -117,6 +117,14 @@ protected:
 
     void CheckIfNeedMeasure();
     void ClearRenderObject() override;
+
+    // Lays out the text at the largest of maxFontSize, maxFontSize - stepSize, ... down to minFontSize at which the
+    // text fits, or at the smallest of them when it never fits. layoutFunc lays out at a font size in px, sets whether
+    // the text fits and returns false when the layout fails. When maxFontSize is less than minFontSize or stepSize is
+    // not positive, the text is laid out at minFontSize only.
+    static bool AdaptFontSizeByStep(double maxFontSize, double minFontSize, double stepSize,
+        const std::function<bool(double fontSize, bool& isFit)>& layoutFunc);
+
     TextStyle textStyle_;
     TextDirection textDirection_ = TextDirection::LTR;
     Color focusColor_;
@@ -15,8 +15,10 @@
 
 #include "core/components/theme/theme_utils.h"
 
+#include <cctype>
+#include <climits>
 #include <cmath>
-#include <regex>
+#include <cstdint>
 #include <set>
 
 #include "base/log/log.h"
@@ -28,27 +30,87 @@
 namespace OHOS::Ace {
 namespace {
 
-constexpr uint32_t THEME_ID_MIN_SIZE = 5; // Input should contain "@id"
-constexpr uint32_t THEME_ID_MATCH_SIZE = 2;
-const std::regex THEME_ID_REGEX(R"(^\"@id([0-9]+)\"$)", std::regex::icase); // regex for "@id001"
-constexpr uint32_t THEME_ATTR_MIN_SIZE = 7;
-const std::regex THEME_ATTR_REGEX(R"(\?theme:([a-zA-Z0-9_]+))"); // regex for "?theme:attr_color_emphasis"
+// References are matched by hand, the formats are:
+// "\"@id001\"", "?theme:attr_color_emphasis", "@ohos_id_001", "@sys.type.001", "@app.type.name",
+// "@sys.media.001" and "@app.media.name". Prefixes except "?theme:" are case insensitive.
+constexpr char THEME_ID_PREFIX[] = "\"@id";
+constexpr char THEME_ATTR_PREFIX[] = "?theme:";
+constexpr char OHOS_ID_PREFIX[] = "@ohos_id_";
+constexpr char SYS_RES_PREFIX[] = "@sys.";
+constexpr char APP_RES_PREFIX[] = "@app.";
+constexpr char MEDIA_TYPE[] = "media";
 constexpr uint32_t CUSTOM_STYLE_STRING_MAX_SIZE = 128;
-constexpr uint32_t OHOS_ID_MIN_SIZE = 7; // Input should contain "@ohos_id"
 constexpr uint32_t SYSTEM_RES_ID_START = 0x7000000;
-const std::regex OHOS_ID_REGEX(R"(^@ohos_id_([0-9]+)$)", std::regex::icase); // regex for "@ohos_id_001"
-// regex for "@sys.type.xxx", xxx represents system resource id.
-const std::regex SYS_TYPE_RES_ID_REGEX(R"(^@sys.(\w+).([0-9]+)$)", std::regex::icase);
-constexpr uint32_t SYS_TYPE_RES_ID_MIN_SIZE = 7;
-// regex for "@app.type.xxx", xxx represents application name.
-const std::regex APP_TYPE_RES_NAME_REGEX(R"(^@app.(\w+).(\w+)$)", std::regex::icase);
-constexpr uint32_t APP_TYPE_RES_NAME_MIN_SIZE = 7;
-constexpr uint32_t TYPE_RESOURCE_MATCH_SIZE = 3;
-// regex for "@sys.media.xxx", xxx represents system resource id.
-const std::regex SYS_MEDIA_RES_ID_REGEX(R"(^@sys\.media\.([0-9]+)$)", std::regex::icase);
-// regex for "@app.media.xxx", xxx represents resource name.
-const std::regex APP_MEDIA_RES_NAME_REGEX(R"(^@app\.media\.(\w+)$)", std::regex::icase);
-constexpr uint32_t MEDIA_RESOURCE_MATCH_SIZE = 2;
+
+bool StartsWith(const std::string& str, const char* prefix, size_t prefixLen, bool ignoreCase)
+{
+    if (str.size() < prefixLen) {
+        return false;
+    }
+    for (size_t i = 0; i < prefixLen; ++i) {
+        if (ignoreCase ? std::tolower(static_cast<unsigned char>(str[i])) != prefix[i] : str[i] != prefix[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsWordChar(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// Matches [a-zA-Z0-9_]+ in [begin, end).
+bool IsWord(const std::string& str, size_t begin, size_t end)
+{
+    if (begin >= end || end > str.size()) {
+        return false;
+    }
+    for (size_t i = begin; i < end; ++i) {
+        if (!IsWordChar(str[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Matches [0-9]+ in [begin, end), platform style id is no more than 32 bit.
+bool ParseId(const std::string& str, size_t begin, size_t end, uint32_t& id)
+{
+    if (begin >= end || end > str.size()) {
+        return false;
+    }
+    uint64_t value = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (!std::isdigit(static_cast<unsigned char>(str[i]))) {
+            return false;
+        }
+        value = value * 10 + static_cast<uint64_t>(str[i] - '0');
+        if (value > UINT32_MAX) {
+            return false;
+        }
+    }
+    id = static_cast<uint32_t>(value);
+    return true;
+}
+
+bool IsMediaType(const std::string& type)
+{
+    constexpr size_t mediaTypeLen = sizeof(MEDIA_TYPE) - 1;
+    return type.size() == mediaTypeLen && StartsWith(type, MEDIA_TYPE, mediaTypeLen, true);
+}
+
+// Splits "@sys.type.value" or "@app.type.value" after the prefix into type and the position of value.
+bool SplitTypeResource(const std::string& str, size_t prefixLen, std::string& type, size_t& valuePos)
+{
+    auto dotPos = str.find('.', prefixLen);
+    if (dotPos == std::string::npos || !IsWord(str, prefixLen, dotPos)) {
+        return false;
+    }
+    type = str.substr(prefixLen, dotPos - prefixLen);
+    valuePos = dotPos + 1;
+    return true;
+}
 
 const std::set<uint32_t> FONT_WEIGHT_STYLE_ID = {
     THEME_BUTTON_TEXT_FONTWEIGHT,
@@ -62,42 +124,48 @@ const std::set<uint32_t> FONT_WEIGHT_STYLE_ID = {
 
 IdParseResult ThemeUtils::ParseThemeIdReference(const std::string& str, const RefPtr<ThemeConstants>& themeConstants)
 {
-    std::smatch matches;
     IdParseResult result { .parseSuccess = false, .isIdRef = false, .id = 0, .refAttr = "" };
-    if (str.size() > THEME_ID_MIN_SIZE && std::regex_match(str, matches, THEME_ID_REGEX) &&
-        matches.size() == THEME_ID_MATCH_SIZE) {
-        // Platform style id is no more than 32 bit.
-        result.id = static_cast<uint32_t>(std::stoul(matches[1].str()));
+    if (!MayBeThemeReference(str)) {
+        return result;
+    }
+    uint32_t id = 0;
+    constexpr size_t themeIdPrefixLen = sizeof(THEME_ID_PREFIX) - 1;
+    if (StartsWith(str, THEME_ID_PREFIX, themeIdPrefixLen, true) && str.back() == '"' &&
+        ParseId(str, themeIdPrefixLen, str.size() - 1, id)) {
+        result.id = id;
         result.parseSuccess = true;
         result.isIdRef = true;
         return result;
     }
-    if (str.size() > THEME_ATTR_MIN_SIZE && std::regex_match(str, matches, THEME_ATTR_REGEX) &&
-        matches.size() == THEME_ID_MATCH_SIZE) {
-        result.refAttr = matches[1].str();
+    constexpr size_t themeAttrPrefixLen = sizeof(THEME_ATTR_PREFIX) - 1;
+    if (StartsWith(str, THEME_ATTR_PREFIX, themeAttrPrefixLen, false) && IsWord(str, themeAttrPrefixLen, str.size())) {
+        result.refAttr = str.substr(themeAttrPrefixLen);
         result.parseSuccess = true;
         result.isIdRef = false;
         return result;
     }
-    if (str.size() > OHOS_ID_MIN_SIZE && std::regex_match(str, matches, OHOS_ID_REGEX) &&
-        matches.size() == THEME_ID_MATCH_SIZE) {
-        // Platform style id is no more than 32 bit.
-        result.id = static_cast<uint32_t>(std::stoul(matches[1].str())) + SYSTEM_RES_ID_START;
+    constexpr size_t ohosIdPrefixLen = sizeof(OHOS_ID_PREFIX) - 1;
+    if (StartsWith(str, OHOS_ID_PREFIX, ohosIdPrefixLen, true) && ParseId(str, ohosIdPrefixLen, str.size(), id)) {
+        result.id = id + SYSTEM_RES_ID_START;
         result.parseSuccess = true;
         result.isIdRef = true;
         return result;
     }
-    if (str.size() > SYS_TYPE_RES_ID_MIN_SIZE && std::regex_match(str, matches, SYS_TYPE_RES_ID_REGEX) &&
-        matches.size() == TYPE_RESOURCE_MATCH_SIZE) {
-        result.id = static_cast<uint32_t>(std::stoul(matches[2].str())) + SYSTEM_RES_ID_START;
+    std::string type;
+    size_t valuePos = 0;
+    constexpr size_t sysResPrefixLen = sizeof(SYS_RES_PREFIX) - 1;
+    if (StartsWith(str, SYS_RES_PREFIX, sysResPrefixLen, true) &&
+        SplitTypeResource(str, sysResPrefixLen, type, valuePos) && ParseId(str, valuePos, str.size(), id)) {
+        result.id = id + SYSTEM_RES_ID_START;
         result.parseSuccess = true;
         result.isIdRef = true;
         return result;
     }
-    if (str.size() > APP_TYPE_RES_NAME_MIN_SIZE && std::regex_match(str, matches, APP_TYPE_RES_NAME_REGEX) &&
-        matches.size() == TYPE_RESOURCE_MATCH_SIZE) {
+    constexpr size_t appResPrefixLen = sizeof(APP_RES_PREFIX) - 1;
+    if (StartsWith(str, APP_RES_PREFIX, appResPrefixLen, true) &&
+        SplitTypeResource(str, appResPrefixLen, type, valuePos) && IsWord(str, valuePos, str.size())) {
         uint32_t resId = 0;
-        if (themeConstants && themeConstants->GetResourceIdByName(matches[2].str(), matches[1].str(), resId)) {
+        if (themeConstants && themeConstants->GetResourceIdByName(str.substr(valuePos), type, resId)) {
             result.id = resId;
             result.parseSuccess = true;
             result.isIdRef = true;
@@ -146,14 +214,20 @@ ResValueWrapper ThemeUtils::ParseStyleValue(
 
 std::string ThemeUtils::ProcessImageSource(const std::string& imageSrc, const RefPtr<ThemeConstants>& themeConstants)
 {
-    std::smatch matches;
     uint32_t resId = 0;
     std::string resName;
-    if (std::regex_match(imageSrc, matches, APP_MEDIA_RES_NAME_REGEX) && matches.size() == MEDIA_RESOURCE_MATCH_SIZE) {
-        resName = matches[1].str();
-    }
-    if (std::regex_match(imageSrc, matches, SYS_MEDIA_RES_ID_REGEX) && matches.size() == MEDIA_RESOURCE_MATCH_SIZE) {
-        resId = static_cast<uint32_t>(std::stoul(matches[1].str())) + SYSTEM_RES_ID_START;
+    std::string type;
+    size_t valuePos = 0;
+    constexpr size_t sysResPrefixLen = sizeof(SYS_RES_PREFIX) - 1;
+    constexpr size_t appResPrefixLen = sizeof(APP_RES_PREFIX) - 1;
+    if (StartsWith(imageSrc, SYS_RES_PREFIX, sysResPrefixLen, true) &&
+        SplitTypeResource(imageSrc, sysResPrefixLen, type, valuePos) && IsMediaType(type) &&
+        ParseId(imageSrc, valuePos, imageSrc.size(), resId)) {
+        resId += SYSTEM_RES_ID_START;
+    } else if (StartsWith(imageSrc, APP_RES_PREFIX, appResPrefixLen, true) &&
+        SplitTypeResource(imageSrc, appResPrefixLen, type, valuePos) && IsMediaType(type) &&
+        IsWord(imageSrc, valuePos, imageSrc.size())) {
+        resName = imageSrc.substr(valuePos);
     }
     // not a image from global global resource manager subsystem, no need process.
     if (resId == 0 && resName.empty()) {
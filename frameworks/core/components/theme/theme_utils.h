@@ -42,6 +42,13 @@ public:
     static IdParseResult ParseThemeIdReference(const std::string& str,
         const RefPtr<ThemeConstants>& themeConstants = nullptr);
 
+    // Every reference format starts with '@', '?' or a quote ("@id001"), any other string is a literal value and
+    // can be parsed directly without matching the reference patterns or looking up theme constants.
+    static bool MayBeThemeReference(const std::string& str)
+    {
+        return !str.empty() && (str[0] == '@' || str[0] == '?' || str[0] == '"');
+    }
+
     static ResValueWrapper ParseStyleValue(
         uint32_t styleId, const ResValueWrapper& model, const std::string& value);
 
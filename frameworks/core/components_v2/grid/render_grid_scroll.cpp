@@ -809,6 +809,7 @@ void RenderGridScroll::PerformLayout()
     CalculateViewPort();
     showItem_.clear();
     childrenInRect_.clear();
+    MarkChildrenZIndexDirty();
     double drawLength = 0.0 - firstItemOffset_;
     int32_t main = startIndex_ > 0 ? startIndex_ - 1 : startIndex_;
     LOGD("startIndex_=[%d], firstItemOffset_=[%lf]", startIndex_, firstItemOffset_);
@@ -918,6 +919,7 @@ void RenderGridScroll::ClearLayout(bool needReservedPlace)
     }
     showItem_.clear();
     childrenInRect_.clear();
+    MarkChildrenZIndexDirty();
     inCache_.clear();
 
     updateFlag_ = true;
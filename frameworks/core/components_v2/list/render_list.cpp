@@ -15,8 +15,10 @@
 
 #include "core/components_v2/list/render_list.h"
 
+#include "base/log/ace_trace.h"
 #include "base/log/log.h"
 #include "base/utils/string_utils.h"
+#include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 #include "core/animation/bilateral_spring_node.h"
 #include "core/components/scroll/render_scroll.h"
@@ -51,6 +53,11 @@ constexpr bool DIR_REVERSE = true;
 constexpr int32_t STEP_FORWARD = 1;
 constexpr int32_t STEP_BACK = -1;
 constexpr int32_t STEP_INVALID = 10;
+constexpr int64_t PREDICT_TIME_THRESHOLD = 3 * 1000000; // Stop predicting 3 milliseconds before the next vsync.
+constexpr int64_t MICROSEC_TO_NANOSEC = 1000;
+constexpr double PREDICT_DURATION = 0.2; // Predict the items which come into view within 0.2 second.
+constexpr size_t MIN_PREDICT_ITEM_COUNT = 1;
+constexpr size_t MAX_PREDICT_ITEM_COUNT = 8;
 
 // IsRightToLeft | IsListVertical | IsDirectionVertical | IsDirectionReverse
 const std::map<bool, std::map<bool, std::map<bool, std::map<bool, int32_t>>>> DIRECTION_MAP = {
@@ -559,7 +566,9 @@ bool RenderList::UpdateScrollPosition(double offset, int32_t source)
             ScrollState(SCROLL_STATE_FLING));
     }
     currentOffset_ += offset;
+    scrollForward_ = offset < 0.0;
     MarkNeedLayout(true);
+    MarkNeedPredictLayout();
     return true;
 }
 
@@ -726,6 +735,7 @@ RefPtr<RenderListItem> RenderList::RequestAndLayoutNewItem(size_t index, const L
         newChild = currentStickyItem_;
     } else {
         newChild = RequestListItem(index);
+        predictedItems_.erase(index);
         if (newChild) {
             AddChild(newChild);
             newChild->Layout(layoutParam);
@@ -784,6 +794,84 @@ void RenderList::RecycleListItem(size_t index)
     }
 }
 
+void RenderList::OnPredictLayout(int64_t deadline)
+{
+    auto startTime = GetSysTimestamp(); // unit: ns
+    auto context = context_.Upgrade();
+    if (!context || items_.empty()) {
+        return;
+    }
+    if (!context->IsTransitionStop()) {
+        LOGD("In page transition, skip predict.");
+        return;
+    }
+    ReleasePredictedItems(false);
+    size_t endIndex = startIndex_ + items_.size();
+    size_t totalCount = TotalCount();
+    size_t predictCount = GetPredictItemCount();
+    for (size_t i = 0; i < predictCount; ++i) {
+        size_t index = 0;
+        if (scrollForward_) {
+            index = endIndex + i;
+            if (index >= totalCount) {
+                break;
+            }
+        } else {
+            if (startIndex_ <= i) {
+                break;
+            }
+            index = startIndex_ - i - 1;
+        }
+        if (predictedItems_.find(index) != predictedItems_.end() || index == currentStickyIndex_ ||
+            index == selectedItemIndex_) {
+            continue;
+        }
+        // Building an item may take longer than a frame, leave the rest to the next idle time.
+        if (GetSysTimestamp() - startTime + PREDICT_TIME_THRESHOLD > deadline * MICROSEC_TO_NANOSEC) {
+            MarkNeedPredictLayout();
+            return;
+        }
+        ACE_SCOPED_TRACE("OnPredictLayout %zu", index);
+        if (!RequestListItem(index)) {
+            break;
+        }
+        predictedItems_.emplace(index);
+    }
+}
+
+size_t RenderList::GetPredictItemCount() const
+{
+    double velocity = scrollable_ ? std::abs(scrollable_->GetCurrentVelocity()) : 0.0;
+    double averageItemSize = items_.empty() ? 0.0 : realMainSize_ / items_.size();
+    if (NearZero(velocity) || LessOrEqual(averageItemSize, 0.0)) {
+        return MIN_PREDICT_ITEM_COUNT;
+    }
+    auto count = static_cast<size_t>(std::ceil(velocity * PREDICT_DURATION / averageItemSize));
+    return std::clamp(count, MIN_PREDICT_ITEM_COUNT, MAX_PREDICT_ITEM_COUNT);
+}
+
+void RenderList::ReleasePredictedItems(bool releaseAll)
+{
+    size_t endIndex = startIndex_ + items_.size();
+    for (auto iter = predictedItems_.begin(); iter != predictedItems_.end();) {
+        size_t index = *iter;
+        if ((index >= startIndex_ && index < endIndex) || index == currentStickyIndex_ ||
+            index == selectedItemIndex_) {
+            // Taken by the layout, it is recycled as other items from now on.
+            iter = predictedItems_.erase(iter);
+            continue;
+        }
+        bool isAhead = scrollForward_ ? (index >= endIndex && index - endIndex < MAX_PREDICT_ITEM_COUNT)
+                                      : (index < startIndex_ && startIndex_ - index <= MAX_PREDICT_ITEM_COUNT);
+        if (releaseAll || !isAhead) {
+            RecycleListItem(index);
+            iter = predictedItems_.erase(iter);
+            continue;
+        }
+        ++iter;
+    }
+}
+
 size_t RenderList::TotalCount()
 {
     auto generator = itemGenerator_.Upgrade();
@@ -836,6 +924,8 @@ size_t RenderList::GetIndexByListItem(const RefPtr<RenderListItem>& item) const
 
 void RenderList::RemoveAllItems()
 {
+    // Predicted items are not children of the list, they are recycled through the generator.
+    ReleasePredictedItems(true);
     items_.clear();
     ClearChildren();
     currentStickyItem_.Reset();
@@ -854,6 +944,7 @@ void RenderList::ApplyPreviousStickyListItem(size_t index, bool needLayout, cons
 
     currentStickyIndex_ = newIndex;
     currentStickyItem_ = RequestListItem(currentStickyIndex_);
+    predictedItems_.erase(currentStickyIndex_);
     if (currentStickyIndex_ < startIndex_) {
         AddChild(currentStickyItem_);
         if (needLayout) {
@@ -19,6 +19,7 @@
 #include <functional>
 #include <limits>
 #include <list>
+#include <set>
 
 #include "core/animation/bilateral_spring_adapter.h"
 #include "core/animation/simple_spring_chain.h"
@@ -60,6 +61,8 @@ public:
 
     void OnPaintFinish() override;
 
+    void OnPredictLayout(int64_t deadline) override;
+
     bool IsUseOnly() override;
 
     template<class T>
@@ -368,6 +371,13 @@ private:
     size_t endCachedCount_ = 0;
     size_t cachedCount_ = 0;
 
+    size_t GetPredictItemCount() const;
+    void ReleasePredictedItems(bool releaseAll);
+    // Indexes of items built in idle time ahead of the scrolling direction, they are attached and laid out only when
+    // they come into the layout range, and released when the list scrolls the other way.
+    std::set<size_t> predictedItems_;
+    bool scrollForward_ = true;
+
     void CreateDragDropRecognizer();
     RefPtr<RenderListItem> FindCurrentListItem(const Point& point);
 
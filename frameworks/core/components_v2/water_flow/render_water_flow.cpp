@@ -188,6 +188,7 @@ void RenderWaterFlow::PerformLayout()
     CaculateViewPort();
     showItem_.clear();
     childrenInRect_.clear();
+    MarkChildrenZIndexDirty();
     double drawLength = 0.0 - firstItemOffset_;
     int32_t main = startIndex_ > 0 ? startIndex_ - 1 : startIndex_;
     LOGD("PerformLayout. main: %{public}d. start", main);
@@ -1058,6 +1059,7 @@ void RenderWaterFlow::ClearLayout(int32_t index)
     currentOffset_ = 0.0;
     showItem_.clear();
     childrenInRect_.clear();
+    MarkChildrenZIndexDirty();
     updateFlag_ = true;
     reachHead_ = false;
     reachTail_ = false;
@@ -246,6 +246,7 @@ protected:
     std::unordered_map<int32_t, RefPtr<RenderNode>> items_;
     std::set<int32_t> showItem_;
     std::set<int32_t> inCache_;
+    // Returned by GetChildren(), the z-order of the children is marked dirty whenever it changes.
     std::list<RefPtr<RenderNode>> childrenInRect_;
     // Map structure: [Index - (rowSpan, columnSpan)]
     std::map<int32_t, Span> itemSpanCache_;
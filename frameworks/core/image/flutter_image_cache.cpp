@@ -26,17 +26,23 @@ RefPtr<ImageCache> ImageCache::Create()
 
 void FlutterImageCache::Clear()
 {
-    std::scoped_lock clearLock(cacheListMutex_, imageCacheMutex_, dataCacheListMutex_, imageDataCacheMutex_);
-    cacheList_.clear();
-    imageCache_.clear();
-    dataCacheList_.clear();
-    imageDataCache_.clear();
+    imageCache_.Clear();
+    imageDataCache_.Clear();
 }
 
-RefPtr<CachedImageData> FlutterImageCache::GetDataFromCacheFile(const std::string& filePath)
+size_t FlutterImageCache::GetImageSize(const std::shared_ptr<CachedImage>& image) const
+{
+    if (!image || !image->imagePtr) {
+        return 0;
+    }
+    auto skImage = image->imagePtr->image();
+    return skImage ? skImage->imageInfo().computeMinByteSize() : 0;
+}
+
+RefPtr<CachedImageData> FlutterImageCache::GetDataFromCacheFile(const std::string& filePath, const std::string& url)
 {
     std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
-    if (!GetFromCacheFileInner(filePath)) {
+    if (!GetFromCacheFileInner(filePath, url)) {
         LOGD("file not cached, return nullptr");
         return nullptr;
     }
@@ -55,7 +55,10 @@ public:
     FlutterImageCache() = default;
     ~FlutterImageCache() override = default;
     void Clear() override;
-    RefPtr<CachedImageData> GetDataFromCacheFile(const std::string& filePath) override;
+    RefPtr<CachedImageData> GetDataFromCacheFile(const std::string& filePath, const std::string& url) override;
+
+protected:
+    size_t GetImageSize(const std::shared_ptr<CachedImage>& image) const override;
 };
 
 } // namespace OHOS::Ace
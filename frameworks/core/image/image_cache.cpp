@@ -15,13 +15,105 @@
 
 #include "core/image/image_cache.h"
 
+#include <cinttypes>
+#include <cstring>
 #include <dirent.h>
 #include <fstream>
+#include <limits>
+#include <sstream>
 #include <sys/stat.h>
+#include <thread>
+#include <unordered_set>
+#ifndef WINDOWS_PLATFORM
+#include <unistd.h>
+#endif
 
+#include "base/resource/mapped_file.h"
+#include "base/utils/file_utils.h"
+#include "base/utils/utils.h"
 #include "core/image/image_object.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// Same as the memory levels passed to Frontend::OnMemoryLevel.
+constexpr int32_t MEMORY_LEVEL_MODERATE = 0;
+// On moderate memory pressure memory caches are trimmed to half of their current size.
+constexpr size_t TRIM_DIVISOR = 2;
+
+// Journal and temporary files start with '.', so they are never taken as cache files.
+constexpr char CACHE_FILE_JOURNAL[] = ".journal";
+constexpr char CACHE_FILE_JOURNAL_TMP[] = ".journal.tmp";
+constexpr char CACHE_FILE_TMP_PREFIX[] = ".tmp_";
+// Version 2 adds the url to put records, journals of an older version are dropped and the directory is listed.
+constexpr char CACHE_FILE_JOURNAL_HEADER[] = "ACE_IMAGE_CACHE_JOURNAL 2";
+constexpr char JOURNAL_PUT = 'P';
+constexpr char JOURNAL_DELETE = 'D';
+// Journal is rewritten when it holds more than twice the records needed to describe the cache.
+constexpr size_t JOURNAL_COMPACT_MIN_RECORDS = 1000;
+constexpr size_t JOURNAL_COMPACT_FACTOR = 2;
+
+// Offset basis of the second hash, any value different from the FNV one.
+constexpr uint64_t SECOND_OFFSET_BASIS = 0x9E3779B97F4A7C15ULL;
+constexpr size_t HASH_HEX_LENGTH = 16;
+
+std::string GetFileName(const std::string& filePath)
+{
+    auto pos = filePath.find_last_of('/');
+    return pos == std::string::npos ? filePath : filePath.substr(pos + 1);
+}
+
+bool WriteFileSafely(const std::string& filePath, const void* data, size_t size)
+{
+    std::unique_ptr<FILE, decltype(&fclose)> file(fopen(filePath.c_str(), "wb"), fclose);
+    if (!file) {
+        return false;
+    }
+    if (size > 0 && fwrite(data, 1, size, file.get()) != size) {
+        return false;
+    }
+    if (fflush(file.get()) != 0) {
+        return false;
+    }
+#ifndef WINDOWS_PLATFORM
+    // Data must reach the disk before the file is renamed, otherwise a crash may leave a truncated cache file.
+    fsync(fileno(file.get()));
+#endif
+    return true;
+}
+
+// Put record of a cache file, the url is last as it may hold spaces.
+std::string FormatPutRecord(const FileInfo& fileInfo)
+{
+    auto record = std::string(1, JOURNAL_PUT)
+                      .append(" ")
+                      .append(GetFileName(fileInfo.filePath))
+                      .append(" ")
+                      .append(std::to_string(fileInfo.fileSize))
+                      .append(" ")
+                      .append(std::to_string(fileInfo.accessTime));
+    if (!fileInfo.url.empty()) {
+        record.append(" ").append(fileInfo.url);
+    }
+    return record;
+}
+
+std::string FormatStatistics(const std::string& name, const ImageCacheStatistics& statistics)
+{
+    std::string line = name;
+    line.append(": count=").append(std::to_string(statistics.count));
+    if (statistics.countLimit != std::numeric_limits<size_t>::max()) {
+        line.append("/").append(std::to_string(statistics.countLimit));
+    }
+    line.append(" bytes=").append(std::to_string(statistics.bytes));
+    line.append("/").append(std::to_string(statistics.bytesLimit));
+    line.append(" hit=").append(std::to_string(statistics.hitCount));
+    line.append(" miss=").append(std::to_string(statistics.missCount));
+    line.append(" evict=").append(std::to_string(statistics.evictCount));
+    return line;
+}
+
+} // namespace
 
 std::shared_mutex ImageCache::cacheFilePathMutex_;
 std::string ImageCache::cacheFilePath_;
@@ -37,195 +129,184 @@ int32_t ImageCache::cacheFileSize_ = 0;
 
 std::mutex ImageCache::cacheFileInfoMutex_;
 std::list<FileInfo> ImageCache::cacheFileInfo_;
+std::unordered_map<std::string, std::list<FileInfo>::iterator> ImageCache::cacheFileIndex_;
 
-template<typename T>
-void ImageCache::CacheWithCountLimitLRU(
-    const std::string& key,
-    const T& cacheObj,
-    std::list<CacheNode<T>>& cacheList,
-    std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache,
-    const std::atomic<size_t>& capacity)
+FILE* ImageCache::cacheFileJournal_ = nullptr;
+size_t ImageCache::cacheFileJournalRecords_ = 0;
+
+bool ImageCache::GetFromCacheFile(const std::string& filePath, const std::string& url)
 {
-    auto iter = cache.find(key);
-    if (iter == cache.end()) {
-        if (cache.size() == capacity) {
-            cache.erase(cacheList.back().cacheKey);
-            cacheList.pop_back();
-        }
-        cacheList.emplace_front(key, cacheObj);
-        cache.emplace(key, cacheList.begin());
-    } else {
-        iter->second->cacheObj = cacheObj;
-        cacheList.splice(cacheList.begin(), cacheList, iter->second);
-        iter->second = cacheList.begin();
-    }
+    std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+    return GetFromCacheFileInner(filePath, url);
 }
 
-template<typename T>
-T ImageCache::GetCacheObjWithCountLimitLRU(
-    const std::string& key,
-    std::list<CacheNode<T>>& cacheList,
-    std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache)
+bool ImageCache::GetFromCacheFileInner(const std::string& filePath, const std::string& url)
 {
-    auto iter = cache.find(key);
-    if (iter != cache.end()) {
-        cacheList.splice(cacheList.begin(), cacheList, iter->second);
-        iter->second = cacheList.begin();
-        return iter->second->cacheObj;
-    } else {
-        return nullptr;
+    auto iter = cacheFileIndex_.find(filePath);
+    if (iter == cacheFileIndex_.end()) {
+        return false;
+    }
+    // Files taken from the directory have no url, they are trusted by the hash in their name.
+    const auto& fileUrl = iter->second->url;
+    if (!fileUrl.empty() && fileUrl != url) {
+        LOGW("cache file name collides with another url, file: %{private}s", filePath.c_str());
+        return false;
     }
+    iter->second->accessTime = time(nullptr);
+    cacheFileInfo_.splice(cacheFileInfo_.end(), cacheFileInfo_, iter->second);
+    return true;
 }
 
-bool ImageCache::GetFromCacheFile(const std::string& filePath)
+void ImageCache::AddCacheFileInfo(
+    const std::string& filePath, size_t fileSize, time_t accessTime, const std::string& url)
 {
-    std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
-    return GetFromCacheFileInner(filePath);
+    RemoveCacheFileInfo(filePath);
+    cacheFileInfo_.emplace_back(filePath, fileSize, accessTime, url);
+    cacheFileIndex_.emplace(filePath, std::prev(cacheFileInfo_.end()));
+    cacheFileSize_ += static_cast<int32_t>(fileSize);
 }
 
-bool ImageCache::GetFromCacheFileInner(const std::string& filePath)
+void ImageCache::RemoveCacheFileInfo(const std::string& filePath)
 {
-    std::list<FileInfo>::iterator iter = std::find_if(cacheFileInfo_.begin(), cacheFileInfo_.end(),
-        [&filePath](const FileInfo& fileInfo) { return fileInfo.filePath == filePath; });
-    if (iter == cacheFileInfo_.end()) {
-        return false;
+    auto iter = cacheFileIndex_.find(filePath);
+    if (iter != cacheFileIndex_.end()) {
+        cacheFileSize_ -= static_cast<int32_t>(iter->second->fileSize);
+        cacheFileInfo_.erase(iter->second);
+        cacheFileIndex_.erase(iter);
     }
-    iter->accessTime = time(nullptr);
-    cacheFileInfo_.splice(cacheFileInfo_.end(), cacheFileInfo_, iter);
-    return true;
+}
+
+std::string ImageCache::GenerateCacheFileName(const std::string& url)
+{
+    char name[HASH_HEX_LENGTH * 2 + 1] = { 0 };
+    // The second hash runs over the reversed url, so a collision of both is very unlikely.
+    std::string reversedUrl(url.rbegin(), url.rend());
+    if (snprintf(name, sizeof(name), "%016" PRIx64 "%016" PRIx64, HashBytes(url.data(), url.size()),
+        HashBytes(reversedUrl.data(), reversedUrl.size(), SECOND_OFFSET_BASIS)) < 0) {
+        return std::to_string(std::hash<std::string> {}(url));
+    }
+    return name;
 }
 
 void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image)
 {
-    if (key.empty() || capacity_ == 0) {
+    if (!image) {
         return;
     }
-    std::scoped_lock lock(imageCacheMutex_, cacheListMutex_);
-    CacheWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, image, cacheList_, imageCache_, capacity_);
+    imageCache_.Put(key, image, GetImageSize(image));
 }
 
 std::shared_ptr<CachedImage> ImageCache::GetCacheImage(const std::string& key)
 {
-    std::scoped_lock lock(imageCacheMutex_, cacheListMutex_);
-    return GetCacheObjWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, cacheList_, imageCache_);
+    return imageCache_.Get(key);
 }
 
 void ImageCache::CacheImgObj(const std::string& key, const RefPtr<ImageObject>& imgObj)
 {
-    if (key.empty() || imgObjCapacity_ == 0) {
+    if (!imgObj) {
         return;
     }
-    std::scoped_lock lock(cacheImgObjListMutex_, imgObjCacheMutex_);
-    CacheWithCountLimitLRU<RefPtr<ImageObject>>(key, imgObj, cacheImgObjList_, imgObjCache_, imgObjCapacity_);
+    imgObjCache_.Put(key, imgObj, sizeof(ImageObject) + imgObj->GetDataSize());
 }
 
 RefPtr<ImageObject> ImageCache::GetCacheImgObj(const std::string& key)
 {
-    std::scoped_lock lock(cacheImgObjListMutex_, imgObjCacheMutex_);
-    return GetCacheObjWithCountLimitLRU<RefPtr<ImageObject>>(key, cacheImgObjList_, imgObjCache_);
+    return imgObjCache_.Get(key);
 }
 
 void ImageCache::CacheImageData(const std::string& key, const RefPtr<CachedImageData>& imageData)
 {
-    if (key.empty() || !imageData || dataSizeLimit_ == 0) {
+    // Data is cached in a shard of the cache, which holds a share of the whole limit.
+    auto dataSizeLimit = imageDataCache_.GetEntryBytesLimit();
+    if (key.empty() || !imageData || dataSizeLimit == 0) {
         return;
     }
-    std::scoped_lock lock(dataCacheListMutex_, imageDataCacheMutex_);
     auto dataSize = imageData->GetSize();
-    if (dataSize > (dataSizeLimit_ >> 1)) { // if data is longer than half limit, do not cache it.
+    if (dataSize > (dataSizeLimit >> 1)) { // if data is longer than half limit, do not cache it.
         LOGW("data is %{public}d, bigger than half limit %{public}d, do not cache it",
-            static_cast<int32_t>(dataSize), static_cast<int32_t>(dataSizeLimit_ >> 1));
+            static_cast<int32_t>(dataSize), static_cast<int32_t>(dataSizeLimit >> 1));
+        imageDataCache_.Remove(key);
         return;
     }
-    auto iter = imageDataCache_.find(key);
-    if (iter == imageDataCache_.end()) {
-        if (!processImageDataCacheInner(dataSize)) {
-            return;
-        }
-        dataCacheList_.emplace_front(key, imageData);
-        imageDataCache_.emplace(key, dataCacheList_.begin());
-    } else {
-        auto oldSize = iter->second->imageDataPtr->GetSize();
-        if (oldSize != dataSize) {
-            curDataSize_ -= oldSize;
-            if (!processImageDataCacheInner(dataSize)) {
-                return;
-            }
-        }
-        iter->second->imageDataPtr = imageData;
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-    }
+    imageDataCache_.Put(key, imageData, dataSize);
 }
 
-bool ImageCache::processImageDataCacheInner(size_t dataSize)
+RefPtr<CachedImageData> ImageCache::GetCacheImageData(const std::string& key)
 {
-    while (dataSize + curDataSize_ > dataSizeLimit_ && !dataCacheList_.empty()) {
-        curDataSize_ -= dataCacheList_.back().imageDataPtr->GetSize();
-        imageDataCache_.erase(dataCacheList_.back().imageDataKey);
-        dataCacheList_.pop_back();
-    }
-    if (dataSize + curDataSize_ > dataSizeLimit_) {
-        return false;
-    }
-    curDataSize_ += dataSize;
-    return true;
+    return imageDataCache_.Get(key);
 }
 
-RefPtr<CachedImageData> ImageCache::GetCacheImageData(const std::string& key)
+void ImageCache::OnMemoryLevel(int32_t level)
 {
-    std::scoped_lock lock(dataCacheListMutex_, imageDataCacheMutex_);
-    auto iter = imageDataCache_.find(key);
-    if (iter != imageDataCache_.end()) {
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-        return iter->second->imageDataPtr;
-    } else {
-        return nullptr;
+    LOGI("image cache on memory level %{public}d", level);
+    if (level == MEMORY_LEVEL_MODERATE) {
+        imageCache_.Trim(imageCache_.GetCount() / TRIM_DIVISOR, imageCache_.GetBytes() / TRIM_DIVISOR);
+        imageDataCache_.Trim(imageDataCache_.GetCount() / TRIM_DIVISOR, imageDataCache_.GetBytes() / TRIM_DIVISOR);
+        imgObjCache_.Trim(imgObjCache_.GetCount() / TRIM_DIVISOR, imgObjCache_.GetBytes() / TRIM_DIVISOR);
+        return;
     }
+    imageCache_.Clear();
+    imageDataCache_.Clear();
+    imgObjCache_.Clear();
+    MappedFile::ClearCache();
+    Purge();
 }
 
+void ImageCache::Dump(std::vector<std::string>& lines) const
+{
+    lines.emplace_back(FormatStatistics("image", imageCache_.GetStatistics()));
+    lines.emplace_back(FormatStatistics("imageData", imageDataCache_.GetStatistics()));
+    lines.emplace_back(FormatStatistics("imageObject", imgObjCache_.GetStatistics()));
+}
 
 void ImageCache::WriteCacheFile(const std::string& url, const void * const data, const size_t size)
 {
+    // A record holds one line of the journal.
+    if (url.find_first_of("\r\n") != std::string::npos) {
+        return;
+    }
     std::vector<std::string> removeVector;
     std::string cacheNetworkFilePath = GetImageCacheFilePath(url);
 
-    std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
     // 1. first check if file has been cached.
-    if (ImageCache::GetFromCacheFileInner(cacheNetworkFilePath)) {
-        LOGI("file has been wrote %{private}s", cacheNetworkFilePath.c_str());
-        return;
+    {
+        std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+        struct stat fileStatus;
+        if (ImageCache::GetFromCacheFileInner(cacheNetworkFilePath, url) &&
+            stat(cacheNetworkFilePath.c_str(), &fileStatus) == 0) {
+            LOGI("file has been wrote %{private}s", cacheNetworkFilePath.c_str());
+            return;
+        }
+        // A file removed behind the cache or cached for another url is written again, its entry is replaced then.
     }
 
-    // 2. if not in dist, write file into disk.
-#ifdef WINDOWS_PLATFORM
-    std::ofstream outFile(cacheNetworkFilePath, std::ios::binary);
-#else
-    std::ofstream outFile(cacheNetworkFilePath, std::fstream::out);
-#endif
-    if (!outFile.is_open()) {
-        LOGW("open cache file failed, cannot write.");
+    // 2. if not in disk, write a temporary file and rename it, so a cache file is never seen half written.
+    auto fileName = GetFileName(cacheNetworkFilePath);
+    auto tmpFilePath = cacheNetworkFilePath.substr(0, cacheNetworkFilePath.size() - fileName.size())
+                           .append(CACHE_FILE_TMP_PREFIX)
+                           .append(fileName)
+                           .append("_")
+                           .append(std::to_string(std::hash<std::thread::id> {}(std::this_thread::get_id())));
+    if (!WriteFileSafely(tmpFilePath, data, size) || !FileUtils::RenameFile(tmpFilePath, cacheNetworkFilePath)) {
+        LOGW("write cache file failed, cannot write.");
+        remove(tmpFilePath.c_str());
         return;
     }
-    outFile.write(reinterpret_cast<const char*>(data), size);
 
-    cacheFileSize_ += size;
-    cacheFileInfo_.emplace_back(cacheNetworkFilePath, size, time(nullptr));
-    // check if cache files too big.
+    std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
+    AddCacheFileInfo(cacheNetworkFilePath, size, time(nullptr), url);
+    AppendCacheFileJournal(FormatPutRecord(cacheFileInfo_.back()));
+    // check if cache files too big, remove the least recently used files until the clear ratio of the limit is free.
     if (cacheFileSize_ > static_cast<int32_t>(cacheFileLimit_)) {
-        int32_t removeCount = static_cast<int32_t>(cacheFileInfo_.size() * clearCacheFileRatio_);
-        int32_t removeSize = 0;
-        auto iter = cacheFileInfo_.begin();
-        int32_t count = 0;
-        while (count < removeCount) {
-            removeSize += static_cast<int32_t>(iter->fileSize);
-            removeVector.push_back(iter->filePath);
-            iter++;
-            count++;
+        auto targetSize = static_cast<int32_t>(cacheFileLimit_ * (1.0f - clearCacheFileRatio_));
+        while (cacheFileSize_ > targetSize && !cacheFileInfo_.empty()) {
+            const auto& fileInfo = cacheFileInfo_.front();
+            cacheFileSize_ -= static_cast<int32_t>(fileInfo.fileSize);
+            removeVector.push_back(fileInfo.filePath);
+            AppendCacheFileJournal(std::string(1, JOURNAL_DELETE).append(" ").append(GetFileName(fileInfo.filePath)));
+            cacheFileIndex_.erase(fileInfo.filePath);
+            cacheFileInfo_.pop_front();
         }
-        cacheFileInfo_.erase(cacheFileInfo_.begin(), iter);
-        cacheFileSize_ -= static_cast<int32_t>(removeSize);
     }
     // 3. clear files removed from cache list.
     ClearCacheFile(removeVector);
@@ -250,30 +331,149 @@ void ImageCache::SetCacheFileInfo()
         return;
     }
     std::string cacheFilePath = GetImageCacheFilePath();
+    struct stat dirStatus;
+    if (cacheFilePath.empty() || stat(cacheFilePath.c_str(), &dirStatus) != 0 || !S_ISDIR(dirStatus.st_mode)) {
+        LOGW("cache file path wrong! maybe it is not set.");
+        return;
+    }
+    // The journal saves listing the directory and taking the state of every file. The directory is only listed when
+    // the journal is missing or corrupt, the index is then written to a new journal. Files removed behind the cache
+    // are written again when they are cached next time.
+    bool loaded = LoadCacheFileJournal(cacheFilePath);
+    if (!loaded) {
+        ScanCacheFiles(cacheFilePath);
+    }
+    OpenCacheFileJournal(cacheFilePath, !loaded);
+    hasSetCacheFileInfo_ = true;
+}
+
+bool ImageCache::LoadCacheFileJournal(const std::string& cacheFilePath)
+{
+    std::ifstream journal(cacheFilePath + "/" + CACHE_FILE_JOURNAL);
+    std::string line;
+    if (!journal.is_open() || !std::getline(journal, line) || line != CACHE_FILE_JOURNAL_HEADER) {
+        return false;
+    }
+    size_t records = 0;
+    while (std::getline(journal, line)) {
+        // A record torn by a crash has no line end and is dropped by eof.
+        if (journal.eof()) {
+            break;
+        }
+        std::istringstream record(line);
+        char type = 0;
+        std::string fileName;
+        if (!(record >> type >> fileName) || fileName.empty() || fileName[0] == '.') {
+            continue;
+        }
+        auto filePath = cacheFilePath + "/" + fileName;
+        if (type == JOURNAL_PUT) {
+            size_t fileSize = 0;
+            time_t accessTime = 0;
+            std::string url;
+            if (record >> fileSize >> accessTime) {
+                // Files taken from the directory are recorded without a url.
+                std::getline(record >> std::ws, url);
+                AddCacheFileInfo(filePath, fileSize, accessTime, url);
+                ++records;
+            }
+        } else if (type == JOURNAL_DELETE) {
+            RemoveCacheFileInfo(filePath);
+            ++records;
+        }
+    }
+    cacheFileJournalRecords_ = records;
+    LOGI("load %{public}zu cache files from journal", cacheFileInfo_.size());
+    return true;
+}
+
+bool ImageCache::ScanCacheFiles(const std::string& cacheFilePath)
+{
     std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(cacheFilePath.c_str()), closedir);
     if (dir == nullptr) {
         LOGW("cache file path wrong! maybe it is not set.");
-        return;
+        return false;
     }
-    int32_t cacheFileSize = 0;
+    std::unordered_set<std::string> filePaths;
+    std::list<FileInfo> fileInfos;
     dirent* filePtr = readdir(dir.get());
     while (filePtr != nullptr) {
-        // skip . or ..
-        if (filePtr->d_name[0] != '.') {
-            std::string filePath = cacheFilePath + "/" + std::string(filePtr->d_name);
+        // skip ., .. and journal files, remove temporary files left by a crash.
+        std::string fileName(filePtr->d_name);
+        if (fileName.compare(0, strlen(CACHE_FILE_TMP_PREFIX), CACHE_FILE_TMP_PREFIX) == 0 ||
+            fileName == CACHE_FILE_JOURNAL_TMP) {
+            remove((cacheFilePath + "/" + fileName).c_str());
+        } else if (fileName[0] != '.') {
+            std::string filePath = cacheFilePath + "/" + fileName;
             struct stat fileStatus;
-            if (stat(filePath.c_str(), &fileStatus) == -1) {
-                filePtr = readdir(dir.get());
-                continue;
+            // Only files unknown to the index are taken, the others are already described by the journal.
+            if (cacheFileIndex_.find(filePath) != cacheFileIndex_.end()) {
+                filePaths.emplace(filePath);
+            } else if (stat(filePath.c_str(), &fileStatus) == 0) {
+                filePaths.emplace(filePath);
+                fileInfos.emplace_back(filePath, fileStatus.st_size, fileStatus.st_atime);
             }
-            cacheFileInfo_.emplace_back(filePath, fileStatus.st_size, fileStatus.st_atime);
-            cacheFileSize += static_cast<int32_t>(fileStatus.st_size);
         }
         filePtr = readdir(dir.get());
     }
-    cacheFileInfo_.sort();
-    cacheFileSize_ = cacheFileSize;
-    hasSetCacheFileInfo_ = true;
+    bool changed = !fileInfos.empty();
+    for (auto iter = cacheFileInfo_.begin(); iter != cacheFileInfo_.end();) {
+        auto filePath = (iter++)->filePath;
+        if (filePaths.find(filePath) == filePaths.end()) {
+            RemoveCacheFileInfo(filePath);
+            changed = true;
+        }
+    }
+    fileInfos.sort();
+    for (const auto& fileInfo : fileInfos) {
+        AddCacheFileInfo(fileInfo.filePath, fileInfo.fileSize, fileInfo.accessTime);
+    }
+    return changed;
+}
+
+void ImageCache::OpenCacheFileJournal(const std::string& cacheFilePath, bool rewrite)
+{
+    auto journalPath = cacheFilePath + "/" + CACHE_FILE_JOURNAL;
+    if (cacheFileJournal_) {
+        fclose(cacheFileJournal_);
+        cacheFileJournal_ = nullptr;
+    }
+    if (rewrite) {
+        // Write the whole index to a new journal and swap it in, the old journal stays valid until then.
+        auto tmpPath = cacheFilePath + "/" + CACHE_FILE_JOURNAL_TMP;
+        std::string content = std::string(CACHE_FILE_JOURNAL_HEADER).append("\n");
+        for (const auto& fileInfo : cacheFileInfo_) {
+            content.append(FormatPutRecord(fileInfo)).append("\n");
+        }
+        if (!WriteFileSafely(tmpPath, content.data(), content.size()) || !FileUtils::RenameFile(tmpPath, journalPath)) {
+            LOGW("rewrite image cache journal failed.");
+            remove(tmpPath.c_str());
+            remove(journalPath.c_str());
+            return;
+        }
+        cacheFileJournalRecords_ = cacheFileInfo_.size();
+    }
+    cacheFileJournal_ = fopen(journalPath.c_str(), "ab");
+    if (!cacheFileJournal_) {
+        LOGW("open image cache journal failed.");
+    }
+}
+
+void ImageCache::AppendCacheFileJournal(const std::string& record)
+{
+    if (!cacheFileJournal_) {
+        return;
+    }
+    std::string line = record + "\n";
+    if (fwrite(line.data(), 1, line.size(), cacheFileJournal_) != line.size() || fflush(cacheFileJournal_) != 0) {
+        LOGW("write image cache journal failed.");
+        return;
+    }
+    ++cacheFileJournalRecords_;
+    if (cacheFileJournalRecords_ > JOURNAL_COMPACT_MIN_RECORDS &&
+        cacheFileJournalRecords_ > cacheFileInfo_.size() * JOURNAL_COMPACT_FACTOR) {
+        OpenCacheFileJournal(GetImageCacheFilePath(), true);
+    }
 }
 
 } // namespace OHOS::Ace
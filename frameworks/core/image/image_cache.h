@@ -26,19 +26,12 @@
 #include "base/log/log.h"
 #include "base/memory/ace_type.h"
 #include "base/utils/macros.h"
+#include "core/image/image_memory_cache.h"
 
 namespace OHOS::Ace {
 
 struct CachedImage;
 class ImageObject;
-template<typename T>
-struct CacheNode {
-    CacheNode(const std::string& key, const T& obj)
-        : cacheKey(key), cacheObj(obj)
-    {}
-    std::string cacheKey;
-    T cacheObj;
-};
 
 struct CachedImageData : public AceType {
     DECLARE_ACE_TYPE(CachedImageData, AceType);
@@ -49,17 +42,9 @@ public:
     virtual const uint8_t* GetData() = 0;
 };
 
-struct CacheImageDataNode {
-    CacheImageDataNode(const std::string& key, const RefPtr<CachedImageData>& imageData)
-        : imageDataKey(key), imageDataPtr(imageData)
-    {}
-    std::string imageDataKey;
-    RefPtr<CachedImageData> imageDataPtr;
-};
-
 struct FileInfo {
-    FileInfo(const std::string& path, size_t size, time_t time)
-        : filePath(path), fileSize(size), accessTime(time)
+    FileInfo(const std::string& path, size_t size, time_t time, const std::string& fileUrl = "")
+        : filePath(path), fileSize(size), accessTime(time), url(fileUrl)
     {}
 
     // file information will be sort by access time.
@@ -70,6 +55,8 @@ struct FileInfo {
     std::string filePath;
     size_t fileSize;
     time_t accessTime;
+    // Url the file is cached for, empty for files found in the cache directory without a journal record.
+    std::string url;
 };
 
 class ACE_EXPORT ImageCache : public AceType {
@@ -91,29 +78,61 @@ public:
     static void SetCacheFileInfo();
     static void WriteCacheFile(const std::string& url, const void * const data, const size_t size);
 
+    // Max count of decoded images in memory cache.
     void SetCapacity(size_t capacity)
     {
         LOGI("Set Capacity : %{public}d", static_cast<int32_t>(capacity));
-        capacity_ = capacity;
+        imageCache_.SetCountLimit(capacity);
+    }
+
+    // Max bytes of decoded images in memory cache.
+    void SetCacheSizeLimit(size_t sizeLimit)
+    {
+        LOGI("Set image cache size limit : %{public}zu", sizeLimit);
+        imageCache_.SetBytesLimit(sizeLimit);
     }
 
     void SetDataCacheLimit(size_t sizeLimit)
     {
         LOGI("Set data size cache limit : %{public}d", static_cast<int32_t>(sizeLimit));
-        dataSizeLimit_ = sizeLimit;
+        imageDataCache_.SetBytesLimit(sizeLimit);
     }
 
     size_t GetCapacity() const
     {
-        return capacity_;
+        return imageCache_.GetCountLimit();
     }
 
     size_t GetCachedImageCount() const
     {
-        std::lock_guard<std::mutex> lock(cacheListMutex_);
-        return cacheList_.size();
+        return imageCache_.GetCount();
+    }
+
+    size_t GetCachedImageSize() const
+    {
+        return imageCache_.GetBytes();
+    }
+
+    ImageCacheStatistics GetImageStatistics() const
+    {
+        return imageCache_.GetStatistics();
+    }
+
+    ImageCacheStatistics GetImageDataStatistics() const
+    {
+        return imageDataCache_.GetStatistics();
     }
 
+    ImageCacheStatistics GetImgObjStatistics() const
+    {
+        return imgObjCache_.GetStatistics();
+    }
+
+    // Shrinks memory caches on memory pressure, level is the same as Frontend::OnMemoryLevel.
+    void OnMemoryLevel(int32_t level);
+
+    void Dump(std::vector<std::string>& lines) const;
+
     static void SetImageCacheFilePath(const std::string& cacheFilePath)
     {
         std::unique_lock<std::shared_mutex> lock(cacheFilePathMutex_);
@@ -132,16 +151,16 @@ public:
     {
         std::shared_lock<std::shared_mutex> lock(cacheFilePathMutex_);
 #if !defined(WINDOWS_PLATFORM) && !defined(MAC_PLATFORM)
-        return cacheFilePath_ + "/" + std::to_string(std::hash<std::string> {}(url));
+        return cacheFilePath_ + "/" + GenerateCacheFileName(url);
 #elif defined(MAC_PLATFORM)
-        return "/tmp/" + std::to_string(std::hash<std::string> {}(url));
+        return "/tmp/" + GenerateCacheFileName(url);
 #elif defined(WINDOWS_PLATFORM)
         char *pathvar;
         pathvar = getenv("TEMP");
         if (!pathvar) {
-            return std::string("C:\\Windows\\Temp") + "\\" + std::to_string(std::hash<std::string> {}(url));
+            return std::string("C:\\Windows\\Temp") + "\\" + GenerateCacheFileName(url);
         }
-        return std::string(pathvar) + "\\" + std::to_string(std::hash<std::string> {}(url));
+        return std::string(pathvar) + "\\" + GenerateCacheFileName(url);
 #endif
     }
 
@@ -162,57 +181,54 @@ public:
         clearCacheFileRatio_ = clearRatio;
     }
 
-    static bool GetFromCacheFile(const std::string& filePath);
+    // Whether the file of url is cached at filePath, a file cached for another url with the same name is not taken.
+    static bool GetFromCacheFile(const std::string& filePath, const std::string& url);
 
     virtual void Clear() = 0;
 
-    virtual RefPtr<CachedImageData> GetDataFromCacheFile(const std::string& filePath) = 0;
+    virtual RefPtr<CachedImageData> GetDataFromCacheFile(const std::string& filePath, const std::string& url) = 0;
 
     static void Purge();
 
 protected:
-    static void ClearCacheFile(const std::vector<std::string>& removeFiles);
-
-    template<typename T>
-    static void CacheWithCountLimitLRU(
-        const std::string& key,
-        const T& cacheObj,
-        std::list<CacheNode<T>>& cacheList,
-        std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache,
-        const std::atomic<size_t>& capacity);
-
-    template<typename T>
-    static T GetCacheObjWithCountLimitLRU(
-        const std::string& key,
-        std::list<CacheNode<T>>& cacheList,
-        std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache);
+    static constexpr size_t DEFAULT_IMAGE_CACHE_SIZE = 64 * 1024 * 1024;
+    static constexpr size_t DEFAULT_IMG_OBJ_CACHE_COUNT = 2000;
+    static constexpr size_t DEFAULT_IMG_OBJ_CACHE_SIZE = 16 * 1024 * 1024;
 
-    static bool GetFromCacheFileInner(const std::string& filePath);
-
-    bool processImageDataCacheInner(size_t dataSize);
-
-    mutable std::mutex cacheListMutex_;
-    std::list<CacheNode<std::shared_ptr<CachedImage>>> cacheList_;
-
-    std::mutex imageCacheMutex_;
-    std::unordered_map<std::string, std::list<CacheNode<std::shared_ptr<CachedImage>>>::iterator> imageCache_;
-
-    std::atomic<size_t> capacity_ = 0; // by default memory cache can store 0 images.
+    static void ClearCacheFile(const std::vector<std::string>& removeFiles);
 
-    mutable std::mutex dataCacheListMutex_;
-    std::list<CacheImageDataNode> dataCacheList_;
+    static bool GetFromCacheFileInner(const std::string& filePath, const std::string& url);
+
+    // Name of the cache file of url, 128 bits hash of the url which is stable between runs and platforms.
+    // The url is kept in the index and the journal, so a file is never taken for another url with the same hash.
+    static std::string GenerateCacheFileName(const std::string& url);
+
+    // Following functions are called with cacheFileInfoMutex_ locked.
+    static void AddCacheFileInfo(
+        const std::string& filePath, size_t fileSize, time_t accessTime, const std::string& url = "");
+    static void RemoveCacheFileInfo(const std::string& filePath);
+    static bool LoadCacheFileJournal(const std::string& cacheFilePath);
+    // Takes the files missing in the index and drops the entries of files not in the directory, returns whether the
+    // index is changed. Temporary files left by a crash are removed.
+    static bool ScanCacheFiles(const std::string& cacheFilePath);
+    static void OpenCacheFileJournal(const std::string& cacheFilePath, bool rewrite);
+    static void AppendCacheFileJournal(const std::string& record);
+
+    // Bytes of a decoded image, implemented by the cache of each graphics backend.
+    virtual size_t GetImageSize(const std::shared_ptr<CachedImage>& image) const
+    {
+        return 0;
+    }
 
-    std::mutex imageDataCacheMutex_;
-    std::unordered_map<std::string, std::list<CacheImageDataNode>::iterator> imageDataCache_;
+    // by default memory cache can store 0 images.
+    ImageMemoryCache<std::shared_ptr<CachedImage>> imageCache_ { 0, DEFAULT_IMAGE_CACHE_SIZE };
 
-    std::atomic<size_t> dataSizeLimit_ = 0; // by default, image data before decoded cache is 0 MB.;
-    std::atomic<size_t> curDataSize_ = 0;
+    // by default, image data before decoded cache is 0 MB.
+    ImageMemoryCache<RefPtr<CachedImageData>> imageDataCache_ { ImageMemoryCache<RefPtr<CachedImageData>>::UNLIMITED,
+        0 };
 
-    std::mutex cacheImgObjListMutex_;
-    std::list<CacheNode<RefPtr<ImageObject>>> cacheImgObjList_;
-    std::mutex imgObjCacheMutex_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<ImageObject>>>::iterator> imgObjCache_;
-    std::atomic<size_t> imgObjCapacity_ = 2000; // imgObj is cached after clear image data.
+    // imgObj is cached after clear image data.
+    ImageMemoryCache<RefPtr<ImageObject>> imgObjCache_ { DEFAULT_IMG_OBJ_CACHE_COUNT, DEFAULT_IMG_OBJ_CACHE_SIZE };
 
     static std::shared_mutex cacheFilePathMutex_;
     static std::string cacheFilePath_;
@@ -225,8 +241,14 @@ protected:
     static int32_t cacheFileSize_;
 
     static std::mutex cacheFileInfoMutex_;
+    // Cache files in order of access, the least recently used at front.
     static std::list<FileInfo> cacheFileInfo_;
+    static std::unordered_map<std::string, std::list<FileInfo>::iterator> cacheFileIndex_;
     static bool hasSetCacheFileInfo_;
+
+    // Append-only journal of the cache files in the cache directory, replayed at startup instead of scanning it.
+    static FILE* cacheFileJournal_;
+    static size_t cacheFileJournalRecords_;
 };
 
 } // namespace OHOS::Ace
@@ -23,6 +23,7 @@
 #include "base/network/download_manager.h"
 #include "base/resource/ace_res_config.h"
 #include "base/resource/asset_manager.h"
+#include "base/resource/mapped_file.h"
 #include "base/thread/background_task_executor.h"
 #include "base/utils/string_utils.h"
 #include "core/common/ace_application_info.h"
@@ -52,6 +53,18 @@ char* realpath(const char* path, char* resolved_path)
 }
 #endif
 
+// Wraps the content of the asset without copying it, the asset is kept alive until skia releases the data.
+sk_sp<SkData> MakeSkDataFromAsset(const RefPtr<Asset>& asset)
+{
+    if (!asset || asset->GetData() == nullptr || asset->GetSize() == 0) {
+        return nullptr;
+    }
+    auto holder = new RefPtr<Asset>(asset);
+    return SkData::MakeWithProc(
+        asset->GetData(), asset->GetSize(),
+        [](const void* /* ptr */, void* context) { delete static_cast<RefPtr<Asset>*>(context); }, holder);
+}
+
 } // namespace
 
 std::string ImageLoader::RemovePathHead(const std::string& uri)
@@ -117,7 +130,7 @@ sk_sp<SkData> ImageLoader::LoadDataFromCachedFile(const std::string& uri)
         LOGE("cache file path is too long, cacheFilePath: %{private}s", cacheFilePath.c_str());
         return nullptr;
     }
-    bool cacheFileFound = ImageCache::GetFromCacheFile(cacheFilePath);
+    bool cacheFileFound = ImageCache::GetFromCacheFile(cacheFilePath, uri);
     if (!cacheFileFound) {
         return nullptr;
     }
@@ -127,11 +140,7 @@ sk_sp<SkData> ImageLoader::LoadDataFromCachedFile(const std::string& uri)
             strerror(errno));
         return nullptr;
     }
-    std::unique_ptr<FILE, decltype(&fclose)> file(fopen(realPath, "rb"), fclose);
-    if (file) {
-        return SkData::MakeFromFILE(file.get());
-    }
-    return nullptr;
+    return MakeSkDataFromAsset(MappedFile::Open(realPath));
 }
 
 sk_sp<SkData> FileImageLoader::LoadImageData(
@@ -166,12 +175,12 @@ sk_sp<SkData> FileImageLoader::LoadImageData(
             strerror(errno), src.c_str());
         return nullptr;
     }
-    std::unique_ptr<FILE, decltype(&fclose)> file(fopen(realPath, "rb"), fclose);
+    auto file = MappedFile::Open(realPath);
     if (!file) {
-        LOGE("open file failed, filePath: %{private}s, fail reason: %{public}s", filePath.c_str(), strerror(errno));
+        LOGE("open file failed, filePath: %{private}s", filePath.c_str());
         return nullptr;
     }
-    return SkData::MakeFromFILE(file.get());
+    return MakeSkDataFromAsset(file);
 }
 
 sk_sp<SkData> DataProviderImageLoader::LoadImageData(
@@ -235,9 +244,7 @@ sk_sp<SkData> AssetImageLoader::LoadImageData(
         LOGE("No asset data!");
         return nullptr;
     }
-    const uint8_t* data = assetData->GetData();
-    const size_t dataSize = assetData->GetSize();
-    return SkData::MakeWithCopy(data, dataSize);
+    return MakeSkDataFromAsset(assetData);
 }
 
 std::string AssetImageLoader::LoadJsonData(const std::string& src, const WeakPtr<PipelineContext> context)
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_MEMORY_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_MEMORY_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+struct ImageCacheStatistics {
+    size_t count = 0;
+    size_t bytes = 0;
+    size_t countLimit = 0;
+    size_t bytesLimit = 0;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictCount = 0;
+};
+
+// Memory cache limited by both the number of entries and their total bytes.
+// Entries are spread over shards by key hash. Each shard has its own lock and an equal share of the limits, and
+// evicts and demotes only its own entries, so operations on different shards never contend. Each shard is a segmented
+// LRU: new entries enter the probation segment and move to the protected segment when they are hit again, eviction
+// takes the probation segment first, so a burst of images seen only once (such as a fast scroll through a long list)
+// cannot flush the images which are really reused. The LRU order is per shard, the least recently used entry of the
+// whole cache may outlive an entry evicted from a fuller shard.
+template<typename T>
+class ImageMemoryCache final {
+public:
+    static constexpr size_t SHARD_COUNT = 8;
+    static constexpr size_t UNLIMITED = std::numeric_limits<size_t>::max();
+
+    ImageMemoryCache(size_t countLimit, size_t bytesLimit) : countLimit_(countLimit), bytesLimit_(bytesLimit) {}
+    ~ImageMemoryCache() = default;
+
+    // Returns false if the entry is not cached, because the cache is disabled or the entry is larger than the byte
+    // share of a shard. An entry cached before with the same key is removed then, it is stale.
+    bool Put(const std::string& key, const T& obj, size_t bytes)
+    {
+        if (key.empty() || countLimit_ == 0) {
+            return false;
+        }
+        if (bytes > GetEntryBytesLimit()) {
+            Remove(key);
+            return false;
+        }
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            shard.probation.emplace_front(key, obj, bytes);
+            shard.index.emplace(key, shard.probation.begin());
+            count_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            auto& node = *iter->second;
+            shard.bytes -= node.bytes;
+            bytes_.fetch_sub(node.bytes, std::memory_order_relaxed);
+            if (node.isProtected) {
+                shard.protectedBytes = shard.protectedBytes - node.bytes + bytes;
+            }
+            node.cacheObj = obj;
+            node.bytes = bytes;
+            Touch(shard, iter->second);
+        }
+        shard.bytes += bytes;
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+        DemoteProtected(shard, key);
+        TrimShard(shard, ShardLimit(countLimit_), ShardLimit(bytesLimit_), key);
+        return true;
+    }
+
+    // Returns a default constructed T if the key is not cached.
+    T Get(const std::string& key)
+    {
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            missCount_.fetch_add(1, std::memory_order_relaxed);
+            return T();
+        }
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        Touch(shard, iter->second);
+        DemoteProtected(shard, key);
+        return iter->second->cacheObj;
+    }
+
+    // Returns false if the key is not cached.
+    bool Remove(const std::string& key)
+    {
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            return false;
+        }
+        Erase(shard, iter->second);
+        return true;
+    }
+
+    void SetCountLimit(size_t countLimit)
+    {
+        countLimit_ = countLimit;
+        Trim(countLimit, bytesLimit_);
+    }
+
+    size_t GetCountLimit() const
+    {
+        return countLimit_;
+    }
+
+    void SetBytesLimit(size_t bytesLimit)
+    {
+        bytesLimit_ = bytesLimit;
+        Trim(countLimit_, bytesLimit);
+    }
+
+    size_t GetBytesLimit() const
+    {
+        return bytesLimit_;
+    }
+
+    // Entries larger than the byte share of a shard are not cached.
+    size_t GetEntryBytesLimit() const
+    {
+        return ShardLimit(bytesLimit_);
+    }
+
+    size_t GetCount() const
+    {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    size_t GetBytes() const
+    {
+        return bytes_.load(std::memory_order_relaxed);
+    }
+
+    // Evicts the least recently used entries of each shard until it fits in its share of the given limits, the limits
+    // of the cache are not changed. Probation entries of a shard are all evicted before any of its protected entries.
+    // A shard is locked at a time.
+    void Trim(size_t countLimit, size_t bytesLimit)
+    {
+        auto shardCountLimit = ShardLimit(countLimit);
+        auto shardBytesLimit = ShardLimit(bytesLimit);
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            DemoteProtected(shard);
+            TrimShard(shard, shardCountLimit, shardBytesLimit);
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            bytes_.fetch_sub(shard.bytes, std::memory_order_relaxed);
+            count_.fetch_sub(shard.index.size(), std::memory_order_relaxed);
+            shard.probation.clear();
+            shard.protect.clear();
+            shard.index.clear();
+            shard.bytes = 0;
+            shard.protectedCount = 0;
+            shard.protectedBytes = 0;
+        }
+    }
+
+    ImageCacheStatistics GetStatistics() const
+    {
+        ImageCacheStatistics statistics;
+        statistics.count = GetCount();
+        statistics.bytes = GetBytes();
+        statistics.countLimit = countLimit_;
+        statistics.bytesLimit = bytesLimit_;
+        statistics.hitCount = hitCount_.load(std::memory_order_relaxed);
+        statistics.missCount = missCount_.load(std::memory_order_relaxed);
+        statistics.evictCount = evictCount_.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+private:
+    struct Node {
+        Node(const std::string& key, const T& obj, size_t size) : cacheKey(key), cacheObj(obj), bytes(size) {}
+        std::string cacheKey;
+        T cacheObj;
+        size_t bytes = 0;
+        bool isProtected = false;
+    };
+    using NodeIter = typename std::list<Node>::iterator;
+
+    // Segments are ordered by use, most recently used first. Members are guarded by the mutex.
+    struct Shard {
+        std::mutex mutex;
+        std::list<Node> probation;
+        std::list<Node> protect;
+        std::unordered_map<std::string, NodeIter> index;
+        size_t bytes = 0;
+        size_t protectedCount = 0;
+        size_t protectedBytes = 0;
+    };
+
+    // Protected segments hold at most 4/5 of the limits of their shard.
+    static constexpr size_t PROTECTED_NUMERATOR = 4;
+    static constexpr size_t PROTECTED_DENOMINATOR = 5;
+
+    Shard& GetShard(const std::string& key)
+    {
+        return shards_[std::hash<std::string> {}(key) % SHARD_COUNT];
+    }
+
+    // Rounded up, so that a small limit still caches an entry in each shard.
+    static size_t ShardLimit(size_t limit)
+    {
+        return limit == UNLIMITED ? UNLIMITED : limit / SHARD_COUNT + (limit % SHARD_COUNT == 0 ? 0 : 1);
+    }
+
+    static size_t ProtectedLimit(size_t limit)
+    {
+        return limit == UNLIMITED ? UNLIMITED : limit / PROTECTED_DENOMINATOR * PROTECTED_NUMERATOR;
+    }
+
+    static void SetProtected(Shard& shard, Node& node, bool isProtected)
+    {
+        node.isProtected = isProtected;
+        if (isProtected) {
+            ++shard.protectedCount;
+            shard.protectedBytes += node.bytes;
+        } else {
+            --shard.protectedCount;
+            shard.protectedBytes -= node.bytes;
+        }
+    }
+
+    // Called with the shard locked when the entry is hit.
+    static void Touch(Shard& shard, NodeIter iter)
+    {
+        if (iter->isProtected) {
+            shard.protect.splice(shard.protect.begin(), shard.protect, iter);
+            return;
+        }
+        SetProtected(shard, *iter, true);
+        shard.protect.splice(shard.protect.begin(), shard.probation, iter);
+    }
+
+    // Called with the shard locked. Moves the least recently used protected entries other than keepKey back to
+    // probation, as the most recently used ones there, until the protected segment fits in its limits.
+    void DemoteProtected(Shard& shard, const std::string& keepKey = std::string())
+    {
+        auto countLimit = ProtectedLimit(ShardLimit(countLimit_));
+        auto bytesLimit = ProtectedLimit(ShardLimit(bytesLimit_));
+        while (shard.protectedCount > countLimit || shard.protectedBytes > bytesLimit) {
+            auto demoted = FindOldest(shard.protect, keepKey);
+            if (demoted == shard.protect.end()) {
+                break;
+            }
+            SetProtected(shard, *demoted, false);
+            shard.probation.splice(shard.probation.begin(), shard.protect, demoted);
+        }
+    }
+
+    // Called with the shard locked. Evicts the least recently used entries other than keepKey, probation first, until
+    // the shard fits in the given limits.
+    void TrimShard(Shard& shard, size_t countLimit, size_t bytesLimit, const std::string& keepKey = std::string())
+    {
+        for (auto* segment : { &shard.probation, &shard.protect }) {
+            while (shard.index.size() > countLimit || shard.bytes > bytesLimit) {
+                auto victim = FindOldest(*segment, keepKey);
+                if (victim == segment->end()) {
+                    break;
+                }
+                Erase(shard, victim);
+                evictCount_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Called with the shard locked, returns the end of the segment if it has no entry other than keepKey.
+    static NodeIter FindOldest(std::list<Node>& segment, const std::string& keepKey)
+    {
+        for (auto iter = segment.rbegin(); iter != segment.rend(); ++iter) {
+            if (iter->cacheKey != keepKey) {
+                return std::prev(iter.base());
+            }
+        }
+        return segment.end();
+    }
+
+    // Called with the shard locked.
+    void Erase(Shard& shard, NodeIter iter)
+    {
+        auto& segment = iter->isProtected ? shard.protect : shard.probation;
+        if (iter->isProtected) {
+            SetProtected(shard, *iter, false);
+        }
+        shard.bytes -= iter->bytes;
+        bytes_.fetch_sub(iter->bytes, std::memory_order_relaxed);
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        shard.index.erase(iter->cacheKey);
+        segment.erase(iter);
+    }
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::atomic<size_t> countLimit_;
+    std::atomic<size_t> bytesLimit_;
+    std::atomic<size_t> count_ { 0 };
+    std::atomic<size_t> bytes_ { 0 };
+    std::atomic<uint64_t> hitCount_ { 0 };
+    std::atomic<uint64_t> missCount_ { 0 };
+    std::atomic<uint64_t> evictCount_ { 0 };
+
+    ACE_DISALLOW_COPY_AND_MOVE(ImageMemoryCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_MEMORY_CACHE_H
@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_OBJECT_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_OBJECT_H
 
+#include <atomic>
+
 #include "experimental/svg/model/SkSVGDOM.h"
 
 #include "base/image/pixel_map.h"
@@ -92,7 +94,15 @@ public:
         return false;
     }
 
+    // Bytes of image data held by the object, used to limit the memory cache of image objects. Kept apart from the
+    // data, so it can be read while the data is cleared on another thread.
+    size_t GetDataSize() const
+    {
+        return dataSize_.load(std::memory_order_relaxed);
+    }
+
 protected:
+    std::atomic<size_t> dataSize_ { 0 };
     ImageSourceInfo imageSource_;
     Size imageSize_;
     int32_t frameCount_ = 1;
@@ -159,7 +169,9 @@ public:
         int32_t frameCount,
         const sk_sp<SkData>& data)
         : ImageObject(source, imageSize, frameCount), skData_(data)
-    {}
+    {
+        dataSize_ = skData_ ? skData_->size() : 0;
+    }
 
     ~StaticImageObject() override = default;
 
@@ -174,6 +186,7 @@ public:
 
     void ClearData() override
     {
+        dataSize_.store(0, std::memory_order_relaxed);
         skData_ = nullptr;
     }
 
@@ -193,7 +206,9 @@ public:
         int32_t frameCount,
         const sk_sp<SkData>& data)
         : ImageObject(source, imageSize, frameCount), skData_(data)
-    {}
+    {
+        dataSize_ = skData_ ? skData_->size() : 0;
+    }
 
     ~AnimatedImageObject() override = default;
 
@@ -224,6 +239,7 @@ public:
 
     void ClearData() override
     {
+        dataSize_.store(0, std::memory_order_relaxed);
         skData_ = nullptr;
     }
 
@@ -239,6 +255,7 @@ public:
     explicit PixelMapImageObject(const RefPtr<PixelMap>& pixmap) : pixmap_(pixmap)
     {
         imageSize_ = Size(pixmap_->GetWidth(), pixmap_->GetHeight());
+        dataSize_ = static_cast<size_t>(pixmap_->GetByteCount());
     }
 
     ~PixelMapImageObject() override = default;
@@ -253,6 +270,7 @@ public:
 
     void ClearData() override
     {
+        dataSize_.store(0, std::memory_order_relaxed);
         pixmap_ = nullptr;
     }
 
@@ -15,6 +15,8 @@
 
 #include "core/image/image_provider.h"
 
+#include <algorithm>
+
 #include "experimental/svg/model/SkSVGDOM.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/skia/include/core/SkStream.h"
@@ -36,6 +38,10 @@ constexpr double SRGB_GAMUT_AREA = 0.104149;
 
 } // namespace
 
+std::mutex ImageProvider::loadingMutex_;
+std::unordered_map<std::string, std::shared_ptr<ImageProvider::LoadingImageObject>>
+    ImageProvider::loadingImageObjects_;
+
 void ImageProvider::FetchImageObject(
     ImageSourceInfo imageInfo,
     ImageObjSuccessCallback successCallback,
@@ -48,31 +54,28 @@ void ImageProvider::FetchImageObject(
     RefPtr<FlutterRenderTaskHolder>& renderTaskHolder,
     OnPostBackgroundTask onBackgroundTaskPostCallback)
 {
-    auto task = [context, imageInfo, successCallback, failedCallback, useSkiaSvg, renderTaskHolder,
-                    uploadSuccessCallback, needAutoResize, id = Container::CurrentId(), syncMode]() mutable {
+    // Returns whether the image object can be uploaded.
+    auto onImageObjectReady = [context, imageInfo, successCallback, failedCallback, id = Container::CurrentId(),
+                                  syncMode](const RefPtr<ImageObject>& imageObj) -> bool {
         ContainerScope scope(id);
         auto pipelineContext = context.Upgrade();
         if (!pipelineContext) {
             LOGE("pipline context has been released. imageInfo: %{private}s", imageInfo.ToString().c_str());
-            return;
+            return false;
         }
         auto taskExecutor = pipelineContext->GetTaskExecutor();
         if (!taskExecutor) {
             LOGE("task executor is null. imageInfo: %{private}s", imageInfo.ToString().c_str());
-            return;
-        }
-        RefPtr<ImageObject> imageObj = QueryImageObjectFromCache(imageInfo, pipelineContext);
-        if (!imageObj) { // if image object is not in cache, generate a new one.
-            imageObj = GeneraterAceImageObject(imageInfo, pipelineContext, useSkiaSvg);
+            return false;
         }
         if (!imageObj) { // if it fails to generate an image object, trigger fail callback.
             if (syncMode) {
                 failedCallback(imageInfo);
-                return;
+                return false;
             }
             taskExecutor->PostTask(
                 [failedCallback, imageInfo] { failedCallback(imageInfo); }, TaskExecutor::TaskType::UI);
-            return;
+            return false;
         }
         if (syncMode) {
             successCallback(imageInfo, imageObj);
@@ -80,22 +83,139 @@ void ImageProvider::FetchImageObject(
             taskExecutor->PostTask([successCallback, imageInfo, imageObj]() { successCallback(imageInfo, imageObj); },
                 TaskExecutor::TaskType::UI);
         }
-        bool canStartUploadImageObj = !needAutoResize && (imageObj->GetFrameCount() == 1);
-        if (canStartUploadImageObj) {
+        return true;
+    };
+    if (syncMode) {
+        auto pipelineContext = context.Upgrade();
+        if (!pipelineContext) {
+            LOGE("pipline context has been released. imageInfo: %{private}s", imageInfo.ToString().c_str());
+            return;
+        }
+        RefPtr<ImageObject> imageObj = QueryImageObjectFromCache(imageInfo, pipelineContext);
+        if (!imageObj) {
+            imageObj = GeneraterAceImageObject(imageInfo, pipelineContext, useSkiaSvg);
+        }
+        if (onImageObjectReady(imageObj) && !needAutoResize && imageObj->GetFrameCount() == 1) {
             bool forceResize = (!imageObj->IsSvg()) && (imageInfo.IsSourceDimensionValid());
             FlutterRenderImage::UploadImageObjToGpuForRender(imageObj, context, renderTaskHolder, uploadSuccessCallback,
                 failedCallback, imageObj->GetImageSize(), forceResize, true);
         }
-    };
-    if (syncMode) {
-        task();
         return;
     }
-    CancelableTask cancelableTask(std::move(task));
+
+    // Same key as the image object cache, image data is resolved by the assets of the instance, so loads are
+    // only shared inside one instance. Whether the object is uploaded also has to be the same for all waiters.
+    std::string key = std::to_string(Container::CurrentId()) + (useSkiaSvg ? "|skia|" : "|") +
+                      (needAutoResize ? "resize|" : "") + imageInfo.ToString();
+    std::shared_ptr<LoadingImageObject> loading;
+    bool isLoading = false;
+    auto waiter = JoinLoadingImageObject(key,
+        [onImageObjectReady, imageInfo, uploadSuccessCallback, failedCallback](LoadingImageObject& loaded) {
+            if (onImageObjectReady(loaded.imageObj)) {
+                loaded.uploadWaiters.push_back({ imageInfo, uploadSuccessCallback, failedCallback });
+            }
+        },
+        loading, isLoading);
     if (onBackgroundTaskPostCallback) {
-        onBackgroundTaskPostCallback(cancelableTask);
+        onBackgroundTaskPostCallback(waiter);
     }
-    BackgroundTaskExecutor::GetInstance().PostTask(cancelableTask);
+    if (isLoading) {
+        LOGD("image object is loading, wait for it. imageInfo: %{private}s", imageInfo.ToString().c_str());
+        return;
+    }
+    BackgroundTaskExecutor::GetInstance().PostTask([key, loading, imageInfo, context, useSkiaSvg, needAutoResize,
+                                                       renderTaskHolder, id = Container::CurrentId()]() mutable {
+        ContainerScope scope(id);
+        LoadImageObjectShared(key, loading, imageInfo, context, useSkiaSvg, needAutoResize, renderTaskHolder);
+    });
+}
+
+void ImageProvider::LoadImageObjectShared(const std::string& key, const std::shared_ptr<LoadingImageObject>& loading,
+    const ImageSourceInfo& imageInfo, const WeakPtr<PipelineContext>& context, bool useSkiaSvg, bool needAutoResize,
+    RefPtr<FlutterRenderTaskHolder>& renderTaskHolder)
+{
+    auto pipelineContext = context.Upgrade();
+    if (!pipelineContext) {
+        LOGE("pipline context has been released. imageInfo: %{private}s", imageInfo.ToString().c_str());
+        FinishLoadingImageObject(key, loading);
+        return;
+    }
+    if (!StartLoadingImageObject(key, loading)) {
+        LOGD("image object load is aborted. imageInfo: %{private}s", imageInfo.ToString().c_str());
+        return;
+    }
+
+    RefPtr<ImageObject> imageObj = QueryImageObjectFromCache(imageInfo, pipelineContext);
+    if (!imageObj) {
+        imageObj = GeneraterAceImageObject(imageInfo, pipelineContext, useSkiaSvg);
+    }
+
+    // Requests coming after this point start a new load, which may find the image object in the cache.
+    auto waiters = FinishLoadingImageObject(key, loading);
+    loading->imageObj = imageObj;
+    for (const auto& waiter : waiters) {
+        waiter();
+    }
+    if (loading->uploadWaiters.empty() || needAutoResize || imageObj->GetFrameCount() != 1) {
+        return;
+    }
+
+    auto uploadWaiters = std::make_shared<std::vector<UploadWaiter>>(std::move(loading->uploadWaiters));
+    auto uploadSuccessCallback = [uploadWaiters](
+                                     ImageSourceInfo info, const fml::RefPtr<flutter::CanvasImage>& image) {
+        for (const auto& uploadWaiter : *uploadWaiters) {
+            uploadWaiter.uploadSuccessCallback(uploadWaiter.imageInfo, image);
+        }
+    };
+    auto failedCallback = [uploadWaiters](ImageSourceInfo info) {
+        for (const auto& uploadWaiter : *uploadWaiters) {
+            uploadWaiter.failedCallback(uploadWaiter.imageInfo);
+        }
+    };
+    bool forceResize = (!imageObj->IsSvg()) && (imageInfo.IsSourceDimensionValid());
+    FlutterRenderImage::UploadImageObjToGpuForRender(imageObj, context, renderTaskHolder, uploadSuccessCallback,
+        failedCallback, imageObj->GetImageSize(), forceResize, true);
+}
+
+CancelableTask ImageProvider::JoinLoadingImageObject(const std::string& key, LoadingImageObjectCallback&& callback,
+    std::shared_ptr<LoadingImageObject>& loading, bool& isLoading)
+{
+    std::lock_guard<std::mutex> lock(loadingMutex_);
+    auto& entry = loadingImageObjects_[key];
+    isLoading = entry != nullptr;
+    if (!isLoading) {
+        entry = std::make_shared<LoadingImageObject>();
+    }
+    loading = entry;
+    CancelableTask waiter([weak = std::weak_ptr<LoadingImageObject>(loading), callback = std::move(callback)]() {
+        auto loading = weak.lock();
+        if (loading) {
+            callback(*loading);
+        }
+    });
+    loading->waiters.emplace_back(waiter);
+    return waiter;
+}
+
+bool ImageProvider::StartLoadingImageObject(const std::string& key, const std::shared_ptr<LoadingImageObject>& loading)
+{
+    std::lock_guard<std::mutex> lock(loadingMutex_);
+    bool hasWaiter = std::any_of(loading->waiters.begin(), loading->waiters.end(),
+        [](const CancelableTask& waiter) { return !waiter.IsCanceled(); });
+    if (!hasWaiter) {
+        loadingImageObjects_.erase(key);
+    }
+    return hasWaiter;
+}
+
+std::vector<CancelableTask> ImageProvider::FinishLoadingImageObject(
+    const std::string& key, const std::shared_ptr<LoadingImageObject>& loading)
+{
+    std::vector<CancelableTask> waiters;
+    std::lock_guard<std::mutex> lock(loadingMutex_);
+    loadingImageObjects_.erase(key);
+    waiters.swap(loading->waiters);
+    return waiters;
 }
 
 RefPtr<ImageObject> ImageProvider::QueryImageObjectFromCache(
@@ -139,10 +259,10 @@ sk_sp<SkData> ImageProvider::LoadImageRawData(
         // 2 try get data from file cache.
         if (targetSize.IsValid()) {
             LOGD("size valid try load from cache.");
-            std::string cacheFilePath =
-                ImageCache::GetImageCacheFilePath(ImageObject::GenerateCacheKey(imageInfo, targetSize));
+            auto cacheKey = ImageObject::GenerateCacheKey(imageInfo, targetSize);
+            std::string cacheFilePath = ImageCache::GetImageCacheFilePath(cacheKey);
             LOGD("cache file path: %{private}s", cacheFilePath.c_str());
-            auto data = imageCache->GetDataFromCacheFile(cacheFilePath);
+            auto data = imageCache->GetDataFromCacheFile(cacheFilePath, cacheKey);
             if (data) {
                 LOGD("cache file found : %{public}s", cacheFilePath.c_str());
                 return AceType::DynamicCast<SkiaCachedImageData>(data)->imageData;
@@ -418,6 +538,7 @@ sk_sp<SkImage> ImageProvider::GetSkImage(
 void ImageProvider::TryLoadImageInfo(const RefPtr<PipelineContext>& context, const std::string& src,
     std::function<void(bool, int32_t, int32_t)>&& loadCallback)
 {
+    // Images loaded by script are not on screen yet, they wait for the images which are.
     BackgroundTaskExecutor::GetInstance().PostTask(
         [src, callback = std::move(loadCallback), context, id = Container::CurrentId()]() {
             ContainerScope scope(id);
@@ -431,7 +552,8 @@ void ImageProvider::TryLoadImageInfo(const RefPtr<PipelineContext>& context, con
                 return;
             }
             callback(false, 0, 0);
-        });
+        },
+        BgTaskPriority::PREFETCH);
 }
 
 bool ImageProvider::IsWideGamut(const sk_sp<SkColorSpace>& colorSpace)
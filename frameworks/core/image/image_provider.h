@@ -16,7 +16,11 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PROVIDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PROVIDER_H
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/memory/ref_counted.h"
 #include "flutter/lib/ui/painting/image.h"
@@ -138,6 +142,43 @@ public:
     static SkAlphaType AlphaTypeToSkAlphaType(const RefPtr<PixelMap>& pixmap);
     static SkImageInfo MakeSkImageInfoFromPixelMap(const RefPtr<PixelMap>& pixmap);
     static sk_sp<SkColorSpace> ColorSpaceToSkColorSpace(const RefPtr<PixelMap>& pixmap);
+
+private:
+    struct UploadWaiter {
+        ImageSourceInfo imageInfo;
+        UploadSuccessCallback uploadSuccessCallback;
+        FailedCallback failedCallback;
+    };
+
+    // An image object generated and uploaded once for all the requests of the same image.
+    struct LoadingImageObject {
+        // Result delivery of each request, a canceled request is dropped.
+        std::vector<CancelableTask> waiters;
+        RefPtr<ImageObject> imageObj;
+        // Filled by the waiters when the image object is delivered, only used by the loading thread.
+        std::vector<UploadWaiter> uploadWaiters;
+    };
+
+    using LoadingImageObjectCallback = std::function<void(LoadingImageObject&)>;
+
+    // Adds a waiter to the load of the key, and creates the load if there is none. isLoading tells whether the load
+    // was created by an earlier request. The returned task runs the callback with the result, unless it is canceled.
+    static CancelableTask JoinLoadingImageObject(const std::string& key, LoadingImageObjectCallback&& callback,
+        std::shared_ptr<LoadingImageObject>& loading, bool& isLoading);
+    // Returns false and drops the load when every waiter is canceled, nothing has to be generated then.
+    static bool StartLoadingImageObject(const std::string& key, const std::shared_ptr<LoadingImageObject>& loading);
+    // Drops the load, later requests of the key start a new one. Returns the waiters to run with the result.
+    static std::vector<CancelableTask> FinishLoadingImageObject(
+        const std::string& key, const std::shared_ptr<LoadingImageObject>& loading);
+
+    // Generates the image object and uploads it once, then delivers them to the waiters which are not canceled.
+    // Nothing is generated if every waiter is canceled before the load starts.
+    static void LoadImageObjectShared(const std::string& key, const std::shared_ptr<LoadingImageObject>& loading,
+        const ImageSourceInfo& imageInfo, const WeakPtr<PipelineContext>& context, bool useSkiaSvg,
+        bool needAutoResize, RefPtr<FlutterRenderTaskHolder>& renderTaskHolder);
+
+    static std::mutex loadingMutex_;
+    static std::unordered_map<std::string, std::shared_ptr<LoadingImageObject>> loadingImageObjects_;
 };
 
 } // namespace OHOS::Ace
@@ -15,12 +15,20 @@
 
 #include "core/image/test/unittest/image_cache_test.h"
 
+#include <fstream>
+#include <sys/stat.h>
+
 #include "gtest/gtest.h"
 
 using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr size_t SHARD_COUNT = ImageMemoryCache<RefPtr<CachedImageData>>::SHARD_COUNT;
+
+} // namespace
 
 class ImageCacheTest : public testing::Test {
 public:
@@ -30,62 +38,118 @@ public:
     {
         imageCache->SetCapacity(80);
     }
-    void TearDown() {}
+    void TearDown()
+    {
+        // The journal would be replayed by the next run instead of the resource files.
+        remove((CACHE_FILE_PATH + "/" + CACHE_FILE_JOURNAL).c_str());
+    }
+
+    // Starts over with an empty index of the cache files in path.
+    static void ResetCacheFileInfo(const std::string& path)
+    {
+        if (ImageCache::cacheFileJournal_) {
+            fclose(ImageCache::cacheFileJournal_);
+            ImageCache::cacheFileJournal_ = nullptr;
+        }
+        ImageCache::cacheFilePath_ = path;
+        ImageCache::cacheFileInfo_.clear();
+        ImageCache::cacheFileIndex_.clear();
+        ImageCache::cacheFileSize_ = 0;
+        ImageCache::cacheFileJournalRecords_ = 0;
+        mkdir(path.c_str(), S_IRWXU);
+        for (const auto& name : { "a", "b", "c", "d", "e", CACHE_FILE_JOURNAL }) {
+            remove((path + "/" + name).c_str());
+        }
+    }
+
+    // Returns keys which are all cached in the same shard of the memory caches.
+    static std::vector<std::string> GetShardKeys(size_t shardIndex, size_t count)
+    {
+        std::vector<std::string> keys;
+        for (size_t i = 0; keys.size() < count; ++i) {
+            auto key = "shard" + std::to_string(i);
+            if (std::hash<std::string> {}(key) % SHARD_COUNT == shardIndex) {
+                keys.emplace_back(key);
+            }
+        }
+        return keys;
+    }
+
+    static void WriteFile(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    static size_t CountLines(const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string line;
+        size_t count = 0;
+        while (std::getline(file, line)) {
+            ++count;
+        }
+        return count;
+    }
 
     RefPtr<ImageCache> imageCache = ImageCache::Create();
 };
 
 /**
  * @tc.name: MemoryCache001
- * @tc.desc: new image success insert into cache with LRU.
+ * @tc.desc: new image success insert into cache.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache001, TestSize.Level1)
 {
     /**
      * @tc.steps: step1. cache images one by one.
-     * @tc.expected: new item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: every image can be found in cache and the count is right.
      */
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
-        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
-        ASSERT_EQ(frontKey, FILE_KEYS[i]);
-        ASSERT_EQ(frontKey, imageCache->imageCache_[FILE_KEYS[i]]->cacheKey);
+        auto image = std::make_shared<CachedImage>(flutter::CanvasImage::Create());
+        imageCache->CacheImage(FILE_KEYS[i], image);
+        ASSERT_EQ(imageCache->GetCacheImage(FILE_KEYS[i]), image);
+        ASSERT_EQ(imageCache->GetCachedImageCount(), i + 1);
     }
 
     /**
      * @tc.steps: step2. cache a image already in cache for example FILE_KEYS[3] e.t. "key4".
-     * @tc.expected: the cached item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: the cached item is replaced and the count does not change.
      */
-    imageCache->CacheImage(FILE_KEYS[3], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[3]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[3]]->cacheKey, FILE_KEYS[3]);
+    auto image = std::make_shared<CachedImage>(flutter::CanvasImage::Create());
+    imageCache->CacheImage(FILE_KEYS[3], image);
+    ASSERT_EQ(imageCache->GetCacheImage(FILE_KEYS[3]), image);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), CACHE_FILES.size());
 }
 
 /**
  * @tc.name: MemoryCache002
- * @tc.desc: get image success in cache with LRU.
+ * @tc.desc: get image success in cache, images hit again are kept when the cache is full.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
 {
     /**
-     * @tc.steps: step1. cache images one by one.
+     * @tc.steps: step1. cache images one by one, then hit each of them.
      */
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
         imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
+        ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[i]), nullptr);
     }
+
     /**
-     * @tc.steps: step2. find a image already in cache for example FILE_KEYS[2] e.t. "key3".
-     * @tc.expected: the cached iterator should not at end() of cacheList_ and imagCache.
-     *              after GetImageCache(), the item should at begin() of cacheList_.
+     * @tc.steps: step2. cache much more images than capacity, each of them only once.
+     * @tc.expected: count never goes beyond capacity, images hit before are still in cache.
      */
-    auto iter = (imageCache->imageCache_).find(FILE_KEYS[2]);
-    ASSERT_NE(iter, imageCache->imageCache_.end());
-    imageCache->GetCacheImage(FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[2]]->cacheKey, FILE_KEYS[2]);
+    for (size_t i = 0; i < imageCache->GetCapacity() * 2; i++) {
+        auto image = std::make_shared<CachedImage>(flutter::CanvasImage::Create());
+        imageCache->CacheImage("scan" + std::to_string(i), image);
+        ASSERT_LE(imageCache->GetCachedImageCount(), imageCache->GetCapacity());
+    }
+    for (size_t i = 0; i < CACHE_FILES.size(); i++) {
+        ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[i]), nullptr);
+    }
 
     /**
      * @tc.steps: step3. find a image not in cache for example "key8".
@@ -93,6 +157,9 @@ HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
      */
     auto image = imageCache->GetCacheImage("key8");
     ASSERT_EQ(image, nullptr);
+    auto statistics = imageCache->GetImageStatistics();
+    ASSERT_EQ(statistics.missCount, 1u);
+    ASSERT_EQ(statistics.hitCount, 2 * CACHE_FILES.size());
 }
 
 /**
@@ -107,7 +174,32 @@ HWTEST_F(ImageCacheTest, MemoryCache003, TestSize.Level1)
      * @tc.expected: capacity set to 1000.
      */
     imageCache->SetCapacity(1000);
-    ASSERT_EQ(static_cast<int32_t>(imageCache->capacity_), 1000);
+    ASSERT_EQ(static_cast<int32_t>(imageCache->GetCapacity()), 1000);
+
+    /**
+     * @tc.steps: step2. cache some images in a shard, then set capacity to 2 images per shard.
+     * @tc.expected: cache is trimmed to 2 images.
+     */
+    auto keys = GetShardKeys(0, CACHE_FILES.size());
+    for (const auto& key : keys) {
+        imageCache->CacheImage(key, std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
+    }
+    imageCache->SetCapacity(2 * SHARD_COUNT);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 2u);
+
+    /**
+     * @tc.steps: step3. cache more images in another shard.
+     * @tc.expected: images are evicted from that shard only.
+     */
+    auto otherKeys = GetShardKeys(1, CACHE_FILES.size());
+    for (const auto& key : otherKeys) {
+        imageCache->CacheImage(key, std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
+    }
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 4u);
+    ASSERT_NE(imageCache->GetCacheImage(keys[keys.size() - 2]), nullptr);
+    ASSERT_NE(imageCache->GetCacheImage(keys.back()), nullptr);
+    ASSERT_EQ(imageCache->GetCacheImage(otherKeys.front()), nullptr);
+    ASSERT_NE(imageCache->GetCacheImage(otherKeys.back()), nullptr);
 }
 
 /**
@@ -118,82 +210,118 @@ HWTEST_F(ImageCacheTest, MemoryCache003, TestSize.Level1)
 HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
 {
     /**
-     * @tc.steps: step1. set data limit to 10 bytes, cache some data.check result
+     * @tc.steps: step1. set data limit to 10 bytes per shard, cache some data in a shard.check result
      * @tc.expected: result is right.
      */
-    imageCache->dataSizeLimit_ = 10;
+    imageCache->SetDataCacheLimit(10 * SHARD_COUNT);
+    auto keys = GetShardKeys(0, 6);
 
     // create 3 bytes data, cache it, current size is 3
     const uint8_t data1[] = {'a', 'b', 'c' };
     sk_sp<SkData> skData1 = SkData::MakeWithCopy(data1, 3);
     auto cachedData1 = AceType::MakeRefPtr<SkiaCachedImageData>(skData1);
-    imageCache->CacheImageData(KEY_1, cachedData1);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
+    imageCache->CacheImageData(keys[0], cachedData1);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 3u);
 
     // create 2 bytes data, cache it, current size is 5. {abc} {de}
     const uint8_t data2[] = {'d', 'e' };
     sk_sp<SkData> skData2 = SkData::MakeWithCopy(data2, 2);
     auto cachedData2 = AceType::MakeRefPtr<SkiaCachedImageData>(skData2);
-    imageCache->CacheImageData(KEY_2, cachedData2);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
+    imageCache->CacheImageData(keys[1], cachedData2);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 5u);
 
     // create 7 bytes data, cache it, current size is 5. new data not cached.
     const uint8_t data3[] = { 'f', 'g', 'h', 'i', 'j', 'k', 'l' };
     sk_sp<SkData> skData3 = SkData::MakeWithCopy(data3, 7);
     auto cachedData3 = AceType::MakeRefPtr<SkiaCachedImageData>(skData3);
-    imageCache->CacheImageData(KEY_3, cachedData3);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
-    auto data = imageCache->GetCacheImageData(KEY_3);
+    imageCache->CacheImageData(keys[2], cachedData3);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 5u);
+    auto data = imageCache->GetCacheImageData(keys[2]);
     ASSERT_EQ(data, nullptr);
 
     // create 5 bytes data, cache it, current size is 10 {abc} {de} {mnopq}
     const uint8_t data4[] = { 'm', 'n', 'o', 'p', 'q' };
     sk_sp<SkData> skData4 = SkData::MakeWithCopy(data4, 5);
     auto cachedData4 = AceType::MakeRefPtr<SkiaCachedImageData>(skData4);
-    imageCache->CacheImageData(KEY_4, cachedData4);
-    ASSERT_EQ(imageCache->curDataSize_, 10u);
+    imageCache->CacheImageData(keys[3], cachedData4);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 10u);
 
     // create 2 bytes data, cache it, current size is 9 {de}{mnopq}{rs}
     const uint8_t data5[] = { 'r', 's' };
     sk_sp<SkData> skData5 = SkData::MakeWithCopy(data5, 2);
     auto cachedData5 = AceType::MakeRefPtr<SkiaCachedImageData>(skData5);
-    imageCache->CacheImageData(KEY_5, cachedData5);
-    ASSERT_EQ(imageCache->curDataSize_, 9u);
+    imageCache->CacheImageData(keys[4], cachedData5);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 9u);
 
     // create 5 bytes, cache it, current size is 7 {rs}{tuvwx}
     const uint8_t data6[] = { 't', 'u', 'v', 'w', 'x' };
     sk_sp<SkData> skData6 = SkData::MakeWithCopy(data6, 5);
     auto cachedData6 = AceType::MakeRefPtr<SkiaCachedImageData>(skData6);
-    imageCache->CacheImageData(KEY_6, cachedData6);
-    ASSERT_EQ(imageCache->curDataSize_, 7u);
+    imageCache->CacheImageData(keys[5], cachedData6);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 7u);
 
     // cache data witch is already cached. {rs}{y}
     const uint8_t data7[] = { 'y' };
     sk_sp<SkData> skData7 = SkData::MakeWithCopy(data7, 1);
     auto cachedData7 = AceType::MakeRefPtr<SkiaCachedImageData>(skData7);
-    imageCache->CacheImageData(KEY_6, cachedData7);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
+    imageCache->CacheImageData(keys[5], cachedData7);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 3u);
 
     // cache data witch is already cached. {y}{fg}
     const uint8_t data8[] = { 'f', 'g' };
     sk_sp<SkData> skData8 = SkData::MakeWithCopy(data8, 2);
     auto cachedData8 = AceType::MakeRefPtr<SkiaCachedImageData>(skData8);
-    imageCache->CacheImageData(KEY_5, cachedData8);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-    auto dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
+    imageCache->CacheImageData(keys[4], cachedData8);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 3u);
+    auto dataKey5 = imageCache->GetCacheImageData(keys[4]);
+    auto dataRaw5 = dataKey5->GetData();
     for (int i = 0; i < 2; ++i) {
-        ASSERT_EQ(dataFront[i], data8[i]);
+        ASSERT_EQ(dataRaw5[i], data8[i]);
     }
-    auto dataKey5 = imageCache->GetCacheImageData(KEY_5);
-    auto dataRaw5 = dataKey5->GetData();
-    ASSERT_EQ(dataFront, dataRaw5);
 
-    // Get key6
-    auto dataKey6 = imageCache->GetCacheImageData(KEY_6);
+    // Get key6, it is the most recently used and the last one kept when the cache is trimmed.
+    auto dataKey6 = imageCache->GetCacheImageData(keys[5]);
     auto dataRaw6 = dataKey6->GetData();
     ASSERT_EQ(dataRaw6[0], 'y');
-    dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
-    ASSERT_EQ(dataFront, dataRaw6);
+    imageCache->imageDataCache_.Trim(SHARD_COUNT, 10 * SHARD_COUNT);
+    ASSERT_EQ(imageCache->GetCacheImageData(keys[4]), nullptr);
+    ASSERT_EQ(imageCache->GetCacheImageData(keys[5]), dataKey6);
+
+    // cache data larger than half limit with a cached key, the stale data is removed.
+    imageCache->CacheImageData(keys[5], cachedData3);
+    ASSERT_EQ(imageCache->GetCacheImageData(keys[5]), nullptr);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 0u);
+}
+
+/**
+ * @tc.name: MemoryCache005
+ * @tc.desc: memory caches are trimmed on memory pressure.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, MemoryCache005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. cache some image data, notify moderate memory level.
+     * @tc.expected: size of image data is not more than half.
+     */
+    imageCache->SetDataCacheLimit(100);
+    const uint8_t bytes[] = { 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j' };
+    for (size_t i = 0; i < CACHE_FILES.size(); i++) {
+        imageCache->CacheImageData(FILE_KEYS[i], AceType::MakeRefPtr<SkiaCachedImageData>(
+            SkData::MakeWithCopy(bytes, sizeof(bytes))));
+        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
+    }
+    auto sizeBefore = imageCache->GetImageDataStatistics().bytes;
+    imageCache->OnMemoryLevel(0);
+    ASSERT_LE(imageCache->GetImageDataStatistics().bytes, sizeBefore / 2);
+
+    /**
+     * @tc.steps: step2. notify critical memory level.
+     * @tc.expected: memory caches are empty.
+     */
+    imageCache->OnMemoryLevel(2);
+    ASSERT_EQ(imageCache->GetImageDataStatistics().bytes, 0u);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 0u);
 }
 
 /**
@@ -265,9 +393,9 @@ HWTEST_F(ImageCacheTest, FileCache003, TestSize.Level1)
      * @tc.steps: step2. call GetFromCacheFile().
      * @tc.expected:data != nullptr.
      */
-    auto data = ImageCache::GetFromCacheFile(CACHE_IMAGE_FILE_2);
+    auto data = ImageCache::GetFromCacheFile(CACHE_IMAGE_FILE_2, "http:/testfilecache003/image");
     ASSERT_TRUE(data);
-    auto nullData = ImageCache::GetFromCacheFile(wrongFilePath);
+    auto nullData = ImageCache::GetFromCacheFile(wrongFilePath, "http:/testfilecache003/image");
     ASSERT_TRUE(!nullData);
 }
 
@@ -291,9 +419,202 @@ HWTEST_F(ImageCacheTest, FileCache004, TestSize.Level1)
     std::vector<uint8_t> imageData = { 1, 2, 3 };
     std::string url = "http:/testfilecache003/image";
     ImageCache::WriteCacheFile(url, imageData.data(), imageData.size());
-    float ratio = ImageCache::clearCacheFileRatio_;
-    ASSERT_EQ(ImageCache::cacheFileInfo_.size(), static_cast<size_t>((TEST_COUNT + 2) * ratio + 1));
-    ASSERT_LE(ImageCache::cacheFileSize_, FILE_SIZE);
+    ASSERT_TRUE(ImageCache::cacheFileInfo_.empty());
+    ASSERT_TRUE(ImageCache::cacheFileIndex_.empty());
+    ASSERT_EQ(ImageCache::cacheFileSize_, 0);
+}
+
+
+/**
+ * @tc.name: FileCache005
+ * @tc.desc: Journal replay drops files removed behind the cache and takes files without a record.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, FileCache005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Write file b and d, journal records b, c and a deleted a.
+     */
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
+    WriteFile(JOURNAL_TEST_PATH + "/b", "bbbbb");
+    WriteFile(JOURNAL_TEST_PATH + "/d", "dd");
+    WriteFile(JOURNAL_TEST_PATH + "/" + CACHE_FILE_JOURNAL,
+        std::string(JOURNAL_HEADER) + "\nP a 3 100\nP b 5 200\nP c 4 300\nD a\n");
+
+    /**
+     * @tc.steps: step2. Replay the journal.
+     * @tc.expected: step2. Index holds b and c as recorded.
+     */
+    ASSERT_TRUE(ImageCache::LoadCacheFileJournal(JOURNAL_TEST_PATH));
+    EXPECT_EQ(ImageCache::cacheFileJournalRecords_, 4u);
+    EXPECT_EQ(ImageCache::cacheFileInfo_.size(), 2u);
+    EXPECT_EQ(ImageCache::cacheFileSize_, 9);
+
+    /**
+     * @tc.steps: step3. Check the index against the directory.
+     * @tc.expected: step3. c which is not on disk is dropped, d is taken, b stays.
+     */
+    EXPECT_TRUE(ImageCache::ScanCacheFiles(JOURNAL_TEST_PATH));
+    EXPECT_EQ(ImageCache::cacheFileIndex_.count(JOURNAL_TEST_PATH + "/b"), 1u);
+    EXPECT_EQ(ImageCache::cacheFileIndex_.count(JOURNAL_TEST_PATH + "/c"), 0u);
+    EXPECT_EQ(ImageCache::cacheFileIndex_.count(JOURNAL_TEST_PATH + "/d"), 1u);
+    EXPECT_EQ(ImageCache::cacheFileSize_, 7);
+    EXPECT_FALSE(ImageCache::ScanCacheFiles(JOURNAL_TEST_PATH));
+
+    /**
+     * @tc.steps: step4. Remove b behind the cache and write it again.
+     * @tc.expected: step4. b is written instead of being taken as cached.
+     */
+    ImageCache::OpenCacheFileJournal(JOURNAL_TEST_PATH, true);
+    ImageCache::SetCacheFileLimit(CACHE_FILE_LIMIT);
+    auto url = std::string("http:/testfilecache005/image");
+    ImageCache::WriteCacheFile(url, "bbb", 3);
+    remove(ImageCache::GetImageCacheFilePath(url).c_str());
+    ImageCache::WriteCacheFile(url, "bbb", 3);
+    struct stat fileStatus;
+    EXPECT_EQ(stat(ImageCache::GetImageCacheFilePath(url).c_str(), &fileStatus), 0);
+    remove(ImageCache::GetImageCacheFilePath(url).c_str());
+}
+
+/**
+ * @tc.name: FileCache006
+ * @tc.desc: A torn last record of the journal is dropped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, FileCache006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Write a journal whose last record has no line end.
+     */
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
+    WriteFile(JOURNAL_TEST_PATH + "/b", "bbbbb");
+    WriteFile(JOURNAL_TEST_PATH + "/e", "eeeeeee");
+    WriteFile(JOURNAL_TEST_PATH + "/" + CACHE_FILE_JOURNAL, std::string(JOURNAL_HEADER) + "\nP b 5 200\nP e 7");
+
+    /**
+     * @tc.steps: step2. Replay the journal.
+     * @tc.expected: step2. Only b is replayed, e is taken from the directory.
+     */
+    ASSERT_TRUE(ImageCache::LoadCacheFileJournal(JOURNAL_TEST_PATH));
+    EXPECT_EQ(ImageCache::cacheFileJournalRecords_, 1u);
+    EXPECT_EQ(ImageCache::cacheFileInfo_.size(), 1u);
+    EXPECT_TRUE(ImageCache::ScanCacheFiles(JOURNAL_TEST_PATH));
+    EXPECT_EQ(ImageCache::cacheFileInfo_.size(), 2u);
+    EXPECT_EQ(ImageCache::cacheFileSize_, 12);
+
+    /**
+     * @tc.steps: step3. Replay a journal with a wrong header.
+     * @tc.expected: step3. The journal is not used.
+     */
+    WriteFile(JOURNAL_TEST_PATH + "/" + CACHE_FILE_JOURNAL, "ACE_IMAGE_CACHE_JOURNAL 0\nP b 5 200\n");
+    EXPECT_FALSE(ImageCache::LoadCacheFileJournal(JOURNAL_TEST_PATH));
+}
+
+/**
+ * @tc.name: FileCache007
+ * @tc.desc: Journal is compacted once it holds too many records.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, FileCache007, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Index file b and start a journal with it.
+     */
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
+    WriteFile(JOURNAL_TEST_PATH + "/b", "bbbbb");
+    EXPECT_TRUE(ImageCache::ScanCacheFiles(JOURNAL_TEST_PATH));
+    ImageCache::OpenCacheFileJournal(JOURNAL_TEST_PATH, true);
+    auto journalPath = JOURNAL_TEST_PATH + "/" + CACHE_FILE_JOURNAL;
+    EXPECT_EQ(ImageCache::cacheFileJournalRecords_, 1u);
+    EXPECT_EQ(CountLines(journalPath), 2u);
+
+    /**
+     * @tc.steps: step2. Append records below and above the compaction threshold.
+     * @tc.expected: step2. Journal grows, then is rewritten with only the record of b.
+     */
+    ImageCache::AppendCacheFileJournal("P b 5 300");
+    EXPECT_EQ(CountLines(journalPath), 3u);
+    ImageCache::cacheFileJournalRecords_ = JOURNAL_COMPACT_MIN_RECORDS;
+    ImageCache::AppendCacheFileJournal("P b 5 400");
+    EXPECT_EQ(ImageCache::cacheFileJournalRecords_, 1u);
+    EXPECT_EQ(CountLines(journalPath), 2u);
+
+    /**
+     * @tc.steps: step3. Replay the compacted journal.
+     * @tc.expected: step3. Index is the same.
+     */
+    ImageCache::cacheFileInfo_.clear();
+    ImageCache::cacheFileIndex_.clear();
+    ImageCache::cacheFileSize_ = 0;
+    ASSERT_TRUE(ImageCache::LoadCacheFileJournal(JOURNAL_TEST_PATH));
+    EXPECT_EQ(ImageCache::cacheFileJournalRecords_, 1u);
+    EXPECT_EQ(ImageCache::cacheFileIndex_.count(JOURNAL_TEST_PATH + "/b"), 1u);
+    EXPECT_EQ(ImageCache::cacheFileSize_, 5);
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
+}
+
+/**
+ * @tc.name: FileCache008
+ * @tc.desc: The journal is used without listing the directory, files are only taken for the url they are cached for.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, FileCache008, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Write file b recorded for a url, file d without a record and a temporary file.
+     */
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
+    auto tmpFilePath = JOURNAL_TEST_PATH + "/" + CACHE_FILE_TMP_PREFIX + "b_1";
+    WriteFile(JOURNAL_TEST_PATH + "/b", "bbbbb");
+    WriteFile(JOURNAL_TEST_PATH + "/d", "dd");
+    WriteFile(tmpFilePath, "b");
+    WriteFile(
+        JOURNAL_TEST_PATH + "/" + CACHE_FILE_JOURNAL, std::string(JOURNAL_HEADER) + "\nP b 5 200 http:/b/image\n");
+
+    /**
+     * @tc.steps: step2. Set the cache file info from the journal.
+     * @tc.expected: step2. Only b is indexed, the directory is not listed.
+     */
+    ImageCache::hasSetCacheFileInfo_ = false;
+    ImageCache::SetCacheFileInfo();
+    EXPECT_EQ(ImageCache::cacheFileInfo_.size(), 1u);
+    EXPECT_EQ(ImageCache::cacheFileIndex_.count(JOURNAL_TEST_PATH + "/d"), 0u);
+    struct stat fileStatus;
+    EXPECT_EQ(stat(tmpFilePath.c_str(), &fileStatus), 0);
+
+    /**
+     * @tc.steps: step3. Look b up for its url and for another url with the same file.
+     * @tc.expected: step3. b is only found for its url.
+     */
+    EXPECT_TRUE(ImageCache::GetFromCacheFile(JOURNAL_TEST_PATH + "/b", "http:/b/image"));
+    EXPECT_FALSE(ImageCache::GetFromCacheFile(JOURNAL_TEST_PATH + "/b", "http:/other/image"));
+
+    /**
+     * @tc.steps: step4. Remove the journal and set the cache file info again.
+     * @tc.expected: step4. The directory is listed, b and d are indexed and the temporary file is removed.
+     */
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
+    WriteFile(JOURNAL_TEST_PATH + "/b", "bbbbb");
+    WriteFile(JOURNAL_TEST_PATH + "/d", "dd");
+    WriteFile(tmpFilePath, "b");
+    ImageCache::hasSetCacheFileInfo_ = false;
+    ImageCache::SetCacheFileInfo();
+    EXPECT_EQ(ImageCache::cacheFileInfo_.size(), 2u);
+    EXPECT_EQ(ImageCache::cacheFileSize_, 7);
+    EXPECT_NE(stat(tmpFilePath.c_str(), &fileStatus), 0);
+
+    /**
+     * @tc.steps: step5. Replay the journal written for the listed files.
+     * @tc.expected: step5. b and d are indexed without a url, they are found for any url.
+     */
+    ImageCache::cacheFileInfo_.clear();
+    ImageCache::cacheFileIndex_.clear();
+    ImageCache::cacheFileSize_ = 0;
+    ASSERT_TRUE(ImageCache::LoadCacheFileJournal(JOURNAL_TEST_PATH));
+    EXPECT_EQ(ImageCache::cacheFileInfo_.size(), 2u);
+    EXPECT_TRUE(ImageCache::GetFromCacheFile(JOURNAL_TEST_PATH + "/d", "http:/d/image"));
+    ImageCache::hasSetCacheFileInfo_ = false;
+    ResetCacheFileInfo(JOURNAL_TEST_PATH);
 }
 
-} // namespace OHOS::Ace
\ No newline at end of file
+} // namespace OHOS::Ace
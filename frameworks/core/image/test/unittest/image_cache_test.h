@@ -32,6 +32,14 @@ const std::string CACHE_IMAGE_FILE_5 = "/data/test/resource/imagecache/images/58
 const std::vector<std::string> CACHE_FILES = { CACHE_IMAGE_FILE_1, CACHE_IMAGE_FILE_2, CACHE_IMAGE_FILE_3,
     CACHE_IMAGE_FILE_4, CACHE_IMAGE_FILE_5 };
 const size_t TEST_COUNT = CACHE_FILES.size();
+const size_t CACHE_FILE_LIMIT = 1024 * 1024;
+
+const std::string JOURNAL_TEST_PATH = "/data/test/resource/imagecache/journal";
+// Same as the journal written by ImageCache.
+constexpr char CACHE_FILE_JOURNAL[] = ".journal";
+constexpr char CACHE_FILE_TMP_PREFIX[] = ".tmp_";
+constexpr char JOURNAL_HEADER[] = "ACE_IMAGE_CACHE_JOURNAL 2";
+constexpr size_t JOURNAL_COMPACT_MIN_RECORDS = 1000;
 
 const std::string KEY_1 = "key1";
 const std::string KEY_2 = "key2";
@@ -38,6 +38,12 @@ Platform::JniEnvironment& Platform::JniEnvironment::GetInstance()
     return jniEnvironment;
 }
 
+namespace {
+
+const std::string TEST_LOADING_KEY = "0|" + FILE_PNG;
+
+} // namespace
+
 class ImageProviderTest : public testing::Test {
 public:
     static void SetUpTestCase() {}
@@ -226,4 +232,110 @@ HWTEST_F(ImageProviderTest, WrongImageData001, TestSize.Level1)
     }
 }
 
-} // namespace OHOS::Ace
\ No newline at end of file
+/**
+ * @tc.name: SharedLoad001
+ * @tc.desc: Two requests of the same image wait for one load.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTest, SharedLoad001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. join the load of the same key twice.
+     * @tc.expected: step1. the second request joins the load created by the first one.
+     */
+    int32_t deliveredCount = 0;
+    auto callback = [&deliveredCount](ImageProvider::LoadingImageObject& loaded) { ++deliveredCount; };
+    std::shared_ptr<ImageProvider::LoadingImageObject> firstLoading;
+    std::shared_ptr<ImageProvider::LoadingImageObject> secondLoading;
+    bool isLoading = true;
+    auto firstWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY, callback, firstLoading, isLoading);
+    EXPECT_FALSE(isLoading);
+    auto secondWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY, callback, secondLoading, isLoading);
+    EXPECT_TRUE(isLoading);
+    EXPECT_EQ(firstLoading, secondLoading);
+
+    /**
+     * @tc.steps: step2. start and finish the load, then deliver the result.
+     * @tc.expected: step2. both requests get it, a later request starts a new load.
+     */
+    EXPECT_TRUE(ImageProvider::StartLoadingImageObject(TEST_LOADING_KEY, firstLoading));
+    auto waiters = ImageProvider::FinishLoadingImageObject(TEST_LOADING_KEY, firstLoading);
+    EXPECT_EQ(waiters.size(), 2u);
+    for (const auto& waiter : waiters) {
+        waiter();
+    }
+    EXPECT_EQ(deliveredCount, 2);
+    std::shared_ptr<ImageProvider::LoadingImageObject> nextLoading;
+    auto nextWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY, callback, nextLoading, isLoading);
+    EXPECT_FALSE(isLoading);
+    EXPECT_NE(nextLoading, firstLoading);
+    ImageProvider::FinishLoadingImageObject(TEST_LOADING_KEY, nextLoading);
+}
+
+/**
+ * @tc.name: SharedLoad002
+ * @tc.desc: Cancelling one request of a shared load does not cancel the other one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTest, SharedLoad002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. join the load of the same key twice, then cancel the first request.
+     * @tc.expected: step1. the load still starts.
+     */
+    std::vector<int32_t> delivered;
+    std::shared_ptr<ImageProvider::LoadingImageObject> loading;
+    bool isLoading = false;
+    auto firstWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY,
+        [&delivered](ImageProvider::LoadingImageObject& loaded) { delivered.emplace_back(1); }, loading, isLoading);
+    auto secondWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY,
+        [&delivered](ImageProvider::LoadingImageObject& loaded) { delivered.emplace_back(2); }, loading, isLoading);
+    EXPECT_TRUE(firstWaiter.Cancel());
+    EXPECT_TRUE(ImageProvider::StartLoadingImageObject(TEST_LOADING_KEY, loading));
+
+    /**
+     * @tc.steps: step2. finish the load and deliver the result.
+     * @tc.expected: step2. only the second request gets it.
+     */
+    for (const auto& waiter : ImageProvider::FinishLoadingImageObject(TEST_LOADING_KEY, loading)) {
+        waiter();
+    }
+    EXPECT_EQ(delivered, std::vector<int32_t>({ 2 }));
+}
+
+/**
+ * @tc.name: SharedLoad003
+ * @tc.desc: A shared load is not started when its last request is cancelled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTest, SharedLoad003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. join the load of the same key twice, then cancel both requests.
+     * @tc.expected: step1. the load does not start and is dropped.
+     */
+    int32_t deliveredCount = 0;
+    auto callback = [&deliveredCount](ImageProvider::LoadingImageObject& loaded) { ++deliveredCount; };
+    std::shared_ptr<ImageProvider::LoadingImageObject> loading;
+    bool isLoading = false;
+    auto firstWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY, callback, loading, isLoading);
+    auto secondWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY, callback, loading, isLoading);
+    EXPECT_TRUE(firstWaiter.Cancel());
+    EXPECT_TRUE(secondWaiter.Cancel());
+    EXPECT_FALSE(ImageProvider::StartLoadingImageObject(TEST_LOADING_KEY, loading));
+    EXPECT_EQ(ImageProvider::loadingImageObjects_.count(TEST_LOADING_KEY), 0u);
+
+    /**
+     * @tc.steps: step2. join the load of the key again.
+     * @tc.expected: step2. a new load is created, the cancelled requests get nothing.
+     */
+    std::shared_ptr<ImageProvider::LoadingImageObject> nextLoading;
+    auto nextWaiter = ImageProvider::JoinLoadingImageObject(TEST_LOADING_KEY, callback, nextLoading, isLoading);
+    EXPECT_FALSE(isLoading);
+    for (const auto& waiter : ImageProvider::FinishLoadingImageObject(TEST_LOADING_KEY, nextLoading)) {
+        waiter();
+    }
+    EXPECT_EQ(deliveredCount, 1);
+}
+
+} // namespace OHOS::Ace
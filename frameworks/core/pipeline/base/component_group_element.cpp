@@ -15,15 +15,81 @@
 
 #include "core/pipeline/base/component_group_element.h"
 
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "base/log/log.h"
 #include "base/utils/macros.h"
 #include "base/utils/utils.h"
 #include "core/common/frontend.h"
 #include "core/pipeline/base/component_group.h"
+#include "core/pipeline/base/composed_component.h"
 #include "core/pipeline/base/composed_element.h"
 #include "core/pipeline/base/multi_composed_component.h"
 
 namespace OHOS::Ace {
+namespace {
+
+const ComposeId EMPTY_COMPOSE_ID;
+
+// Children are identified by the id of their composed component, the others can only be matched by position.
+const ComposeId& GetComposeId(const RefPtr<Component>& component)
+{
+    auto composed = AceType::DynamicCast<BaseComposedComponent>(AceType::RawPtr(component));
+    return composed ? composed->GetId() : EMPTY_COMPOSE_ID;
+}
+
+const ComposeId& GetComposeId(const RefPtr<Element>& element)
+{
+    auto composed = AceType::DynamicCast<ComposedElement>(AceType::RawPtr(element));
+    return composed ? composed->GetId() : EMPTY_COMPOSE_ID;
+}
+
+// Render nodes of a child are consecutive in the render node of the group, this is the first one.
+RefPtr<RenderNode> GetFirstRenderNode(const RefPtr<Element>& element)
+{
+    if (element->GetType() == Element::RENDER_ELEMENT) {
+        return element->GetRenderNode();
+    }
+    for (const auto& child : element->GetChildren()) {
+        auto renderNode = GetFirstRenderNode(child);
+        if (renderNode) {
+            return renderNode;
+        }
+    }
+    return nullptr;
+}
+
+// Marks the entries forming the longest increasing subsequence of old indexes, unmatched entries are negative.
+std::vector<bool> GetLongestIncreasingSubsequence(const std::vector<int32_t>& oldIndexes)
+{
+    std::vector<int32_t> tails;
+    std::vector<int32_t> previous(oldIndexes.size(), -1);
+    for (int32_t i = 0; i < static_cast<int32_t>(oldIndexes.size()); ++i) {
+        if (oldIndexes[i] < 0) {
+            continue;
+        }
+        auto it = std::lower_bound(tails.begin(), tails.end(), oldIndexes[i],
+            [&oldIndexes](int32_t index, int32_t value) { return oldIndexes[index] < value; });
+        if (it != tails.begin()) {
+            previous[i] = *(it - 1);
+        }
+        if (it == tails.end()) {
+            tails.emplace_back(i);
+        } else {
+            *it = i;
+        }
+    }
+    std::vector<bool> result(oldIndexes.size(), false);
+    for (int32_t i = tails.empty() ? -1 : tails.back(); i >= 0; i = previous[i]) {
+        result[i] = true;
+    }
+    return result;
+}
+
+} // namespace
 
 RefPtr<Element> ComponentGroupElement::Create()
 {
@@ -54,6 +120,10 @@ void ComponentGroupElement::PerformBuild()
 
 void ComponentGroupElement::UpdateChildren(const std::list<RefPtr<Component>>& newComponents)
 {
+    if (UpdateChildrenByKey(newComponents, false)) {
+        return;
+    }
+
     auto itChild = children_.begin();
     auto itChildEnd = children_.end();
     auto itComponent = newComponents.begin();
@@ -97,6 +167,9 @@ void ComponentGroupElement::UpdateChildrenForDeclarative(const std::list<RefPtr<
     // For declarative frontend, the component tree is very stable,
     // so size of children MUST be matched between elements and components
     if (children_.size() != newComponents.size()) {
+        if (UpdateChildrenByKey(newComponents, true)) {
+            return;
+        }
         LOGW("Size of old children and new components are mismatched");
         return;
     }
@@ -107,4 +180,136 @@ void ComponentGroupElement::UpdateChildrenForDeclarative(const std::list<RefPtr<
     }
 }
 
+bool ComponentGroupElement::UpdateChildrenByKey(
+    const std::list<RefPtr<Component>>& newComponents, bool isDeclarative)
+{
+    // Keys must be present and unique on both sides, otherwise children are matched by position.
+    std::vector<RefPtr<Element>> oldChildren(children_.begin(), children_.end());
+    std::unordered_map<std::string_view, int32_t> oldIndexes;
+    int32_t renderCount = 0;
+    for (int32_t i = 0; i < static_cast<int32_t>(oldChildren.size()); ++i) {
+        const auto& key = GetComposeId(oldChildren[i]);
+        if (key.empty() || !oldIndexes.emplace(key, i).second) {
+            return false;
+        }
+        renderCount += oldChildren[i]->CountRenderNode();
+    }
+    std::vector<RefPtr<Component>> components(newComponents.begin(), newComponents.end());
+    std::vector<int32_t> matchedIndexes(components.size(), -1);
+    std::unordered_set<std::string_view> newKeys;
+    bool hasMatched = false;
+    bool isSamePosition = components.size() == oldChildren.size();
+    for (int32_t i = 0; i < static_cast<int32_t>(components.size()); ++i) {
+        const auto& key = GetComposeId(components[i]);
+        if (key.empty() || !newKeys.emplace(key).second) {
+            return false;
+        }
+        auto it = oldIndexes.find(key);
+        if (it != oldIndexes.end() && oldChildren[it->second]->CanUpdate(components[i])) {
+            matchedIndexes[i] = it->second;
+            hasMatched = true;
+        }
+        isSamePosition = isSamePosition && matchedIndexes[i] == i;
+    }
+    // Without any match the ids don't identify the children (e.g. generated for each render), reusing elements by
+    // position is cheaper than rebuilding all of them.
+    if (isSamePosition || !hasMatched) {
+        return false;
+    }
+    // Moving render nodes relies on them being laid out in the same order as the children.
+    auto renderNode = GetRenderNode();
+    if (!renderNode || renderNode->GetChildren().size() != static_cast<size_t>(renderCount)) {
+        return false;
+    }
+
+    // 1. Remove the children which are not reused.
+    std::vector<bool> isReused(oldChildren.size(), false);
+    for (auto index : matchedIndexes) {
+        if (index >= 0) {
+            isReused[index] = true;
+        }
+    }
+    for (size_t i = 0; i < oldChildren.size(); ++i) {
+        if (!isReused[i]) {
+            UpdateChildWithSlot(oldChildren[i], nullptr, DEFAULT_ELEMENT_SLOT, DEFAULT_RENDER_SLOT);
+        }
+    }
+
+    // 2. Children on the longest increasing subsequence of old positions stay, the others are moved in place
+    //    from the back, so each one is moved at most once.
+    auto isStable = GetLongestIncreasingSubsequence(matchedIndexes);
+    RefPtr<Element> anchor;
+    RefPtr<Element> renderAnchor;
+    bool isMoved = false;
+    for (int32_t i = static_cast<int32_t>(matchedIndexes.size()) - 1; i >= 0; --i) {
+        if (matchedIndexes[i] < 0) {
+            continue;
+        }
+        const auto& child = oldChildren[matchedIndexes[i]];
+        if (!isStable[i]) {
+            MoveChildBefore(child, anchor, renderAnchor);
+            isMoved = true;
+        }
+        anchor = child;
+        if (child->CountRenderNode() > 0) {
+            renderAnchor = child;
+        }
+    }
+    if (isMoved) {
+        auto context = context_.Upgrade();
+        auto needRebuildFocusElement = AceType::DynamicCast<Element>(GetFocusScope());
+        if (context && needRebuildFocusElement) {
+            context->AddNeedRebuildFocusElement(needRebuildFocusElement);
+        }
+    }
+
+    // 3. Update the reused children and inflate the new ones at their slots.
+    int32_t slot = 0;
+    int32_t renderSlot = 0;
+    for (size_t i = 0; i < components.size(); ++i) {
+        const auto& component = components[i];
+        RefPtr<Element> child = matchedIndexes[i] >= 0 ? oldChildren[matchedIndexes[i]] : nullptr;
+        if (isDeclarative) {
+            child = UpdateChildWithSlot(child, component, slot, renderSlot);
+        } else if (child) {
+            // Children are already in place, the slots are only recorded.
+            if (child->NeedUpdateWithComponent(component)) {
+                child = UpdateChildWithSlot(child, component, slot, renderSlot);
+            } else {
+                child->SetSlot(slot);
+                child->SetRenderSlot(renderSlot);
+            }
+        } else {
+            child = UpdateChildWithSlot(nullptr, component, slot, renderSlot);
+            // Render nodes of composed children are appended when built, move them to their slot.
+            if (child) {
+                ChangeChildRenderSlot(child, renderSlot, true);
+            }
+        }
+        ++slot;
+        renderSlot += child ? child->CountRenderNode() : 0;
+    }
+    return true;
+}
+
+void ComponentGroupElement::MoveChildBefore(
+    const RefPtr<Element>& child, const RefPtr<Element>& anchor, const RefPtr<Element>& renderAnchor)
+{
+    auto itChild = std::find(children_.begin(), children_.end(), child);
+    if (itChild == children_.end()) {
+        return;
+    }
+    auto itAnchor = anchor ? std::find(children_.begin(), children_.end(), anchor) : children_.end();
+    children_.splice(itAnchor, children_, itChild);
+
+    int32_t count = child->CountRenderNode();
+    auto renderNode = GetRenderNode();
+    if (count <= 0 || !renderNode) {
+        return;
+    }
+    // Render nodes of the child are moved as one block, so a child with several render nodes keeps their order.
+    renderNode->MoveChildren(
+        GetFirstRenderNode(child), count, renderAnchor ? GetFirstRenderNode(renderAnchor) : nullptr);
+}
+
 } // namespace OHOS::Ace
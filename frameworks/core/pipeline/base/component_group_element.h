@@ -35,6 +35,9 @@ public:
 private:
     void UpdateChildren(const std::list<RefPtr<Component>>& newComponents);
     void UpdateChildrenForDeclarative(const std::list<RefPtr<Component>>& newComponents);
+    bool UpdateChildrenByKey(const std::list<RefPtr<Component>>& newComponents, bool isDeclarative);
+    void MoveChildBefore(const RefPtr<Element>& child, const RefPtr<Element>& anchor,
+        const RefPtr<Element>& renderAnchor);
 };
 
 } // namespace OHOS::Ace
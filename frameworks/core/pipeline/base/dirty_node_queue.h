@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_DIRTY_NODE_QUEUE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_DIRTY_NODE_QUEUE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+
+namespace OHOS::Ace {
+
+// Each dirty queue owns one bit of the node's queued flags, a node is in a queue at most once.
+enum DirtyQueueFlag : uint8_t {
+    DIRTY_QUEUE_BUILD = 1 << 0,
+    DIRTY_QUEUE_RENDER = 1 << 1,
+    DIRTY_QUEUE_RENDER_IN_OVERLAY = 1 << 2,
+    DIRTY_QUEUE_LAYOUT = 1 << 3,
+    DIRTY_QUEUE_PREDICT_LAYOUT = 1 << 4,
+    DIRTY_QUEUE_PAINT_FINISH = 1 << 5,
+    DIRTY_QUEUE_GEOMETRY_CHANGED = 1 << 6,
+};
+
+// Queue of dirty nodes bucketed by tree depth, so nodes come out parent before child. Duplicates are filtered by
+// the flag stored in the node itself, which makes Push() O(1). Buckets keep their capacity across frames, and
+// storage of a flushed batch can be handed back with Recycle(), so steady state flushes don't allocate.
+// NodeType must provide GetDepth(), IsInDirtyQueue(uint8_t) and SetInDirtyQueue(uint8_t, bool).
+template<typename NodeType, typename HolderType = RefPtr<NodeType>>
+class DirtyNodeQueue final {
+public:
+    explicit DirtyNodeQueue(DirtyQueueFlag flag) : flag_(flag) {}
+    ~DirtyNodeQueue()
+    {
+        Clear();
+    }
+
+    void Push(const RefPtr<NodeType>& node)
+    {
+        if (!node || node->IsInDirtyQueue(flag_)) {
+            return;
+        }
+        node->SetInDirtyQueue(flag_, true);
+        auto depth = static_cast<size_t>(std::max(node->GetDepth(), 0));
+        if (depth >= buckets_.size()) {
+            buckets_.resize(depth + 1);
+        }
+        buckets_[depth].emplace_back(node);
+        ++size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    // Moves all nodes out ordered by depth. The queue is empty afterwards, nodes may be pushed again while the
+    // returned batch is processed.
+    std::vector<HolderType> TakeAll()
+    {
+        std::vector<HolderType> nodes;
+        nodes.swap(spare_);
+        nodes.reserve(size_);
+        for (auto& bucket : buckets_) {
+            for (auto& holder : bucket) {
+                const auto& node = Lock(holder);
+                if (node) {
+                    node->SetInDirtyQueue(flag_, false);
+                }
+                nodes.emplace_back(std::move(holder));
+            }
+            bucket.clear();
+        }
+        size_ = 0;
+        return nodes;
+    }
+
+    // Gives back the storage of a batch returned by TakeAll(), releasing the nodes it holds.
+    void Recycle(std::vector<HolderType>&& nodes)
+    {
+        nodes.clear();
+        if (nodes.capacity() > spare_.capacity()) {
+            spare_.swap(nodes);
+        }
+    }
+
+    template<typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (const auto& bucket : buckets_) {
+            for (const auto& holder : bucket) {
+                func(holder);
+            }
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& bucket : buckets_) {
+            for (const auto& holder : bucket) {
+                const auto& node = Lock(holder);
+                if (node) {
+                    node->SetInDirtyQueue(flag_, false);
+                }
+            }
+            bucket.clear();
+        }
+        size_ = 0;
+    }
+
+private:
+    static const RefPtr<NodeType>& Lock(const RefPtr<NodeType>& node)
+    {
+        return node;
+    }
+
+    static RefPtr<NodeType> Lock(const WeakPtr<NodeType>& node)
+    {
+        return node.Upgrade();
+    }
+
+    DirtyQueueFlag flag_;
+    size_t size_ = 0;
+    std::vector<std::vector<HolderType>> buckets_;
+    std::vector<HolderType> spare_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(DirtyNodeQueue);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_DIRTY_NODE_QUEUE_H
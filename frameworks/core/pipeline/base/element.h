@@ -97,6 +97,20 @@ public:
         return depth_;
     }
 
+    bool IsInDirtyQueue(uint8_t flag) const
+    {
+        return (dirtyQueueFlags_ & flag) != 0;
+    }
+
+    void SetInDirtyQueue(uint8_t flag, bool inQueue)
+    {
+        if (inQueue) {
+            dirtyQueueFlags_ |= flag;
+        } else {
+            dirtyQueueFlags_ &= static_cast<uint8_t>(~flag);
+        }
+    }
+
     void SetPipelineContext(const WeakPtr<PipelineContext>& context);
 
     enum ElementType {
@@ -279,12 +293,14 @@ protected:
     IdType componentTypeId_ = 0;
     bool active_ = false;
 
-private:
     void ChangeChildSlot(const RefPtr<Element>& child, int32_t slot);
     void ChangeChildRenderSlot(const RefPtr<Element>& child, int32_t renderSlot, bool effectDescendant);
 
+private:
     WeakPtr<Element> parent_;
     int32_t depth_ = 0;
+    // Bits of DirtyQueueFlag, set while the element is waiting in the pipeline's dirty queue.
+    uint8_t dirtyQueueFlags_ = 0;
     int32_t slot_ = DEFAULT_ELEMENT_SLOT;
     int32_t renderSlot_ = DEFAULT_RENDER_SLOT;
     bool autoAccessibility_ = true;
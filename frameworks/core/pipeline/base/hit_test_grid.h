@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_HIT_TEST_GRID_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_HIT_TEST_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "base/geometry/point.h"
+#include "base/geometry/rect.h"
+
+namespace OHOS::Ace {
+
+// Uniform grid over the touch rects of a group of sibling nodes, used to find the few children that may contain a
+// point without testing all of them. Items are identified by their index and must be given in ascending z-order, so
+// every candidate list is z-ordered as well.
+class HitTestGrid final {
+public:
+    // Item with a null rect list can't be located by rect (e.g. it transforms the point), it is always a candidate.
+    void Build(const std::vector<const std::vector<Rect>*>& items)
+    {
+        cells_.clear();
+        unbounded_.clear();
+
+        bool hasBounds = false;
+        for (const auto* rects : items) {
+            if (!rects) {
+                continue;
+            }
+            for (const auto& rect : *rects) {
+                bounds_ = hasBounds ? bounds_.CombineRect(rect) : rect;
+                hasBounds = true;
+            }
+        }
+        if (!hasBounds) {
+            bounds_ = Rect();
+        }
+
+        int32_t side = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<double>(items.size()))));
+        side = std::clamp(side, 1, MAX_GRID_SIDE);
+        cols_ = Positive(bounds_.Width()) ? side : 1;
+        rows_ = Positive(bounds_.Height()) ? side : 1;
+        cellWidth_ = bounds_.Width() / cols_;
+        cellHeight_ = bounds_.Height() / rows_;
+        cells_.resize(static_cast<size_t>(cols_ * rows_));
+
+        for (uint32_t index = 0; index < items.size(); ++index) {
+            const auto* rects = items[index];
+            if (!rects) {
+                unbounded_.emplace_back(index);
+                for (auto& cell : cells_) {
+                    cell.emplace_back(index);
+                }
+                continue;
+            }
+            for (const auto& rect : *rects) {
+                AddRect(index, rect);
+            }
+        }
+    }
+
+    // Returns indexes of the items which may contain the point, in ascending z-order.
+    const std::vector<uint32_t>& Query(const Point& point) const
+    {
+        if (cells_.empty() || point.GetX() < bounds_.Left() || point.GetX() >= bounds_.Right() ||
+            point.GetY() < bounds_.Top() || point.GetY() >= bounds_.Bottom()) {
+            return unbounded_;
+        }
+        return cells_[CellIndex(ColumnOf(point.GetX()), RowOf(point.GetY()))];
+    }
+
+private:
+    static bool Positive(double value)
+    {
+        return value > 0.0;
+    }
+
+    void AddRect(uint32_t index, const Rect& rect)
+    {
+        int32_t colStart = ColumnOf(rect.Left());
+        int32_t colEnd = ColumnOf(rect.Right());
+        int32_t rowStart = RowOf(rect.Top());
+        int32_t rowEnd = RowOf(rect.Bottom());
+        for (int32_t row = rowStart; row <= rowEnd; ++row) {
+            for (int32_t col = colStart; col <= colEnd; ++col) {
+                auto& cell = cells_[CellIndex(col, row)];
+                // Items come in ascending order, only the last one may be a duplicate from another rect.
+                if (cell.empty() || cell.back() != index) {
+                    cell.emplace_back(index);
+                }
+            }
+        }
+    }
+
+    int32_t ColumnOf(double x) const
+    {
+        if (!Positive(cellWidth_)) {
+            return 0;
+        }
+        return std::clamp(static_cast<int32_t>(std::floor((x - bounds_.Left()) / cellWidth_)), 0, cols_ - 1);
+    }
+
+    int32_t RowOf(double y) const
+    {
+        if (!Positive(cellHeight_)) {
+            return 0;
+        }
+        return std::clamp(static_cast<int32_t>(std::floor((y - bounds_.Top()) / cellHeight_)), 0, rows_ - 1);
+    }
+
+    size_t CellIndex(int32_t col, int32_t row) const
+    {
+        return static_cast<size_t>(row * cols_ + col);
+    }
+
+    static constexpr int32_t MAX_GRID_SIDE = 32;
+
+    Rect bounds_;
+    int32_t cols_ = 1;
+    int32_t rows_ = 1;
+    double cellWidth_ = 0.0;
+    double cellHeight_ = 0.0;
+    std::vector<std::vector<uint32_t>> cells_;
+    std::vector<uint32_t> unbounded_;
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_HIT_TEST_GRID_H
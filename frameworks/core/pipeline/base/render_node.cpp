@@ -48,6 +48,8 @@ namespace {
 
 constexpr float PRESS_KEYFRAME_START = 0.0f;
 constexpr float PRESS_KEYFRAME_END = 1.0f;
+constexpr size_t HIT_TEST_GRID_MIN_CHILDREN = 16;
+constexpr size_t MEASURE_CACHE_SIZE = 4;
 
 struct ZIndexCompartor {
     bool operator()(const RefPtr<RenderNode>& left, const RefPtr<RenderNode>& right) const
@@ -62,6 +64,12 @@ inline std::multiset<RefPtr<RenderNode>, ZIndexCompartor> SortChildrenByZIndex(
     return std::multiset<RefPtr<RenderNode>, ZIndexCompartor>(children.begin(), children.end());
 }
 
+inline bool HasZIndexChild(const std::list<RefPtr<RenderNode>>& children)
+{
+    return std::any_of(children.begin(), children.end(),
+        [](const RefPtr<RenderNode>& child) { return child->GetZIndex() != 0; });
+}
+
 } // namespace
 
 constexpr Dimension FOCUS_BOUNDARY = 4.0_vp; // focus padding + effect boundary, VP
@@ -127,6 +135,7 @@ void RenderNode::AddChild(const RefPtr<RenderNode>& child, int32_t slot)
     auto pos = children_.begin();
     std::advance(pos, slot);
     children_.insert(pos, child);
+    MarkChildrenZIndexDirty();
     child->SetParent(AceType::WeakClaim(this));
     auto context = context_.Upgrade();
     if (context && context->GetTransparentHole().IsValid()) {
@@ -159,6 +168,10 @@ void RenderNode::RemoveChild(const RefPtr<RenderNode>& child)
             return;
         } else {
             children_.erase(it);
+            // Don't keep removed child alive in the caches, callers iterating them hold their own reference.
+            zIndexSortedChildren_.reset();
+            hitTestGridChildren_.reset();
+            MarkChildrenZIndexDirty();
         }
     }
 
@@ -209,7 +222,7 @@ void RenderNode::MovePosition(int32_t slot)
         if (itSelf != children.end()) {
             children.erase(itSelf);
         } else {
-            LOGW("Should NOT be here");
+            // Moving forward, self is in front of the target position.
             children.remove(self);
             ++it;
         }
@@ -217,11 +230,111 @@ void RenderNode::MovePosition(int32_t slot)
         children.remove(self);
     }
     children.insert(it, self);
+    parentNode->MarkChildrenZIndexDirty();
+}
+
+void RenderNode::MoveChildren(const RefPtr<RenderNode>& first, int32_t count, const RefPtr<RenderNode>& before)
+{
+    auto begin = std::find(children_.begin(), children_.end(), first);
+    if (begin == children_.end() || count <= 0) {
+        return;
+    }
+    auto end = begin;
+    for (int32_t i = 0; i < count && end != children_.end(); ++i) {
+        ++end;
+    }
+    // Take the block out first, so the target is found among the remaining children.
+    std::list<RefPtr<RenderNode>> movingChildren;
+    movingChildren.splice(movingChildren.end(), children_, begin, end);
+    auto target = before ? std::find(children_.begin(), children_.end(), before) : children_.end();
+    children_.splice(target, movingChildren);
+    MarkChildrenZIndexDirty();
 }
 
 void RenderNode::ClearChildren()
 {
     children_.clear();
+    zIndexSortedChildren_.reset();
+    hitTestGridChildren_.reset();
+    MarkChildrenZIndexDirty();
+}
+
+RenderNode::ChildrenSnapshot RenderNode::GetChildrenSortedByZIndex()
+{
+    if (zIndexOrderDirty_ || !zIndexSortedChildren_) {
+        zIndexOrderDirty_ = false;
+        // A new list is built, so a list returned before stays the same for the callers still iterating it.
+        auto sortedChildren = std::make_shared<std::list<RefPtr<RenderNode>>>(GetChildren());
+        if (HasZIndexChild(*sortedChildren)) {
+            // std::list::sort is stable, children with same zIndex keep their original order.
+            sortedChildren->sort(ZIndexCompartor());
+        }
+        zIndexSortedChildren_ = std::move(sortedChildren);
+    }
+    return zIndexSortedChildren_;
+}
+
+const std::vector<uint32_t>* RenderNode::QueryHitTestCandidates(const Point& localPoint)
+{
+    if (hitTestGridInUse_ || &GetChildren() != &children_ || children_.size() < HIT_TEST_GRID_MIN_CHILDREN) {
+        return nullptr;
+    }
+    if (!hitTestGrid_ || hitTestGridDirty_) {
+        BuildHitTestGrid();
+        hitTestGridDirty_ = false;
+    }
+    return &hitTestGrid_->Query(localPoint);
+}
+
+void RenderNode::BuildHitTestGrid()
+{
+    hitTestGridChildren_ = GetChildrenSortedByZIndex();
+    const auto& sortedChildren = *hitTestGridChildren_;
+    hitTestGridNodes_.clear();
+    hitTestGridNodes_.reserve(sortedChildren.size());
+    std::vector<const std::vector<Rect>*> items;
+    items.reserve(sortedChildren.size());
+    for (const auto& child : sortedChildren) {
+        hitTestGridNodes_.emplace_back(AceType::RawPtr(child));
+        // Transform node tests the point after its own transformation, so it can't be located by its rects.
+        if (AceType::InstanceOf<RenderTransform>(child)) {
+            items.emplace_back(nullptr);
+        } else {
+            items.emplace_back(&child->GetTouchRectList());
+        }
+    }
+    if (!hitTestGrid_) {
+        hitTestGrid_ = std::make_unique<HitTestGrid>();
+    }
+    hitTestGrid_->Build(items);
+}
+
+template<typename Visit>
+void RenderNode::VisitHitTestChildren(const Point& localPoint, Visit&& visit)
+{
+    const auto* candidates = QueryHitTestCandidates(localPoint);
+    if (candidates) {
+        // Children of the grid are kept alive and the grid is not rebuilt while they are visited.
+        auto gridChildren = hitTestGridChildren_;
+        hitTestGridInUse_ = true;
+        for (auto iter = candidates->rbegin(); iter != candidates->rend(); ++iter) {
+            visit(hitTestGridNodes_[*iter]);
+        }
+        hitTestGridInUse_ = false;
+        return;
+    }
+    auto sortedChildren = GetChildrenSortedByZIndex();
+    for (auto iter = sortedChildren->rbegin(); iter != sortedChildren->rend(); ++iter) {
+        visit(AceType::RawPtr(*iter));
+    }
+}
+
+void RenderNode::MarkParentHitTestGridDirty()
+{
+    auto parent = parent_.Upgrade();
+    if (parent) {
+        parent->hitTestGridDirty_ = true;
+    }
 }
 
 void RenderNode::UpdateTouchRect()
@@ -427,8 +540,8 @@ void RenderNode::NotifyPaintFinish()
 
 void RenderNode::Paint(RenderContext& context, const Offset& offset)
 {
-    const auto& children = GetChildren();
-    for (const auto& item : SortChildrenByZIndex(children)) {
+    auto sortedChildren = GetChildrenSortedByZIndex();
+    for (const auto& item : *sortedChildren) {
         PaintChild(item, context, offset);
     }
 }
@@ -476,6 +589,8 @@ void RenderNode::MarkNeedLayout(bool selfOnly, bool forceParent)
         }
     }
     if (addSelf) {
+        // Ancestors above the relayout root are not laid out again, but their measured sizes depend on this subtree.
+        ClearAncestorMeasureCaches();
         auto pipelineContext = context_.Upgrade();
         if (pipelineContext != nullptr) {
             pipelineContext->AddDirtyLayoutNode(AceType::Claim(this));
@@ -483,6 +598,15 @@ void RenderNode::MarkNeedLayout(bool selfOnly, bool forceParent)
     }
 }
 
+void RenderNode::ClearAncestorMeasureCaches()
+{
+    auto parent = parent_.Upgrade();
+    while (parent) {
+        parent->measureCache_.clear();
+        parent = parent->parent_.Upgrade();
+    }
+}
+
 void RenderNode::MarkNeedPredictLayout()
 {
     auto pipelineContext = context_.Upgrade();
@@ -498,17 +622,80 @@ void RenderNode::OnLayout()
         Size parentViewPort = parent->GetChildViewPort();
         if (viewPort_ != parentViewPort) {
             viewPort_ = parentViewPort;
-            needLayout_ = true;
+            SetNeedLayout(true);
         }
     }
     if (NeedLayout()) {
         PrepareLayout();
         PerformLayout();
+        // Children may have moved, and layout may change touch rects without changing the paint rect.
+        hitTestGridDirty_ = true;
+        if (parent) {
+            parent->hitTestGridDirty_ = true;
+        }
         layoutParamChanged_ = false;
         SetNeedLayout(false);
+        UpdateMeasureCache();
         pendingDispatchLayoutReady_ = true;
         MarkNeedRender();
     }
+    if (!measureCachedChildren_.empty()) {
+        decltype(measureCachedChildren_) children(std::move(measureCachedChildren_));
+        for (const auto& weakChild : children) {
+            auto child = weakChild.Upgrade();
+            if (child) {
+                child->EnsureLayoutCommitted();
+            }
+        }
+    }
+}
+
+void RenderNode::EnsureLayoutCommitted()
+{
+    if (needLayout_ || layoutParam_ == performedLayoutParam_) {
+        return;
+    }
+    // Set the flag directly, SetNeedLayout() would drop the measure cache.
+    needLayout_ = true;
+    OnLayout();
+}
+
+bool RenderNode::ApplyMeasureCache()
+{
+    if (measureCache_.empty()) {
+        return false;
+    }
+    auto parent = parent_.Upgrade();
+    if (!parent || !parent->AllowChildMeasureCache() || viewPort_ != parent->GetChildViewPort()) {
+        return false;
+    }
+    auto iter = std::find_if(measureCache_.begin(), measureCache_.end(),
+        [this](const std::pair<LayoutParam, Size>& entry) { return entry.first == layoutParam_; });
+    if (iter == measureCache_.end()) {
+        return false;
+    }
+    SetLayoutSize(iter->second);
+    // The subtree was not laid out again, its param changed only if it differs from the performed one, which also
+    // clears the flag left by an earlier hit when the param comes back.
+    layoutParamChanged_ = (layoutParam_ != performedLayoutParam_);
+    if (layoutParamChanged_) {
+        // Subtree is still laid out for another param, parent will fix it up after its own layout.
+        parent->measureCachedChildren_.emplace_back(AceType::WeakClaim(this));
+    }
+    return true;
+}
+
+void RenderNode::UpdateMeasureCache()
+{
+    performedLayoutParam_ = layoutParam_;
+    auto iter = std::find_if(measureCache_.begin(), measureCache_.end(),
+        [this](const std::pair<LayoutParam, Size>& entry) { return entry.first == layoutParam_; });
+    if (iter != measureCache_.end()) {
+        measureCache_.erase(iter);
+    } else if (measureCache_.size() >= MEASURE_CACHE_SIZE) {
+        measureCache_.erase(measureCache_.begin());
+    }
+    measureCache_.emplace_back(layoutParam_, GetLayoutSize());
 }
 
 void RenderNode::PrepareLayout() {}
@@ -550,7 +737,7 @@ void RenderNode::Attach(const WeakPtr<PipelineContext>& context)
             return;
         }
         parent->MarkNeedRender();
-        render->needUpdateTouchRect_ = true;
+        render->MarkNeedUpdateTouchRect(true);
         render->nonStrictPaintRect_.SetLeft(render->paintX_.Value());
         render->OnGlobalPositionChanged();
     });
@@ -565,7 +752,7 @@ void RenderNode::Attach(const WeakPtr<PipelineContext>& context)
             return;
         }
         parent->MarkNeedRender();
-        render->needUpdateTouchRect_ = true;
+        render->MarkNeedUpdateTouchRect(true);
         render->nonStrictPaintRect_.SetTop(render->paintY_.Value());
         render->OnGlobalPositionChanged();
     });
@@ -576,7 +763,7 @@ void RenderNode::Attach(const WeakPtr<PipelineContext>& context)
             return;
         }
         render->MarkNeedRender();
-        render->needUpdateTouchRect_ = true;
+        render->MarkNeedUpdateTouchRect(true);
         render->nonStrictPaintRect_.SetWidth(render->paintW_.Value());
         render->transitionPaintRectSize_.SetWidth(render->paintW_.Value());
         render->MarkNeedSyncGeometryProperties();
@@ -588,7 +775,7 @@ void RenderNode::Attach(const WeakPtr<PipelineContext>& context)
             return;
         }
         render->MarkNeedRender();
-        render->needUpdateTouchRect_ = true;
+        render->MarkNeedUpdateTouchRect(true);
         render->nonStrictPaintRect_.SetHeight(render->paintH_.Value());
         render->transitionPaintRectSize_.SetHeight(render->paintH_.Value());
         render->MarkNeedSyncGeometryProperties();
@@ -607,7 +794,7 @@ void RenderNode::SetPositionInternal(const Offset& offset)
         nonStrictOption_ = context->GetExplicitAnimationOption();
         context->AddLayoutTransitionNode(AceType::Claim(this));
         paintRect_.SetOffset(offset);
-        needUpdateTouchRect_ = true;
+        MarkNeedUpdateTouchRect(true);
         OnPositionChanged();
         OnGlobalPositionChanged();
         MarkNeedSyncGeometryProperties();
@@ -692,9 +879,9 @@ bool RenderNode::TouchTest(const Point& globalPoint, const Point& parentLocalPoi
 
     const auto localPoint = transformPoint - GetPaintRect().GetOffset();
     bool dispatchSuccess = false;
-    const auto& sortedChildren = SortChildrenByZIndex(GetChildren());
+    auto sortedChildren = GetChildrenSortedByZIndex();
     if (IsChildrenTouchEnable()) {
-        for (auto iter = sortedChildren.rbegin(); iter != sortedChildren.rend(); ++iter) {
+        for (auto iter = sortedChildren->rbegin(); iter != sortedChildren->rend(); ++iter) {
             auto& child = *iter;
             if (!child->GetVisible() || child->disabled_ || child->disableTouchEvent_) {
                 continue;
@@ -780,11 +967,8 @@ void RenderNode::MouseTest(const Point& globalPoint, const Point& parentLocalPoi
 
     // Calculates the local point location in this node.
     const auto localPoint = parentLocalPoint - paintRect_.GetOffset();
-    const auto& children = GetChildren();
-    for (auto iter = children.rbegin(); iter != children.rend(); ++iter) {
-        auto& child = *iter;
-        child->MouseTest(globalPoint, localPoint, result);
-    }
+    VisitHitTestChildren(localPoint,
+        [&globalPoint, &localPoint, &result](RenderNode* child) { child->MouseTest(globalPoint, localPoint, result); });
 
     // Calculates the coordinate offset in this node.
     const auto coordinatePoint = globalPoint - localPoint;
@@ -807,14 +991,11 @@ bool RenderNode::MouseDetect(const Point& globalPoint, const Point& parentLocalP
     }
 
     const auto localPoint = transformPoint - GetPaintRect().GetOffset();
-    const auto& sortedChildren = SortChildrenByZIndex(GetChildren());
-    for (auto iter = sortedChildren.rbegin(); iter != sortedChildren.rend(); ++iter) {
-        auto& child = *iter;
-        if (!child->GetVisible() || child->disabled_) {
-            continue;
+    VisitHitTestChildren(localPoint, [&globalPoint, &localPoint, &hoverList, &hoverNode](RenderNode* child) {
+        if (child->GetVisible() && !child->disabled_) {
+            child->MouseDetect(globalPoint, localPoint, hoverList, hoverNode);
         }
-        child->MouseDetect(globalPoint, localPoint, hoverList, hoverNode);
-    }
+    });
 
     auto beforeSize = hoverList.size();
     for (auto& rect : GetTouchRectList()) {
@@ -852,14 +1033,11 @@ bool RenderNode::AxisDetect(const Point& globalPoint, const Point& parentLocalPo
     }
 
     const auto localPoint = transformPoint - GetPaintRect().GetOffset();
-    const auto& sortedChildren = SortChildrenByZIndex(GetChildren());
-    for (auto iter = sortedChildren.rbegin(); iter != sortedChildren.rend(); ++iter) {
-        auto& child = *iter;
-        if (!child->GetVisible() || child->disabled_) {
-            continue;
+    VisitHitTestChildren(localPoint, [&globalPoint, &localPoint, &axisNode, direction](RenderNode* child) {
+        if (child->GetVisible() && !child->disabled_) {
+            child->AxisDetect(globalPoint, localPoint, axisNode, direction);
         }
-        child->AxisDetect(globalPoint, localPoint, axisNode, direction);
-    }
+    });
 
     for (auto& rect : GetTouchRectList()) {
         if (touchable_ && rect.IsInRegion(transformPoint)) {
@@ -1402,6 +1580,9 @@ void RenderNode::ClearRenderObject()
     isTailRenderNode_ = false;
     accessibilityText_ = "";
     layoutParam_ = LayoutParam();
+    performedLayoutParam_ = LayoutParam();
+    measureCache_.clear();
+    measureCachedChildren_.clear();
     paintRect_ = Rect();
     paintX_ = Dimension();
     paintY_ = Dimension();
@@ -1908,7 +2089,7 @@ void RenderNode::SetLayoutSize(const Size& size)
         // get bigger canvas size duration transition.
         transitionPaintRectSize_ = Rect(Offset(), paintRect_.GetSize()).CombineRect(Rect(Offset(), size)).GetSize();
         paintRect_.SetSize(size);
-        needUpdateTouchRect_ = true;
+        MarkNeedUpdateTouchRect(true);
         OnSizeChanged();
         MarkNeedSyncGeometryProperties();
     }
@@ -2034,7 +2215,7 @@ void RenderNode::SetPaintRect(const Rect& rect)
         return;
     }
     paintRect_ = rect;
-    needUpdateTouchRect_ = true;
+    MarkNeedUpdateTouchRect(true);
 
     MarkNeedSyncGeometryProperties();
 }
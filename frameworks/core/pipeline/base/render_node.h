@@ -39,6 +39,7 @@
 #include "core/event/axis_event.h"
 #include "core/event/touch_event.h"
 #include "core/gestures/drag_recognizer.h"
+#include "core/pipeline/base/hit_test_grid.h"
 #include "core/pipeline/base/render_context.h"
 #include "core/pipeline/base/render_layer.h"
 #include "core/pipeline/pipeline_context.h"
@@ -73,7 +74,14 @@ public:
 
     void SetZIndex(int32_t zIndex)
     {
+        if (zIndex_ == zIndex) {
+            return;
+        }
         zIndex_ = zIndex;
+        auto parent = parent_.Upgrade();
+        if (parent) {
+            parent->MarkChildrenZIndexDirty();
+        }
     }
 
     int32_t GetZIndex() const
@@ -97,6 +105,9 @@ public:
 
     void MovePosition(int32_t slot);
 
+    // Moves count children starting from first in front of before, or to the end if before is null.
+    void MoveChildren(const RefPtr<RenderNode>& first, int32_t count, const RefPtr<RenderNode>& before);
+
     void ClearChildren();
 
     virtual void MoveWhenOutOfViewPort(bool hasEffect);
@@ -142,6 +153,10 @@ public:
     void SetNeedLayout(bool needLayout)
     {
         needLayout_ = needLayout;
+        if (needLayout) {
+            // Subtree is dirty, measured results are no longer valid.
+            measureCache_.clear();
+        }
     }
 
     void MarkNeedLayout(bool selfOnly = false, bool forceParent = false);
@@ -178,11 +193,21 @@ public:
 
         bool dipScaleChange = !NearEqual(pipeline->GetDipScale(), dipScale_);
         dipScale_ = pipeline->GetDipScale();
-        if (dipScaleChange || layoutParam_ != layoutParam) {
-            layoutParam_ = layoutParam;
+        if (dipScaleChange) {
             layoutParamChanged_ = true;
             SetNeedLayout(true);
         }
+        if (layoutParam_ != layoutParam) {
+            layoutParam_ = layoutParam;
+            layoutParamChanged_ = true;
+            if (!needLayout_ && ApplyMeasureCache()) {
+                if (onChangeCallback_) {
+                    onChangeCallback_();
+                }
+                return;
+            }
+            needLayout_ = true;
+        }
 
         if (onChangeCallback_) {
             onChangeCallback_();
@@ -190,6 +215,17 @@ public:
         OnLayout();
     }
 
+    // Whether children may skip PerformLayout by reusing a size measured with the same layout param. A parent
+    // allowing this must only read the size of children in its own PerformLayout, the rest of their state is
+    // brought up to date after it.
+    virtual bool AllowChildMeasureCache() const
+    {
+        return false;
+    }
+
+    // Performs the layout skipped by the measure cache, so that the subtree matches the current layout param.
+    void EnsureLayoutCommitted();
+
     // Called by parent to update layout param without PerformLayout.
     void SetLayoutParam(const LayoutParam& layoutParam)
     {
@@ -262,6 +298,7 @@ public:
     void ChangeTouchRectList(std::vector<Rect>& touchRectList)
     {
         touchRectList_ = touchRectList;
+        MarkParentHitTestGridDirty();
     }
 
     bool InTouchRectList(const Point& parentLocalPoint, const std::vector<Rect>& touchRectList) const
@@ -306,11 +343,15 @@ public:
     {
         touchRect_ = rect;
         needUpdateTouchRect_ = false;
+        MarkParentHitTestGridDirty();
     }
 
     void MarkNeedUpdateTouchRect(bool needUpdateTouchRect)
     {
         needUpdateTouchRect_ = needUpdateTouchRect;
+        if (needUpdateTouchRect) {
+            MarkParentHitTestGridDirty();
+        }
     }
 
     virtual void OnChildAdded(const RefPtr<RenderNode>& child)
@@ -364,6 +405,20 @@ public:
         return depth_;
     }
 
+    bool IsInDirtyQueue(uint8_t flag) const
+    {
+        return (dirtyQueueFlags_ & flag) != 0;
+    }
+
+    void SetInDirtyQueue(uint8_t flag, bool inQueue)
+    {
+        if (inQueue) {
+            dirtyQueueFlags_ |= flag;
+        } else {
+            dirtyQueueFlags_ &= static_cast<uint8_t>(~flag);
+        }
+    }
+
     PositionType GetPositionType() const
     {
         return positionParam_.type;
@@ -538,6 +593,19 @@ public:
         return children_;
     }
 
+    // Children in painting order, the ones with higher zIndex come last. The list is cached until the children or
+    // their zIndex change, and is never changed once returned, so callers may iterate it while children are added,
+    // removed or reordered.
+    using ChildrenSnapshot = std::shared_ptr<const std::list<RefPtr<RenderNode>>>;
+    ChildrenSnapshot GetChildrenSortedByZIndex();
+
+    // Subclasses returning their own list from GetChildren() call it whenever that list changes.
+    void MarkChildrenZIndexDirty()
+    {
+        zIndexOrderDirty_ = true;
+        hitTestGridDirty_ = true;
+    }
+
     virtual void NotifyPaintFinish();
 
     virtual void RenderWithContext(RenderContext& context, const Offset& offset);
@@ -1264,6 +1332,19 @@ private:
 
     void SetPositionInternal(const Offset& offset);
     bool InLayoutTransition() const;
+    bool ApplyMeasureCache();
+    void UpdateMeasureCache();
+    void ClearAncestorMeasureCaches();
+    // Children which may contain the local point in z-order, indexes of hitTestGridNodes_. Returns nullptr when
+    // there are too few children to make indexing worthwhile, or the candidates of an earlier query are visited,
+    // then all children should be tested.
+    const std::vector<uint32_t>* QueryHitTestCandidates(const Point& localPoint);
+    void BuildHitTestGrid();
+    // Calls visit with the children which may contain the local point, from the top one down.
+    template<typename Visit>
+    void VisitHitTestChildren(const Point& localPoint, Visit&& visit);
+    // The touch rects of this node are indexed by the hit test grid of its parent.
+    void MarkParentHitTestGridDirty();
     // Sync view hierarchy to RSNode
     void RSNodeAddChild(const RefPtr<RenderNode>& child);
     void MarkParentNeedRender() const;
@@ -1272,9 +1353,17 @@ private:
     std::list<RefPtr<RenderNode>> children_;
     std::string accessibilityText_;
     LayoutParam layoutParam_;
+    // Layout param of the last PerformLayout, the subtree is laid out for this one.
+    LayoutParam performedLayoutParam_;
+    // Sizes measured for recent layout params while the subtree stays clean, most recent at back.
+    std::vector<std::pair<LayoutParam, Size>> measureCache_;
+    // Children which reused a measured size during this node's PerformLayout.
+    std::vector<WeakPtr<RenderNode>> measureCachedChildren_;
     Rect paintRect_;
     WeakPtr<RenderNode> parent_;
     int32_t depth_ = 0;
+    // Bits of DirtyQueueFlag, set while the node is waiting in one of the pipeline's dirty queues.
+    uint8_t dirtyQueueFlags_ = 0;
     bool needRender_ = false;
     bool needLayout_ = false;
     bool visible_ = true;
@@ -1309,6 +1398,17 @@ private:
     // for container, this flag controls only the last child in touch area is consuming event.
     bool exclusiveEventForChild_ = false;
     int32_t zIndex_ = 0;
+    // Cached z-order of the children, only rebuilt when children or their zIndex change.
+    ChildrenSnapshot zIndexSortedChildren_;
+    bool zIndexOrderDirty_ = true;
+    // Spatial index of children touch rects, rebuilt lazily once this node is laid out again, or a child is laid out,
+    // moved or resized, or changes its touch rects.
+    std::unique_ptr<HitTestGrid> hitTestGrid_;
+    // Children the grid is built from, in the order of hitTestGridNodes_, which keeps the raw pointers valid.
+    ChildrenSnapshot hitTestGridChildren_;
+    std::vector<RenderNode*> hitTestGridNodes_;
+    bool hitTestGridDirty_ = true;
+    bool hitTestGridInUse_ = false;
     bool isPercentSize_ = false;
     uint32_t updateType_ = 0;
 
@@ -15,6 +15,7 @@
 
 #include "core/pipeline/pipeline_context.h"
 
+#include <algorithm>
 #include <fstream>
 #include <utility>
 
@@ -35,9 +36,11 @@
 #include "base/log/ace_tracker.h"
 #include "base/log/dump_log.h"
 #include "base/log/event_report.h"
+#include "base/log/frame_profiler.h"
 #include "base/log/frame_report.h"
 #include "base/log/log.h"
 #include "base/ressched/ressched_report.h"
+#include "base/thread/background_task_executor.h"
 #include "base/thread/task_executor.h"
 #include "base/utils/macros.h"
 #include "base/utils/string_utils.h"
@@ -223,13 +226,14 @@ void PipelineContext::FlushBuild()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FrameProfiler::ScopedPhase profilerScope(frameProfiler_, FramePhase::BUILD);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushBuild();
     }
 
     isRebuildFinished_ = false;
-    if (dirtyElements_.empty()) {
+    if (dirtyElements_.Empty()) {
         isRebuildFinished_ = true;
         if (FrameReport::GetInstance().GetEnable()) {
             FrameReport::GetInstance().EndFlushBuild();
@@ -239,7 +243,7 @@ void PipelineContext::FlushBuild()
     if (isFirstLoaded_) {
         LOGI("PipelineContext::FlushBuild()");
     }
-    decltype(dirtyElements_) dirtyElements(std::move(dirtyElements_));
+    auto dirtyElements = dirtyElements_.TakeAll();
     for (const auto& elementWeak : dirtyElements) {
         auto element = elementWeak.Upgrade();
         // maybe unavailable when update parent
@@ -252,6 +256,7 @@ void PipelineContext::FlushBuild()
             }
         }
     }
+    dirtyElements_.Recycle(std::move(dirtyElements));
     isRebuildFinished_ = true;
     if (!buildAfterCallback_.empty()) {
         for (const auto& item : buildAfterCallback_) {
@@ -269,14 +274,15 @@ void PipelineContext::FlushBuild()
 void PipelineContext::FlushPredictLayout(int64_t deadline)
 {
     CHECK_RUN_ON(UI);
-    if (predictLayoutNodes_.empty()) {
+    if (predictLayoutNodes_.Empty()) {
         return;
     }
     ACE_FUNCTION_TRACE();
-    decltype(predictLayoutNodes_) dirtyNodes(std::move(predictLayoutNodes_));
+    auto dirtyNodes = predictLayoutNodes_.TakeAll();
     for (const auto& dirtyNode : dirtyNodes) {
         dirtyNode->OnPredictLayout(deadline);
     }
+    predictLayoutNodes_.Recycle(std::move(dirtyNodes));
 }
 
 void PipelineContext::FlushFocus()
@@ -484,12 +490,13 @@ void PipelineContext::FlushLayout()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FrameProfiler::ScopedPhase profilerScope(frameProfiler_, FramePhase::LAYOUT);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushLayout();
     }
 
-    if (dirtyLayoutNodes_.empty()) {
+    if (dirtyLayoutNodes_.Empty()) {
         FlushGeometryProperties();
         if (FrameReport::GetInstance().GetEnable()) {
             FrameReport::GetInstance().EndFlushLayout();
@@ -499,7 +506,7 @@ void PipelineContext::FlushLayout()
     if (isFirstLoaded_) {
         LOGI("PipelineContext::FlushLayout()");
     }
-    decltype(dirtyLayoutNodes_) dirtyNodes(std::move(dirtyLayoutNodes_));
+    auto dirtyNodes = dirtyLayoutNodes_.TakeAll();
     for (const auto& dirtyNode : dirtyNodes) {
         SaveExplicitAnimationOption(dirtyNode->GetExplicitAnimationOption());
         dirtyNode->OnLayout();
@@ -512,6 +519,7 @@ void PipelineContext::FlushLayout()
     for (const auto& dirtyNode : dirtyNodes) {
         dirtyNode->ClearExplicitAnimationOption();
     }
+    dirtyLayoutNodes_.Recycle(std::move(dirtyNodes));
     alignDeclarationNodeList_.clear();
 
     CreateGeometryTransition();
@@ -524,14 +532,15 @@ void PipelineContext::FlushLayout()
 
 void PipelineContext::FlushGeometryProperties()
 {
-    if (geometryChangedNodes_.empty()) {
+    if (geometryChangedNodes_.Empty()) {
         return;
     }
 
-    decltype(dirtyLayoutNodes_) geometryChangedNodes(std::move(geometryChangedNodes_));
+    auto geometryChangedNodes = geometryChangedNodes_.TakeAll();
     for (const auto& dirtyNode : geometryChangedNodes) {
         dirtyNode->SyncGeometryProperties();
     }
+    geometryChangedNodes_.Recycle(std::move(geometryChangedNodes));
 }
 
 void PipelineContext::CorrectPosition()
@@ -561,12 +570,13 @@ void PipelineContext::FlushRender()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FrameProfiler::ScopedPhase profilerScope(frameProfiler_, FramePhase::RENDER);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushRender();
     }
 
-    if (dirtyRenderNodes_.empty() && dirtyRenderNodesInOverlay_.empty() && !needForcedRefresh_) {
+    if (dirtyRenderNodes_.Empty() && dirtyRenderNodesInOverlay_.Empty() && !needForcedRefresh_) {
         if (FrameReport::GetInstance().GetEnable()) {
             FrameReport::GetInstance().EndFlushRender();
         }
@@ -588,8 +598,8 @@ void PipelineContext::FlushRender()
     if (transparentHole_.IsValid()) {
         context->SetClipHole(transparentHole_);
     }
-    if (!dirtyRenderNodes_.empty()) {
-        decltype(dirtyRenderNodes_) dirtyNodes(std::move(dirtyRenderNodes_));
+    if (!dirtyRenderNodes_.Empty()) {
+        auto dirtyNodes = dirtyRenderNodes_.TakeAll();
         for (const auto& dirtyNode : dirtyNodes) {
             context->Repaint(dirtyNode);
             if (!isDirtyRootRect) {
@@ -602,9 +612,10 @@ void PipelineContext::FlushRender()
                 curDirtyRect = curDirtyRect.IsValid() ? curDirtyRect.CombineRect(curRect) : curRect;
             }
         }
+        dirtyRenderNodes_.Recycle(std::move(dirtyNodes));
     }
-    if (!dirtyRenderNodesInOverlay_.empty()) {
-        decltype(dirtyRenderNodesInOverlay_) dirtyNodesInOverlay(std::move(dirtyRenderNodesInOverlay_));
+    if (!dirtyRenderNodesInOverlay_.Empty()) {
+        auto dirtyNodesInOverlay = dirtyRenderNodesInOverlay_.TakeAll();
         for (const auto& dirtyNodeInOverlay : dirtyNodesInOverlay) {
             context->Repaint(dirtyNodeInOverlay);
             if (!isDirtyRootRect) {
@@ -617,6 +628,7 @@ void PipelineContext::FlushRender()
                 curDirtyRect = curDirtyRect.IsValid() ? curDirtyRect.CombineRect(curRect) : curRect;
             }
         }
+        dirtyRenderNodesInOverlay_.Recycle(std::move(dirtyNodesInOverlay));
     }
 
     NotifyDrawOnPixelMap();
@@ -643,15 +655,17 @@ void PipelineContext::FlushRenderFinish()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FrameProfiler::ScopedPhase profilerScope(frameProfiler_, FramePhase::RENDER_FINISH);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushRenderFinish();
     }
-    if (!needPaintFinishNodes_.empty()) {
-        decltype(needPaintFinishNodes_) Nodes(std::move(needPaintFinishNodes_));
-        for (const auto& node : Nodes) {
+    if (!needPaintFinishNodes_.Empty()) {
+        auto nodes = needPaintFinishNodes_.TakeAll();
+        for (const auto& node : nodes) {
             node->OnPaintFinish();
         }
+        needPaintFinishNodes_.Recycle(std::move(nodes));
     }
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().EndFlushRenderFinish();
@@ -663,6 +677,7 @@ void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FrameProfiler::ScopedPhase profilerScope(frameProfiler_, FramePhase::ANIMATION);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushAnimation();
@@ -678,11 +693,20 @@ void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
         }
         return;
     }
-    decltype(scheduleTasks_) temp(std::move(scheduleTasks_));
-    for (const auto& scheduleTask : temp) {
-        scheduleTask.second->OnFrame(nanoTimestamp);
+    // Tasks added by the callbacks run from the next frame.
+    size_t taskCount = scheduleTasks_.size();
+    for (size_t i = 0; i < taskCount; ++i) {
+        // Hold the task, it may remove itself and drop the last reference.
+        auto scheduleTask = scheduleTasks_[i];
+        if (scheduleTask) {
+            scheduleTask->OnFrame(nanoTimestamp);
+        }
     }
     isFlushingAnimation_ = false;
+    CompactScheduleTasks();
+    if (!scheduleTasks_.empty()) {
+        window_->RequestFrame();
+    }
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().EndFlushAnimation();
@@ -755,6 +779,7 @@ void PipelineContext::ProcessPostFlush()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FrameProfiler::ScopedPhase profilerScope(frameProfiler_, FramePhase::POST_FLUSH);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginProcessPostFlush();
@@ -952,6 +977,26 @@ void PipelineContext::Dump(const std::vector<std::string>& params) const
         EventReport::SendEvent(eventInfo);
     } else if (params[0] == "-threadstuck" && params.size() >= 3) {
         MakeThreadStuck(params);
+    } else if (params[0] == "-frameprofile") {
+        std::vector<std::string> lines;
+        DumpFrameProfile(params, lines);
+        for (const auto& line : lines) {
+            DumpLog::GetInstance().Print(line);
+        }
+    } else if (params[0] == "-bgtask") {
+        std::vector<std::string> lines;
+        BackgroundTaskExecutor::GetInstance().Dump(lines);
+        for (const auto& line : lines) {
+            DumpLog::GetInstance().Print(line);
+        }
+    } else if (params[0] == "-imagecache") {
+        if (imageCache_) {
+            std::vector<std::string> lines;
+            imageCache_->Dump(lines);
+            for (const auto& line : lines) {
+                DumpLog::GetInstance().Print(line);
+            }
+        }
     } else if (params[0] == "-jscrash") {
         EventReport::JsErrReport(
             AceApplicationInfo::GetInstance().GetPackageName(), "js crash reason", "js crash summary");
@@ -960,8 +1005,22 @@ void PipelineContext::Dump(const std::vector<std::string>& params) const
     }
 }
 
+void PipelineContext::DumpFrameProfile(const std::vector<std::string>& params, std::vector<std::string>& lines) const
+{
+    frameProfiler_.Dump(lines);
+    if (params.size() > 1 && params[1] == "-reset") {
+        frameProfiler_.Reset();
+        lines.emplace_back("FrameProfiler reset");
+    }
+}
+
 void PipelineContext::DumpInfo(const std::vector<std::string>& params, std::vector<std::string>& info)
 {
+    // The frame profile is a few lines, it is returned directly rather than through a dump file.
+    if (!params.empty() && params[0] == "-frameprofile") {
+        DumpFrameProfile(params, info);
+        return;
+    }
     if (!SystemProperties::GetDebugEnabled()) {
         std::unique_ptr<std::ostream> ss = std::make_unique<std::ostringstream>();
         DumpLog::GetInstance().SetDumpFile(std::move(ss));
@@ -1380,7 +1439,7 @@ void PipelineContext::AddDirtyElement(const RefPtr<Element>& dirtyElement)
         LOGW("dirtyElement is null");
         return;
     }
-    dirtyElements_.emplace(dirtyElement);
+    dirtyElements_.Push(dirtyElement);
     hasIdleTasks_ = true;
     window_->RequestFrame();
 }
@@ -1408,9 +1467,9 @@ void PipelineContext::AddDirtyRenderNode(const RefPtr<RenderNode>& renderNode, b
         return;
     }
     if (!overlay) {
-        dirtyRenderNodes_.emplace(renderNode);
+        dirtyRenderNodes_.Push(renderNode);
     } else {
-        dirtyRenderNodesInOverlay_.emplace(renderNode);
+        dirtyRenderNodesInOverlay_.Push(renderNode);
     }
     hasIdleTasks_ = true;
     window_->RequestFrame();
@@ -1423,7 +1482,7 @@ void PipelineContext::AddNeedRenderFinishNode(const RefPtr<RenderNode>& renderNo
         LOGW("renderNode is null");
         return;
     }
-    needPaintFinishNodes_.emplace(renderNode);
+    needPaintFinishNodes_.Push(renderNode);
 }
 
 void PipelineContext::AddDirtyLayoutNode(const RefPtr<RenderNode>& renderNode)
@@ -1434,7 +1493,7 @@ void PipelineContext::AddDirtyLayoutNode(const RefPtr<RenderNode>& renderNode)
         return;
     }
     renderNode->SaveExplicitAnimationOption(explicitAnimationOption_);
-    dirtyLayoutNodes_.emplace(renderNode);
+    dirtyLayoutNodes_.Push(renderNode);
     ForceLayoutForImplicitAnimation();
     hasIdleTasks_ = true;
     window_->RequestFrame();
@@ -1447,7 +1506,7 @@ void PipelineContext::AddPredictLayoutNode(const RefPtr<RenderNode>& renderNode)
         LOGW("renderNode is null");
         return;
     }
-    predictLayoutNodes_.emplace(renderNode);
+    predictLayoutNodes_.Push(renderNode);
     ForceLayoutForImplicitAnimation();
     hasIdleTasks_ = true;
     window_->RequestFrame();
@@ -1455,7 +1514,7 @@ void PipelineContext::AddPredictLayoutNode(const RefPtr<RenderNode>& renderNode)
 
 void PipelineContext::AddGeometryChangedNode(const RefPtr<RenderNode>& renderNode)
 {
-    geometryChangedNodes_.emplace(renderNode);
+    geometryChangedNodes_.Push(renderNode);
 }
 
 void PipelineContext::AddPreFlushListener(const RefPtr<FlushEvent>& listener)
@@ -1481,7 +1540,9 @@ void PipelineContext::AddPostFlushListener(const RefPtr<FlushEvent>& listener)
 uint32_t PipelineContext::AddScheduleTask(const RefPtr<ScheduleTask>& task)
 {
     CHECK_RUN_ON(UI);
-    scheduleTasks_.try_emplace(++nextScheduleTaskId_, task);
+    scheduleTaskIndexes_.emplace(++nextScheduleTaskId_, scheduleTasks_.size());
+    scheduleTaskIds_.emplace_back(nextScheduleTaskId_);
+    scheduleTasks_.emplace_back(task);
     window_->RequestFrame();
     return nextScheduleTaskId_;
 }
@@ -1506,7 +1567,43 @@ void PipelineContext::RemoveRequestedRotationNode(const WeakPtr<RenderNode>& ren
 void PipelineContext::RemoveScheduleTask(uint32_t id)
 {
     CHECK_RUN_ON(UI);
-    scheduleTasks_.erase(id);
+    auto iter = scheduleTaskIndexes_.find(id);
+    if (iter == scheduleTaskIndexes_.end()) {
+        return;
+    }
+    size_t index = iter->second;
+    scheduleTaskIndexes_.erase(iter);
+    if (isFlushingAnimation_) {
+        // Keep the slots in place while FlushAnimation walks them.
+        scheduleTaskIds_[index] = 0;
+        scheduleTasks_[index] = nullptr;
+        return;
+    }
+    if (index + 1 != scheduleTasks_.size()) {
+        scheduleTaskIds_[index] = scheduleTaskIds_.back();
+        scheduleTasks_[index] = std::move(scheduleTasks_.back());
+        scheduleTaskIndexes_[scheduleTaskIds_[index]] = index;
+    }
+    scheduleTaskIds_.pop_back();
+    scheduleTasks_.pop_back();
+}
+
+void PipelineContext::CompactScheduleTasks()
+{
+    size_t count = 0;
+    for (size_t i = 0; i < scheduleTasks_.size(); ++i) {
+        if (!scheduleTasks_[i]) {
+            continue;
+        }
+        if (count != i) {
+            scheduleTaskIds_[count] = scheduleTaskIds_[i];
+            scheduleTasks_[count] = std::move(scheduleTasks_[i]);
+            scheduleTaskIndexes_[scheduleTaskIds_[count]] = count;
+        }
+        ++count;
+    }
+    scheduleTaskIds_.resize(count);
+    scheduleTasks_.resize(count);
 }
 
 RefPtr<RenderNode> PipelineContext::DragTestAll(const TouchEvent& point)
@@ -1839,9 +1936,11 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
     }
 #endif
     if (isSurfaceReady_) {
+        frameProfiler_.BeginFrame(nanoTimestamp);
         FlushAnimation(GetTimeFromExternalTimer());
         FlushPipelineWithoutAnimation();
         FlushAnimationTasks();
+        frameProfiler_.EndFrame();
         hasIdleTasks_ = false;
     } else {
         LOGW("the surface is not ready, waiting");
@@ -2441,14 +2540,14 @@ void PipelineContext::Destroy()
     ClearImageCache();
     rootElement_.Reset();
     composedElementMap_.clear();
-    dirtyElements_.clear();
+    dirtyElements_.Clear();
     deactivateElements_.clear();
-    dirtyRenderNodes_.clear();
-    dirtyRenderNodesInOverlay_.clear();
-    dirtyLayoutNodes_.clear();
-    predictLayoutNodes_.clear();
-    geometryChangedNodes_.clear();
-    needPaintFinishNodes_.clear();
+    dirtyRenderNodes_.Clear();
+    dirtyRenderNodesInOverlay_.Clear();
+    dirtyLayoutNodes_.Clear();
+    predictLayoutNodes_.Clear();
+    geometryChangedNodes_.Clear();
+    needPaintFinishNodes_.Clear();
     dirtyFocusNode_.Reset();
     dirtyFocusScope_.Reset();
     postFlushListeners_.clear();
@@ -3580,12 +3679,9 @@ void PipelineContext::AddNodesToNotifyOnPreDraw(const RefPtr<RenderNode>& render
 
 void PipelineContext::UpdateNodesNeedDrawOnPixelMap()
 {
-    for (const auto& dirtyNode : dirtyRenderNodes_) {
-        SearchNodesNeedDrawOnPixelMap(dirtyNode);
-    }
-    for (const auto& dirtyNode : dirtyRenderNodesInOverlay_) {
-        SearchNodesNeedDrawOnPixelMap(dirtyNode);
-    }
+    auto searchNode = [this](const RefPtr<RenderNode>& dirtyNode) { SearchNodesNeedDrawOnPixelMap(dirtyNode); };
+    dirtyRenderNodes_.ForEach(searchNode);
+    dirtyRenderNodesInOverlay_.ForEach(searchNode);
 }
 
 void PipelineContext::SearchNodesNeedDrawOnPixelMap(const RefPtr<RenderNode>& renderNode)
@@ -28,6 +28,7 @@
 #include "base/geometry/offset.h"
 #include "base/geometry/rect.h"
 #include "base/image/pixel_map.h"
+#include "base/log/frame_profiler.h"
 #include "base/memory/ace_type.h"
 #include "base/resource/asset_manager.h"
 #include "base/resource/data_provider_manager.h"
@@ -53,6 +54,7 @@
 #include "core/gestures/gesture_info.h"
 #include "core/image/image_cache.h"
 #include "core/pipeline/base/composed_component.h"
+#include "core/pipeline/base/dirty_node_queue.h"
 #include "core/pipeline/base/factories/render_factory.h"
 #ifndef WEARABLE_PRODUCT
 #include "core/event/multimodal/multimodal_manager.h"
@@ -972,6 +974,11 @@ public:
         return transparentHole_;
     }
 
+    FrameProfiler& GetFrameProfiler()
+    {
+        return frameProfiler_;
+    }
+
     bool GetHasMeetSubWindowNode() const
     {
         return hasMeetSubWindowNode_;
@@ -1255,6 +1262,7 @@ private:
     void FlushPredictLayout(int64_t deadline);
     void FlushAnimation(uint64_t nanoTimestamp);
     void FlushPostAnimation();
+    void CompactScheduleTasks();
     void FlushPageUpdateTasks();
     void ProcessPreFlush();
     void ProcessPostFlush();
@@ -1266,6 +1274,7 @@ private:
     void FlushWindowBlur();
     void MakeThreadStuck(const std::vector<std::string>& params) const;
     void DumpFrontend() const;
+    void DumpFrameProfile(const std::vector<std::string>& params, std::vector<std::string>& lines) const;
     void ExitAnimation();
     void CreateGeometryTransition();
     void CorrectPosition();
@@ -1298,18 +1307,27 @@ private:
         }
     };
 
+    using RenderNodeQueue = DirtyNodeQueue<RenderNode>;
+
     Rect dirtyRect_;
     uint32_t nextScheduleTaskId_ = 0;
-    std::unordered_map<uint32_t, RefPtr<ScheduleTask>> scheduleTasks_;
+    // Running schedule tasks are kept in dense arrays and stay registered across frames, so a frame walks them in
+    // order without any allocation. A task removed during FlushAnimation leaves a null slot which is compacted after.
+    // scheduleTaskIndexes_ maps the id of every registered task to its slot.
+    std::vector<uint32_t> scheduleTaskIds_;
+    std::vector<RefPtr<ScheduleTask>> scheduleTasks_;
+    std::unordered_map<uint32_t, size_t> scheduleTaskIndexes_;
     std::unordered_map<ComposeId, std::list<RefPtr<ComposedElement>>> composedElementMap_;
-    std::set<WeakPtr<Element>, NodeCompareWeak<WeakPtr<Element>>> dirtyElements_;
+    DirtyNodeQueue<Element, WeakPtr<Element>> dirtyElements_ { DIRTY_QUEUE_BUILD };
     std::set<WeakPtr<Element>, NodeCompareWeak<WeakPtr<Element>>> needRebuildFocusElement_;
-    std::set<RefPtr<RenderNode>, NodeCompare<RefPtr<RenderNode>>> dirtyRenderNodes_;
-    std::set<RefPtr<RenderNode>, NodeCompare<RefPtr<RenderNode>>> dirtyRenderNodesInOverlay_;
-    std::set<RefPtr<RenderNode>, NodeCompare<RefPtr<RenderNode>>> dirtyLayoutNodes_;
-    std::set<RefPtr<RenderNode>, NodeCompare<RefPtr<RenderNode>>> predictLayoutNodes_;
-    std::set<RefPtr<RenderNode>, NodeCompare<RefPtr<RenderNode>>> needPaintFinishNodes_;
-    std::set<RefPtr<RenderNode>, NodeCompare<RefPtr<RenderNode>>> geometryChangedNodes_;
+    RenderNodeQueue dirtyRenderNodes_ { DIRTY_QUEUE_RENDER };
+    RenderNodeQueue dirtyRenderNodesInOverlay_ { DIRTY_QUEUE_RENDER_IN_OVERLAY };
+    RenderNodeQueue dirtyLayoutNodes_ { DIRTY_QUEUE_LAYOUT };
+    RenderNodeQueue predictLayoutNodes_ { DIRTY_QUEUE_PREDICT_LAYOUT };
+    RenderNodeQueue needPaintFinishNodes_ { DIRTY_QUEUE_PAINT_FINISH };
+    RenderNodeQueue geometryChangedNodes_ { DIRTY_QUEUE_GEOMETRY_CHANGED };
+    // Statistics only, may be reset from the const Dump() entry.
+    mutable FrameProfiler frameProfiler_;
     std::set<RefPtr<RenderNode>> nodesToNotifyOnPreDraw_;
     std::set<RefPtr<RenderNode>> nodesNeedDrawOnPixelMap_;
     std::list<RefPtr<FlushEvent>> postFlushListeners_;
@@ -20,6 +20,7 @@
 
 #include "base/json/json_util.h"
 #include "base/thread/task_executor.h"
+#include "core/animation/schedule_task.h"
 #include "core/common/flutter/flutter_task_executor.h"
 #include "core/common/frontend.h"
 #include "core/common/platform_window.h"
@@ -28,6 +29,7 @@
 #include "core/components/test/unittest/mock/mock_render_depend.h"
 #include "core/components/touch_listener/touch_listener_component.h"
 #include "core/mock/fake_task_executor.h"
+#include "core/pipeline/base/dirty_node_queue.h"
 #include "core/pipeline/pipeline_context.h"
 
 using namespace testing;
@@ -55,6 +57,86 @@ const std::string THREADFIRST = "thread_1";
 const std::string THREADSECOND = "thread_2";
 const std::string THREADTHIRD = "thread_3";
 const std::string THREADFOURTH = "thread_4";
+constexpr uint64_t FIRST_FRAME_TIME = 16000000;
+constexpr uint64_t SECOND_FRAME_TIME = 32000000;
+constexpr uint64_t THIRD_FRAME_TIME = 48000000;
+constexpr int32_t SCHEDULE_TASK_COUNT = 4;
+// Depths of the nodes marked dirty, in the order they are marked.
+const std::vector<int32_t> DIRTY_NODE_DEPTHS = { 2, 0, 1, 0, 2, 1 };
+
+class MockScheduleTask : public ScheduleTask {
+    DECLARE_ACE_TYPE(MockScheduleTask, ScheduleTask);
+
+public:
+    void OnFrame(uint64_t nanoTimestamp) override
+    {
+        ++frameCount_;
+        if (onFrame_) {
+            onFrame_();
+        }
+    }
+
+    int32_t GetFrameCount() const
+    {
+        return frameCount_;
+    }
+
+    void SetOnFrame(std::function<void()>&& onFrame)
+    {
+        onFrame_ = std::move(onFrame);
+    }
+
+private:
+    int32_t frameCount_ = 0;
+    std::function<void()> onFrame_;
+};
+
+// Node stored in a DirtyNodeQueue, id tells the nodes apart in the order they come out.
+class MockDirtyNode : public AceType {
+    DECLARE_ACE_TYPE(MockDirtyNode, AceType);
+
+public:
+    MockDirtyNode(int32_t id, int32_t depth) : id_(id), depth_(depth) {}
+    ~MockDirtyNode() override = default;
+
+    int32_t GetId() const
+    {
+        return id_;
+    }
+
+    int32_t GetDepth() const
+    {
+        return depth_;
+    }
+
+    bool IsInDirtyQueue(uint8_t flag) const
+    {
+        return (dirtyQueueFlags_ & flag) != 0;
+    }
+
+    void SetInDirtyQueue(uint8_t flag, bool inQueue)
+    {
+        if (inQueue) {
+            dirtyQueueFlags_ |= flag;
+        } else {
+            dirtyQueueFlags_ &= static_cast<uint8_t>(~flag);
+        }
+    }
+
+private:
+    int32_t id_ = 0;
+    int32_t depth_ = 0;
+    uint8_t dirtyQueueFlags_ = 0;
+};
+
+std::vector<int32_t> GetDirtyNodeIds(const std::vector<RefPtr<MockDirtyNode>>& nodes)
+{
+    std::vector<int32_t> ids;
+    for (const auto& node : nodes) {
+        ids.emplace_back(node ? node->GetId() : -1);
+    }
+    return ids;
+}
 
 RefPtr<PipelineContext> ConstructContext(const RefPtr<Frontend>& frontend)
 {
@@ -436,4 +518,205 @@ HWTEST_F(PipelineContextTest, RequestAnimationFrame001, TestSize.Level1)
     context->OnVsyncEvent(1, 0);
 }
 
+/**
+ * @tc.name: ScheduleTask001
+ * @tc.desc: Schedule tasks run every frame until removed, removal keeps the other tasks registered.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTest, ScheduleTask001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create pipeline context and add schedule tasks.
+     * @tc.expected: step1. ids are unique and every task runs in the frame.
+     */
+    auto frontend = AceType::MakeRefPtr<MockFrontend>();
+    auto context = ConstructContext(frontend);
+    context->OnSurfaceChanged(SURFACE_WIDTH, SURFACE_HEIGHT);
+    std::vector<RefPtr<MockScheduleTask>> tasks;
+    std::vector<uint32_t> ids;
+    for (int32_t i = 0; i < SCHEDULE_TASK_COUNT; ++i) {
+        tasks.emplace_back(AceType::MakeRefPtr<MockScheduleTask>());
+        ids.emplace_back(context->AddScheduleTask(tasks.back()));
+    }
+    EXPECT_NE(ids[0], ids[1]);
+    context->OnVsyncEvent(FIRST_FRAME_TIME, 0);
+    for (const auto& task : tasks) {
+        EXPECT_EQ(task->GetFrameCount(), 1);
+    }
+
+    /**
+     * @tc.steps: step2. remove the first task, which moves the last one into its slot, then remove the moved task.
+     * @tc.expected: step2. only the tasks left run in the next frame.
+     */
+    context->RemoveScheduleTask(ids[0]);
+    context->RemoveScheduleTask(ids[3]);
+    context->OnVsyncEvent(SECOND_FRAME_TIME, 0);
+    EXPECT_EQ(tasks[0]->GetFrameCount(), 1);
+    EXPECT_EQ(tasks[1]->GetFrameCount(), 2);
+    EXPECT_EQ(tasks[2]->GetFrameCount(), 2);
+    EXPECT_EQ(tasks[3]->GetFrameCount(), 1);
+
+    /**
+     * @tc.steps: step3. remove an unknown id and a removed id.
+     * @tc.expected: step3. nothing changes.
+     */
+    context->RemoveScheduleTask(0);
+    context->RemoveScheduleTask(ids[0]);
+    context->OnVsyncEvent(THIRD_FRAME_TIME, 0);
+    EXPECT_EQ(tasks[1]->GetFrameCount(), 3);
+    EXPECT_EQ(tasks[2]->GetFrameCount(), 3);
+}
+
+/**
+ * @tc.name: ScheduleTask002
+ * @tc.desc: Schedule tasks removed or added during a frame are compacted after it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTest, ScheduleTask002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. add four tasks, the second one removes itself and the third one when it runs, and adds a
+     *                   new task.
+     * @tc.expected: step1. the third task does not run, the new task does not run in the same frame.
+     */
+    auto frontend = AceType::MakeRefPtr<MockFrontend>();
+    auto context = ConstructContext(frontend);
+    context->OnSurfaceChanged(SURFACE_WIDTH, SURFACE_HEIGHT);
+    std::vector<RefPtr<MockScheduleTask>> tasks;
+    std::vector<uint32_t> ids;
+    for (int32_t i = 0; i < SCHEDULE_TASK_COUNT; ++i) {
+        tasks.emplace_back(AceType::MakeRefPtr<MockScheduleTask>());
+        ids.emplace_back(context->AddScheduleTask(tasks.back()));
+    }
+    auto addedTask = AceType::MakeRefPtr<MockScheduleTask>();
+    uint32_t addedId = 0;
+    tasks[1]->SetOnFrame([context, &ids, &addedTask, &addedId]() {
+        context->RemoveScheduleTask(ids[1]);
+        context->RemoveScheduleTask(ids[2]);
+        addedId = context->AddScheduleTask(addedTask);
+    });
+    context->OnVsyncEvent(FIRST_FRAME_TIME, 0);
+    EXPECT_EQ(tasks[0]->GetFrameCount(), 1);
+    EXPECT_EQ(tasks[1]->GetFrameCount(), 1);
+    EXPECT_EQ(tasks[2]->GetFrameCount(), 0);
+    EXPECT_EQ(tasks[3]->GetFrameCount(), 1);
+    EXPECT_EQ(addedTask->GetFrameCount(), 0);
+
+    /**
+     * @tc.steps: step2. run the next frame.
+     * @tc.expected: step2. the removed tasks stay removed, the others and the added task run.
+     */
+    context->OnVsyncEvent(SECOND_FRAME_TIME, 0);
+    EXPECT_EQ(tasks[0]->GetFrameCount(), 2);
+    EXPECT_EQ(tasks[1]->GetFrameCount(), 1);
+    EXPECT_EQ(tasks[2]->GetFrameCount(), 0);
+    EXPECT_EQ(tasks[3]->GetFrameCount(), 2);
+    EXPECT_EQ(addedTask->GetFrameCount(), 1);
+
+    /**
+     * @tc.steps: step3. remove the tasks moved by the compaction.
+     * @tc.expected: step3. they are found by id and only the first task is left.
+     */
+    context->RemoveScheduleTask(ids[3]);
+    context->RemoveScheduleTask(addedId);
+    context->OnVsyncEvent(THIRD_FRAME_TIME, 0);
+    EXPECT_EQ(tasks[0]->GetFrameCount(), 3);
+    EXPECT_EQ(tasks[3]->GetFrameCount(), 2);
+    EXPECT_EQ(addedTask->GetFrameCount(), 1);
+}
+
+/**
+ * @tc.name: DirtyNodeQueue001
+ * @tc.desc: Dirty nodes come out parent before child, in the order they are marked within the same depth.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTest, DirtyNodeQueue001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. mark nodes of mixed depths.
+     * @tc.expected: step1. they are taken out by increasing depth, the queue is empty and no node is flagged.
+     */
+    DirtyNodeQueue<MockDirtyNode> queue(DIRTY_QUEUE_LAYOUT);
+    std::vector<RefPtr<MockDirtyNode>> nodes;
+    for (size_t i = 0; i < DIRTY_NODE_DEPTHS.size(); ++i) {
+        nodes.emplace_back(AceType::MakeRefPtr<MockDirtyNode>(static_cast<int32_t>(i), DIRTY_NODE_DEPTHS[i]));
+        queue.Push(nodes.back());
+    }
+    EXPECT_EQ(queue.Size(), nodes.size());
+    auto dirtyNodes = queue.TakeAll();
+    EXPECT_EQ(GetDirtyNodeIds(dirtyNodes), std::vector<int32_t>({ 1, 3, 2, 5, 0, 4 }));
+    EXPECT_TRUE(queue.Empty());
+    for (const auto& node : nodes) {
+        EXPECT_FALSE(node->IsInDirtyQueue(DIRTY_QUEUE_LAYOUT));
+    }
+
+    /**
+     * @tc.steps: step2. give the batch back and mark a node again.
+     * @tc.expected: step2. the node comes out alone.
+     */
+    queue.Recycle(std::move(dirtyNodes));
+    queue.Push(nodes[0]);
+    EXPECT_EQ(GetDirtyNodeIds(queue.TakeAll()), std::vector<int32_t>({ 0 }));
+}
+
+/**
+ * @tc.name: DirtyNodeQueue002
+ * @tc.desc: A node marked twice is queued once, and only in the queue it is marked for.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTest, DirtyNodeQueue002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. mark a node twice in the layout queue and once in the render queue.
+     * @tc.expected: step1. each queue holds it once.
+     */
+    DirtyNodeQueue<MockDirtyNode> layoutQueue(DIRTY_QUEUE_LAYOUT);
+    DirtyNodeQueue<MockDirtyNode, WeakPtr<MockDirtyNode>> renderQueue(DIRTY_QUEUE_RENDER);
+    auto node = AceType::MakeRefPtr<MockDirtyNode>(0, 0);
+    layoutQueue.Push(node);
+    layoutQueue.Push(node);
+    renderQueue.Push(node);
+    EXPECT_EQ(layoutQueue.Size(), 1u);
+    EXPECT_EQ(renderQueue.Size(), 1u);
+
+    /**
+     * @tc.steps: step2. flush the layout queue, then clear the render queue.
+     * @tc.expected: step2. the node is in neither queue, and can be marked in the render queue again.
+     */
+    EXPECT_EQ(GetDirtyNodeIds(layoutQueue.TakeAll()), std::vector<int32_t>({ 0 }));
+    EXPECT_FALSE(node->IsInDirtyQueue(DIRTY_QUEUE_LAYOUT));
+    EXPECT_TRUE(node->IsInDirtyQueue(DIRTY_QUEUE_RENDER));
+    renderQueue.Clear();
+    EXPECT_FALSE(node->IsInDirtyQueue(DIRTY_QUEUE_RENDER));
+    renderQueue.Push(node);
+    EXPECT_EQ(renderQueue.Size(), 1u);
+}
+
+/**
+ * @tc.name: DirtyNodeQueue003
+ * @tc.desc: Nodes marked while a batch is flushed are queued for the next flush.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTest, DirtyNodeQueue003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. flush a parent and a child, each marks itself and the other while it is flushed.
+     * @tc.expected: step1. both are queued once again, parent first.
+     */
+    DirtyNodeQueue<MockDirtyNode> queue(DIRTY_QUEUE_LAYOUT);
+    auto parent = AceType::MakeRefPtr<MockDirtyNode>(0, 0);
+    auto child = AceType::MakeRefPtr<MockDirtyNode>(1, 1);
+    queue.Push(child);
+    queue.Push(parent);
+    auto dirtyNodes = queue.TakeAll();
+    for (const auto& node : dirtyNodes) {
+        queue.Push(node);
+        queue.Push(node == parent ? child : parent);
+    }
+    EXPECT_EQ(queue.Size(), 2u);
+    queue.Recycle(std::move(dirtyNodes));
+    EXPECT_EQ(GetDirtyNodeIds(queue.TakeAll()), std::vector<int32_t>({ 0, 1 }));
+    EXPECT_TRUE(queue.Empty());
+}
+
 } // namespace OHOS::Ace